@@ -42,21 +42,21 @@
 #include <cdefs.h>
 #include <const.h>
 #include <approxe.h>
-#include <lentz_gamma.h>
-
-#include <stdio.h>
+#include <igamc.h>
 
 /*
  * The approximate entropy test context.
  */
 struct approxe_ctx {
 	unsigned int 	nbits;	/* number of bits processed */
-	uint32_t	first;	/* first m-1 appended bits */
-	uint32_t	block;	/* last not full block */
+	uint32_t	first;	/* first m bits, appended at the end */
+	uint32_t	block;	/* the window, last m + 1 bits */
 	unsigned int *	freq0;	/* block value frequencies for m */
 	unsigned int *	freq1;	/* block value frequencies for m + 1 */
 	unsigned int	m;	/* bits for each block */
+	int		flags;	/* flags from params */
 	double		alpha;	/* significance level for H0 */
+	double		crit;	/* stats critical value for alpha */
 };
 
 int
@@ -64,7 +64,7 @@ approxe_init(struct tras_ctx *ctx, void *params)
 {
 	struct approxe_params *p = params;
 	struct approxe_ctx *c;
-	unsigned int i, n, error;
+	unsigned int n, error;
 	size_t size;
 
 	TRAS_CHECK_INIT(ctx);
@@ -73,10 +73,9 @@ approxe_init(struct tras_ctx *ctx, void *params)
 	if (p->m < APPROXE_MIN_M || p->m > APPROXE_MAX_M)
 		return (EINVAL);
 
-	n = (unsigned int)pow(2.0, p->m);
+	n = 1U << p->m;
 
-	size = sizeof(struct approxe_ctx) + (p->m - 1 + 7) / 8 +
-	   (n + 2 * n) * sizeof(unsigned int);
+	size = sizeof(struct approxe_ctx) + (n + 2 * n) * sizeof(unsigned int);
 
 	error = tras_init_context(ctx, &approxe_algo, size, TRAS_F_ZERO);
 	if (error != 0)
@@ -87,115 +86,85 @@ approxe_init(struct tras_ctx *ctx, void *params)
 	c->freq1 = (unsigned int *)(c->freq0 + n);
 
 	c->m = p->m;
+	c->flags = p->flags;
 	c->alpha = p->alpha;
+	/* The stats is chi-square with 2^(m-1) degrees of freedom */
+	c->crit = 2.0 * igamci((double)(1 << (p->m - 1)), p->alpha);
 
 	return (0);
 }
 
-inline static uint32_t
-approxe_get_sequence(int offs, int nbits, uint8_t *data)
-{
-	uint32_t seq = 0;
-	uint8_t mask, b, *d;
-	int n;
-
-	d = data + offs / 8;
-
-	while (nbits > 0) {
-		b = *d++ & (0xff >> (offs & 0x07));
-		n = 8 - (offs & 0x7);
-		if (nbits < n) {
-			b = b >> (n - nbits);
-			n = nbits;
-		}
-		seq = (seq << n) | (uint32_t)b;
-		offs += n;
-		nbits -= n;
-	}
-	return (seq);
-}
-
 #define	EXTRACT_BIT(d, o)	\
 	(((d)[(o) >> 3] >> (7 - ((o) & 0x07))) & 0x01)
 
+/*
+ * Slide the window of m + 1 bits over nbits bits of p from offs. The m bits
+ * block ends each window from the m-th bit of the sequence, the m + 1 bits
+ * block from the next one.
+ */
 static void
-approxe_update_sequence(uint8_t *p, unsigned int offs, unsigned int nbits,
-    unsigned int m, uint32_t block, unsigned int *freq)
+approxe_update_sequence(struct approxe_ctx *c, const uint8_t *p,
+    unsigned int offs, unsigned int nbits)
 {
-	uint32_t mask;
-
-	mask = (1 << m) - 1;
-
-	while (nbits > 0) {
-		block = (block << 1) & mask;
-		block = block | EXTRACT_BIT(p, offs);
-		freq[block]++;
-		nbits--;
-		offs++;
+	uint32_t block, mask0, mask1, b;
+	unsigned int i, pos, m;
+
+	m = c->m;
+	mask0 = (1U << m) - 1;
+	mask1 = (1U << (m + 1)) - 1;
+	block = c->block;
+	pos = c->nbits;
+
+	for (i = 0; i < nbits; i++, offs++) {
+		b = EXTRACT_BIT(p, offs);
+		block = ((block << 1) | b) & mask1;
+		if (++pos <= m)
+			c->first = (c->first << 1) | b;
+		if (pos >= m)
+			c->freq0[block & mask0]++;
+		if (pos > m)
+			c->freq1[block]++;
 	}
+	c->block = block;
+	c->nbits = pos;
 }
 
 int
 approxe_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
-	struct approxe_ctx *c;
-	unsigned int n, offs;
-	uint32_t block;
-	uint8_t *p;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	if (nbits == 0)
-		return (0);
-
-	c = ctx->context;
-	p = (uint8_t *)data;
-
-	offs = 0;
-	if (c->nbits < c->m) {
-		n = min(nbits, c->m - c->nbits);
-		block = approxe_get_sequence(0, n, data);
-		block = (c->first << n) | block;
-		c->first = block;
-		c->block = block;
-		if ((c->nbits + n) < c->m) {
-			c->nbits += nbits;
-			return (0);
-		}
-		/* Collected m bits sequence, update for m */
-		c->freq0[block]++;
-		offs = n;
-	}
-
-	n = nbits - offs;
-
-	/*
-	 * update frequency table for sequence with m bits length.
-	 */
-	approxe_update_sequence(p, offs, n, c->m, c->block, c->freq0);
-
-	/*
-	 * update frequency table for sequence with m + 1 bits length.
-	 */
-	approxe_update_sequence(p, offs, n, c->m + 1, c->block, c->freq1);
+	approxe_update_sequence(ctx->context, data, 0, nbits);
 
-	n = min(c->m, c->nbits);
-	block = approxe_get_sequence(c->nbits - n, n, data);
-	c->block = (c->block < n) | block;
+	return (0);
+}
 
-	c->nbits += nbits;
+/*
+ * The phi value of the relative frequencies of the k blocks values.
+ */
+static double
+approxe_phi(const unsigned int *freq, unsigned int k, unsigned int n)
+{
+	double phi, f;
+	unsigned int i;
 
-	return (0);
+	for (i = 0, phi = 0.0; i < k; i++) {
+		if (freq[i] != 0) {
+			f = (double)freq[i] / (double)n;
+			phi += f * log(f);
+		}
+	}
+	return (phi);
 }
 
 int
 approxe_final(struct tras_ctx *ctx)
 {
 	struct approxe_ctx *c;
-	double pvalue, phim0, phim1, stats, *freq;
-	unsigned int i, n, k;
-	uint8_t d[4];
-	int error;
+	double pvalue, phim0, phim1, stats;
+	uint32_t block, mask0, mask1;
+	unsigned int i, n, m;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -204,59 +173,32 @@ approxe_final(struct tras_ctx *ctx)
 	if (c->nbits == 0 || (c->m >= (log2(c->nbits) - 5)))
 		return (EALREADY);
 
-	d[0] = (c->first >> 24) & 0xff;
-	d[1] = (c->first >> 16) & 0xff;
-	d[2] = (c->first >>  8) & 0xff;
-	d[3] = (c->first >>  0) & 0xff;
-
-	n = 32 - c->m;
-
-	approxe_update_sequence(d, n, c->m - 1, c->m, c->block, c->freq0);
-	approxe_update_sequence(d, n, c->m - 1, c->m + 1, c->block, c->freq1);
-
-	k = 1 << c->m;
+	/*
+	 * The sequence is cyclic, the first bits are appended: m - 1 of them
+	 * complete the n blocks of m bits, m the n blocks of m + 1 bits.
+	 */
+	m = c->m;
 	n = c->nbits;
+	mask0 = (1U << m) - 1;
+	mask1 = (1U << (m + 1)) - 1;
+	block = c->block;
+	for (i = 0; i < m; i++) {
+		block = ((block << 1) | ((c->first >> (m - 1 - i)) & 0x01)) &
+		    mask1;
+		if (i < m - 1)
+			c->freq0[block & mask0]++;
+		c->freq1[block]++;
+	}
 
-	freq = malloc(2 * sizeof(double) * k);
-	if (freq == NULL)
-		return (ENOMEM);
+	phim0 = approxe_phi(c->freq0, 1U << m, n);
+	phim1 = approxe_phi(c->freq1, 1U << (m + 1), n);
 
-	/* Calculate relative frequencies for m */ 
-	for (i = 0; i < k; i++) {
-		freq[i] = ((double)c->freq0[i]) / (double)n;
-	}
-	/* Calculate phi value for m */
-	for (i = 0, phim0 = 0.0; i < k; i++) {
-		if (c->freq0[i] != 0)
-			phim0 += freq[i] * log(freq[i]);
-	}
-	/* Calculate relative frequencies for m + 1 */
-	for (i = 0, k = k * 2, phim1 = 0.0; i < k; i++) {
-		freq[i] = ((double)c->freq1[i]) / (double)n;
-	}
-	/* Calculate phi value for m + 1 */
-	for (i = 0, phim1 = 0.0; i < k; i++) {
-		if (c->freq1[i] != 0)
-			phim1 += freq[i] * log(freq[i]);
-	}
+	stats = 2.0 * (double)n * (log(2.0) - (phim0 - phim1));
 
-	stats = (double)n * (log(2.0) - (phim0 - phim1));
+	pvalue = (c->flags & TRAS_P_DECIDE) ? NAN :
+	    igamc((double)(1 << (m - 1)), stats / 2.0);
 
-	/*
-	 * todo: finalization is not finished since we don't have
-	 * igammac implementation yet.
-	 * pvalue = igamc(2 ^ (m - 1), chi2 / 2);
-	 */
-#if 0
-	pvalue = lentz2_gamma((double)(1 << (c->m - 1)), stats / 2.0, 10e-32, &error);
-printf("getting lentz gamma (%g, %g) = %.16g\n",
-    (double)(1 << (c->m - 1)), stats / 2.0, pvalue);
-	pvalue = pvalue / tgamma((double)(1 << (c->m - 1)));
-#else
-	pvalue = 0.0;
-#endif
-
-	if (pvalue < c->alpha)
+	if (stats > c->crit)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
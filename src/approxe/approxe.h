@@ -35,6 +35,7 @@
 
 struct approxe_params {
 	unsigned int	m;	/* the length of each block */
+	int		flags;	/* TRAS_P_* flags */
 	double 		alpha;	/* significance lelel for H0 */
 };
 
@@ -0,0 +1,195 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * The Approximate Entropy Test.
+
+/*
+ * Check of the Approximate Entropy Test against the brute force statistics
+ * of NIST SP 800-22 for several sizes of updates, of the uniformity of
+ * its p-values over random sequences, and that the decide-only mode gives
+ * the same status.
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <tras.h>
+#include <igamc.h>
+#include <approxe.h>
+
+#include <sys/random.h>
+
+#define	TEST_NBITS	(1 << 16)
+#define	TEST_NSEQS	1000
+#define	TEST_BINS	10
+
+#define	min(a, b)	(((a) < (b)) ? (a) : (b))
+
+static unsigned int test_freq[1 << (APPROXE_MAX_M + 1)];
+
+#define	BIT(d, i)	(((d)[(i) / 8] >> (7 - ((i) % 8))) & 0x01)
+
+/*
+ * The phi of m bits blocks, each one read bit by bit with wraparound.
+ */
+static double
+test_phi(const uint8_t *d, unsigned int n, unsigned int m)
+{
+	unsigned int i, j, k;
+	uint32_t b;
+	double phi, f;
+
+	if (m == 0)
+		return (0.0);
+	k = 1U << m;
+	memset(test_freq, 0, k * sizeof(unsigned int));
+	for (i = 0; i < n; i++) {
+		for (j = 0, b = 0; j < m; j++)
+			b = (b << 1) | BIT(d, (i + j) % n);
+		test_freq[b]++;
+	}
+	for (i = 0, phi = 0.0; i < k; i++) {
+		if (test_freq[i] != 0) {
+			f = (double)test_freq[i] / n;
+			phi += f * log(f);
+		}
+	}
+	return (phi);
+}
+
+static double
+test_apen(const uint8_t *d, unsigned int n, unsigned int m)
+{
+
+	return (2.0 * n * (log(2.0) - (test_phi(d, n, m) -
+	    test_phi(d, n, m + 1))));
+}
+
+/*
+ * Run the test with updates of chunk bits, the last one may be shorter.
+ */
+static int
+test_run(struct approxe_params *p, uint8_t *d, unsigned int n,
+    unsigned int chunk, struct tras_result *result)
+{
+	struct tras_ctx ctx;
+	unsigned int i, k;
+	int error;
+
+	tras_ctx_init(&ctx);
+	error = approxe_init(&ctx, p);
+	if (error != 0)
+		return (error);
+	for (i = 0; i < n && error == 0; i += k) {
+		k = min(chunk, n - i);
+		/* The updates are of whole bytes but the last one */
+		error = approxe_update(&ctx, d + i / 8, k);
+	}
+	if (error == 0)
+		error = approxe_final(&ctx);
+	if (error == 0)
+		*result = ctx.result;
+	approxe_free(&ctx);
+
+	return (error);
+}
+
+int main(void)
+{
+	static const unsigned int chunks[] = { 8, 24, 64, 16384, TEST_NBITS };
+	static const unsigned int ms[] = { 2, 3, 5, 8 };
+	static uint8_t d[TEST_NBITS / 8];
+	struct approxe_params p, pd;
+	struct tras_result r, rd;
+	unsigned int hist[TEST_BINS];
+	unsigned int i, j, s, nfail, ndiff;
+	double stats, chi2, e;
+	int error;
+
+	p.flags = 0;
+	p.alpha = 0.01;
+	nfail = 0;
+
+	for (s = 0; s < 3; s++) {
+		getrandom(d, sizeof(d), 0);
+		for (i = 0; i < sizeof(ms) / sizeof(ms[0]); i++) {
+			p.m = ms[i];
+			stats = test_apen(d, TEST_NBITS, p.m);
+			for (j = 0; j < sizeof(chunks) / sizeof(chunks[0]); j++) {
+				error = test_run(&p, d, TEST_NBITS, chunks[j], &r);
+				if (error != 0 || fabs(r.stats1 - stats) > 1e-6 *
+				    (1.0 + stats)) {
+					printf("m = %u chunk = %u: stats %f, "
+					    "expected %f (%d)\n", p.m, chunks[j],
+					    r.stats1, stats, error);
+					nfail++;
+				}
+			}
+		}
+	}
+	printf("brute force: %s\n", nfail ? "failed" : "success");
+
+	p.m = 3;
+	pd = p;
+	pd.flags = TRAS_P_DECIDE;
+	memset(hist, 0, sizeof(hist));
+	for (s = 0, ndiff = 0; s < TEST_NSEQS; s++) {
+		getrandom(d, sizeof(d), 0);
+		error = test_run(&p, d, TEST_NBITS, 16384, &r);
+		if (error == 0)
+			error = test_run(&pd, d, TEST_NBITS, 16384, &rd);
+		if (error != 0) {
+			printf("test: failed to run the test (%d)\n", error);
+			return (error);
+		}
+		hist[min((unsigned int)(r.pvalue1 * TEST_BINS),
+		    TEST_BINS - 1)]++;
+		if (r.status != rd.status || r.status != ((r.pvalue1 <
+		    p.alpha) ? TRAS_TEST_FAILED : TRAS_TEST_PASSED))
+			ndiff++;
+	}
+	printf("decide-only: %u of %u differ %s\n", ndiff, TEST_NSEQS,
+	    ndiff ? "failed" : "success");
+	e = (double)TEST_NSEQS / TEST_BINS;
+	for (i = 0, chi2 = 0.0; i < TEST_BINS; i++)
+		chi2 += (hist[i] - e) * (hist[i] - e) / e;
+	e = igamc((TEST_BINS - 1) / 2.0, chi2 / 2.0);
+	printf("uniformity: bins");
+	for (i = 0; i < TEST_BINS; i++)
+		printf(" %u", hist[i]);
+	printf(", pvalue = %f %s\n", e, (e < 0.0001) ? "failed" : "success");
+
+	return ((nfail > 0 || ndiff > 0 || e < 0.0001) ? EINVAL : 0);
+}
@@ -33,8 +33,10 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <stddef.h>
+#include <math.h>
 
 #include <tras.h>
 #include <utils.h>
@@ -52,7 +54,10 @@ struct blkfreq_ctx {
 	unsigned int	nblks;	/* full blocked updated */
 	double		stats;	/* statistics for updated blocks */
 	unsigned int	m;	/* block length in bits */
+	int		flags;	/* flags from params */
 	double		alpha;	/* significance level from params */
+	unsigned int	critn;	/* number of blocks of crit */
+	double		crit;	/* stats critical value for alpha */
 };
 
 /*
@@ -78,6 +83,7 @@ blkfreq_init(struct tras_ctx *ctx, void *params)
 	c = ctx->context;
 
 	c->m = p->m;
+	c->flags = p->flags;
 	c->alpha = p->alpha;
 
 	return (0);
@@ -132,6 +138,30 @@ blkfreq_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	return (0);
 }
 
+/*
+ * The result for the stats and its p-value, shared by final and batch. In
+ * the decide-only mode the stats is checked against the critical value.
+ */
+static void
+blkfreq_result(struct tras_result *result, double stats, double pvalue,
+    int flags, double alpha, double crit)
+{
+	int fail;
+
+	if (flags & TRAS_P_DECIDE)
+		fail = (stats > crit);
+	else
+		fail = (pvalue < alpha);
+
+	if (fail)
+		result->status = TRAS_TEST_FAILED;
+	else
+		result->status = TRAS_TEST_PASSED;
+
+	result->stats1 = stats;
+	result->pvalue1 = pvalue;
+}
+
 int
 blkfreq_final(struct tras_ctx *ctx)
 {
@@ -147,22 +177,90 @@ blkfreq_final(struct tras_ctx *ctx)
 
 	c->stats = 4 * c->m * c->stats;
 
-	pvalue = igamc((double)c->nblks / 2.0, c->stats / 2.0);
-
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
+	if (c->flags & TRAS_P_DECIDE) {
+		/* The degrees of freedom are known here, keep the last ones */
+		if (c->critn != c->nblks) {
+			c->crit = 2.0 * igamci((double)c->nblks / 2.0,
+			    c->alpha);
+			c->critn = c->nblks;
+		}
+		pvalue = NAN;
+	} else {
+		pvalue = igamc((double)c->nblks / 2.0, c->stats / 2.0);
+	}
 
+	blkfreq_result(&ctx->result, c->stats, pvalue, c->flags, c->alpha,
+	    c->crit);
 	ctx->result.discard = c->nbits % c->m;
-	ctx->result.stats1 = c->stats;
-	ctx->result.pvalue1 = pvalue;
 
 	tras_fini_context(ctx, 0);
 
 	return (0);
 }
 
+/*
+ * Test k sequences of nbits, TRAS_BATCH_LANES at a time block by block.
+ * The number of blocks is the same for all, so is the critical value, and
+ * the p-values of the lanes are got at once.
+ */
+int
+blkfreq_batch(void *params, const void *data, unsigned int nbits,
+    unsigned int k, struct tras_result *result)
+{
+	struct blkfreq_params *p = params;
+	double stats[TRAS_BATCH_LANES], a[TRAS_BATCH_LANES];
+	double x[TRAS_BATCH_LANES], pvalue[TRAS_BATCH_LANES];
+	unsigned int i, b, l, nl, nblks, sum;
+	const uint8_t *s;
+	size_t stride;
+	double pii, crit;
+
+	TRAS_CHECK_PARA(p, p->alpha);
+
+	if (p->m < BLKFREQ_MIN_M)
+		return (EINVAL);
+	if (nbits < BLKFREQ_MIN_N || nbits < p->m * 100)
+		return (EALREADY);
+
+	nblks = min(nbits / p->m, BLKFREQ_MAX_BLOCKS);
+	if (p->flags & TRAS_P_DECIDE)
+		crit = 2.0 * igamci((double)nblks / 2.0, p->alpha);
+	else
+		crit = 0.0;
+	stride = TRAS_BATCH_STRIDE(nbits);
+
+	for (i = 0; i < k; i += nl) {
+		nl = min(k - i, TRAS_BATCH_LANES);
+		s = (const uint8_t *)data + i * stride;
+		for (l = 0; l < nl; l++)
+			stats[l] = 0.0;
+		for (b = 0; b < nblks; b++) {
+			for (l = 0; l < nl; l++) {
+				sum = frequency_sum1_offs((void *)(s +
+				    l * stride), b * p->m, p->m);
+				pii = (double)sum / p->m - 0.5;
+				stats[l] += pii * pii;
+			}
+		}
+		for (l = 0; l < nl; l++) {
+			stats[l] = 4 * p->m * stats[l];
+			a[l] = (double)nblks / 2.0;
+			x[l] = stats[l] / 2.0;
+			pvalue[l] = NAN;
+		}
+		if (!(p->flags & TRAS_P_DECIDE))
+			igamc_batch(pvalue, a, x, nl);
+		for (l = 0; l < nl; l++) {
+			memset(&result[i + l], 0, sizeof(result[i + l]));
+			blkfreq_result(&result[i + l], stats[l], pvalue[l],
+			    p->flags, p->alpha, crit);
+			result[i + l].discard = nbits % p->m;
+		}
+	}
+
+	return (0);
+}
+
 int
 blkfreq_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
@@ -170,11 +268,38 @@ blkfreq_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	return (tras_do_test(ctx, data, nbits));
 }
 
+/*
+ * Restart in place, the critical value of the last number of blocks holds
+ * for the same alpha.
+ */
 int
 blkfreq_restart(struct tras_ctx *ctx, void *params)
 {
+	struct blkfreq_params *p = params;
+	struct blkfreq_ctx *c;
+	unsigned int critn = 0;
+	double crit = 0.0;
+	int error;
+
+	if (ctx == NULL || p == NULL)
+		return (EINVAL);
+
+	c = ctx->context;
+	if (ctx->state >= TRAS_STATE_INIT && c != NULL &&
+	    c->alpha == p->alpha) {
+		critn = c->critn;
+		crit = c->crit;
+	}
 
-	return (tras_do_restart(ctx, params));
+	error = tras_do_restart(ctx, params);
+	if (error != 0)
+		return (error);
+
+	c = ctx->context;
+	c->critn = critn;
+	c->crit = crit;
+
+	return (0);
 }
 
 int
@@ -195,4 +320,5 @@ const struct tras_algo blkfreq_algo = {
 	.final =	blkfreq_final,
 	.restart =	blkfreq_restart,
 	.free =		blkfreq_free,
+	.batch =	blkfreq_batch,
 };
@@ -53,10 +53,13 @@
  */
 struct blkfreq_params {
 	unsigned int	m;		/* the length of blocks in bits */
+	int		flags;		/* TRAS_P_* flags */
 	double		alpha;		/* significance level */
 };
 
 TRAS_DECLARE_ALGO(blkfreq);
 
+tras_test_batch_t blkfreq_batch;
+
 #endif
 
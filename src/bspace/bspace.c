@@ -28,7 +28,7 @@
  * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
  * SUCH DAMAGE.
  *
- * The Minimum Distance Test.
+ * The Birthday Spacings Test.
  */
 
 #include <stdint.h>
@@ -36,115 +36,87 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
-#include <assert.h>
 #include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
-#include <hamming8.h>
 #include <utils.h>
-#include <bits.h>
+#include <igamc.h>
 #include <bspace.h>
 
-#include <stdio.h>
-
 /*
- * The minimum distance test context.
+ * The birthday spacings test context.
  */
 struct bspace_ctx {
 	unsigned int	nbits;	/* number of bits processed */
-	unsigned int	s;	/* shift/bit offset for integer */
+	unsigned int	s;	/* shift of the day at first offset */
+	unsigned int	noffs;	/* number of bit offsets tested */
 	unsigned int	m;	/* number of birthdays */
 	unsigned int	q;	/* number of bits for a day */
 	unsigned int	n;	/* number of days in a year */
 	unsigned int	nk;	/* number of K values for chi2 */
 	unsigned int	ik;	/* current number of K values */
-	unsigned int *	K;	/* ??? */
-	double *	pprob;	/* Poisson theoretical probabilities */
-	unsigned int *	bdays;	/* birthdays list for single K */
-	unsigned int *	intvs;	/* intervals table */
+	unsigned int	ib;	/* birthdays in the current sample */
+	unsigned int *	hist;	/* number of samples for each K, by offset */
+	uint32_t *	bdays;	/* birthdays list for single K, by offset */
+	uint32_t *	tmp;	/* the integers and the radix sort buffer */
 	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* results for each offset */
 };
 
-#define	tras_assert(cond)	assert((cond))
-
+/*
+ * Sort n values of q bits, LSD radix sort with 8-bit digits. The values
+ * are moved between the table and the buffer, the result is always in the
+ * table, the buffer is left with garbage.
+ */
 static void
-quicksort_int(unsigned int *table, int l, int r)
+bspace_radix_sort(uint32_t *table, uint32_t *buf, unsigned int n,
+    unsigned int q)
 {
-	unsigned int p, v, t, a;
-	unsigned int i, j;
-
-	if (l >= r || l < 0)
-		return;
-
-	/*
-	 * Use simple "in the middle" for pivot point.
-	 */
-	p = l + (r - l) / 2;
-	v = table[p];
-
-	/*
-	 * Swap pivot value with last element.
-	 */
-	t = table[r];
-	table[r] = v;
-	table[p] = t;
-
-	a = l;
-	for (i = l; i < r; i++) {
-		if (table[i] < v) {
-			t = table[i];
-			table[i] = table[a];
-			table[a] = t;
-			a++;
+	unsigned int count[BSPACE_RADIX];
+	unsigned int i, s, d, sum, t;
+	uint32_t *src = table, *dst = buf, *x;
+
+	for (s = 0; s < q; s += BSPACE_RADIX_BITS) {
+		memset(count, 0, sizeof(count));
+		for (i = 0; i < n; i++)
+			count[(src[i] >> s) & (BSPACE_RADIX - 1)]++;
+		for (d = 0, sum = 0; d < BSPACE_RADIX; d++) {
+			t = count[d];
+			count[d] = sum;
+			sum += t;
 		}
+		for (i = 0; i < n; i++)
+			dst[count[(src[i] >> s) & (BSPACE_RADIX - 1)]++] = src[i];
+		x = src;
+		src = dst;
+		dst = x;
 	}
-
-	t = table[a];
-	table[a] = table[r];
-	table[r] = t;
-
-	quicksort_int(table, l, a - 1);
-	quicksort_int(table, a + 1, r);
+	if (src != table)
+		memcpy(table, src, n * sizeof(uint32_t));
 }
 
 /*
- * XXX: tested with other application and random data.
+ * Number of repeated spacings between sorted birthdays, the number of
+ * spacings equal to the previous one after the spacings are sorted. The
+ * first spacing is the first birthday itself.
  */
-static void
-quicksort(unsigned int *table, int n)
-{
-
-	quicksort_int(table, 0, n - 1);
-}
-
-inline static void
-bspace_sort_bdays(struct bspace_ctx *c)
+static unsigned int
+bspace_repeated(struct bspace_ctx *c, uint32_t *b)
 {
+	unsigned int i, K;
 
-	quicksort(c->bdays, c->m);
-}
+	bspace_radix_sort(b, c->tmp, c->m, c->q);
 
-inline static void
-bspace_sort_intvs(struct bspace_ctx *c)
-{
+	for (i = c->m - 1; i > 0; i--)
+		b[i] = b[i] - b[i - 1];
 
-	quicksort(c->intvs, c->m);
-}
+	bspace_radix_sort(b, c->tmp, c->m, c->q);
 
-static inline uint32_t
-bswap32(void *d)
-{
-	uint8_t *p = (uint8_t *)d;
+	for (i = 1, K = 0; i < c->m; i++)
+		K += (b[i] == b[i - 1]);
 
-	return (((uint32_t)p[3] << 24) | (p[2] << 16) | (p[1] << 8) | p[0]);
-}
-
-static inline uint32_t
-rotate32(uint32_t u, int off)
-{
-
-	return ((u << (31 - off)) | (u >> off));
+	return (K);
 }
 
 static inline uint32_t
@@ -155,69 +127,70 @@ bspace_be32enc(void *d)
 	return (((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]);
 }
 
-/*
- * TODO: To implement. Temporary take 24 LSb.
- */
-static inline uint32_t
-bspace_extract32(void *d, int o, int q)
-{
-
-	return (bspace_be32enc(d) & 0x00ffffff);
-}
-
 int
 bspace_init(struct tras_ctx *ctx, void *params)
 {
 	struct bspace_ctx *c;
 	struct bspace_params *p = params;
+	unsigned int noffs;
+	int error;
 
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	if (p->n != (1 << p->q))
+	if (p->q < BSPACE_MIN_Q || p->q > BSPACE_MAX_Q)
+		return (EINVAL);
+	if (p->n != (1U << p->q))
 		return (EINVAL);
-	if (p->b < BSPACE_MIN_BIT_OFFSET || p->b > BSPACE_MAX_BIT_OFFSET)
+	if (p->sweep == NULL && p->b + p->q > 32)
+		return (EINVAL);
+	if (p->m < BSPACE_MIN_M || p->m > BSPACE_MAX_M)
+		return (EINVAL);
+	if (p->nk < BSPACE_MIN_NK)
 		return (EINVAL);
 
-	/* todo: check m, n nk */
+	/* In the sweep mode all offsets of q bits in 32-bit integer */
+	noffs = (p->sweep != NULL) ? 32 - p->q + 1 : 1;
 
-	c = malloc(sizeof(struct bspace_ctx) + p->nk * sizeof(unsigned int) +
-	    + p->m * sizeof(uint32_t) + p->m * sizeof(uint32_t) +
-	    p->nk * sizeof(double));
-	if (c == NULL) {
-		ctx->state = TRAS_STATE_NONE;
-		return (ENOMEM);
-	}
-	c->K = (unsigned int *)(c + 1);
-	c->bdays = c->K + p->nk;
-	c->intvs = c->bdays + p->m;
-	c->pprob = (double *)(c->intvs + p->m);
+	error = tras_init_context(ctx, &bspace_algo, sizeof(struct bspace_ctx) +
+	    noffs * p->m * (sizeof(unsigned int) + sizeof(uint32_t)) +
+	    p->m * sizeof(uint32_t), TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
 
-	/* todo: other initializations when defined */
+	c = ctx->context;
+	c->hist = (unsigned int *)(c + 1);
+	c->bdays = (uint32_t *)(c->hist + noffs * p->m);
+	c->tmp = c->bdays + noffs * p->m;
 
-	c->s = 7 - p->b;
+	c->noffs = noffs;
+	c->s = 32 - p->q - ((p->sweep != NULL) ? 0 : p->b);
+	c->sweep = p->sweep;
 	c->m = p->m;
 	c->q = p->q;
 	c->n = p->n;
 	c->nk = p->nk;
-	memset(c->K, 0, c->nk * sizeof(unsigned int));
-
+	c->ik = 0;
+	c->ib = 0;
 	c->nbits = 0;
 	c->alpha = p->alpha;
 
-	ctx->context = c;
-	ctx->algo = &bspace_algo;
-	ctx->state = TRAS_STATE_INIT;
-
 	return (0);
 }
 
+/*
+ * Each m integers give the birthdays of one sample, the sample K value is
+ * calculated as soon as the sample is complete. After nk samples the rest
+ * of data is ignored. The integers are decoded once, and the days of each
+ * offset are taken from the decoded integers.
+ */
 int
 bspace_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct bspace_ctx *c;
-	unsigned int r, b, s, n, i;
-	uint32_t *p;
+	unsigned int n, i, j, o, s;
+	uint32_t *b, mask;
+	uint8_t *p;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -225,129 +198,139 @@ bspace_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 		return (EINVAL);
 
 	c = ctx->context;
-	p = (uint32_t *)data;
-
-	b = c->nbits / 32;
-	n = min(b, c->m);
-	n = c->m - n;
-	n = min(n, nbits / 32);
-
-	for (i = b; i < n; i++, p++)
-		c->bdays[i] = bspace_extract32(p, c->s, c->q);
+	p = (uint8_t *)data;
+	n = nbits / 32;
+	mask = lmask32[c->q];
+
+	while (n > 0 && c->ik < c->nk) {
+		i = min(n, c->m - c->ib);
+		n -= i;
+		for (j = 0; j < i; j++, p += 4)
+			c->tmp[j] = bspace_be32enc(p);
+		for (o = 0; o < c->noffs; o++) {
+			b = c->bdays + o * c->m + c->ib;
+			s = c->s - o;
+			for (j = 0; j < i; j++)
+				b[j] = (c->tmp[j] >> s) & mask;
+		}
+		c->ib += i;
+		if (c->ib == c->m) {
+			for (o = 0; o < c->noffs; o++) {
+				b = c->bdays + o * c->m;
+				c->hist[o * c->m + bspace_repeated(c, b)]++;
+			}
+			c->ik++;
+			c->ib = 0;
+		}
+	}
 
 	c->nbits += nbits;
 
 	return (0);
 }
 
-int
-bspace_final(struct tras_ctx *ctx)
+/*
+ * The Poisson probability of k events for the parameter lambda.
+ */
+static double
+bspace_poisson(double lambda, unsigned int k)
 {
-	struct bspace_ctx *c;
-	double pvalue, sobs, lambda;
-	unsigned int i, K, diff;
-	int sum;
 
-int j;
-uint32_t *t;
-
-	TRAS_CHECK_FINAL(ctx);
-
-	c = ctx->context;
-
-	if (c->nbits / 32 < c->m)
-		return (EALREADY);
-K = 0;
-for (i = 0; i < c->m - 1; i++) {
-	for (j = i + 1; j < c->m; j++) {
-		if (c->bdays[i] == c->bdays[j])
-			K++;
-	}
+	return (exp(k * log(lambda) - lambda - lgamma(k + 1.0)));
 }
-printf("K1 = %u\n", K);
-
 
-t = malloc(c->m * sizeof(uint32_t));
-memcpy(t, c->bdays, c->m * sizeof(uint32_t));
+/*
+ * Calculate the test result for the histogram of K values.
+ */
+static void
+bspace_result(struct bspace_ctx *c, const unsigned int *hist,
+    struct tras_result *r)
+{
+	double pvalue, lambda, chi2, e, o, pk, rest;
+	unsigned int k, ncls;
 
 	/*
-	 * Sort generated birthdays, let them be positioned as in calendar.
+	 * The K values are Poisson distributed with lambda = m^3 / (4n).
+	 * Consecutive K values are joined into one class until the class
+	 * and the rest of the distribution have enough expected samples.
 	 */
-	bspace_sort_bdays(c);
-K=0;
-for (i = 0; i < c->m; i++) {
-	for (j = 0; j < c->m; j++) {
-		if (t[i] == c->bdays[j])
-			K++;
+	lambda = pow((double)c->m, 3.0) / 4.0 / (double)c->n;
+
+	chi2 = 0.0;
+	ncls = 0;
+	e = 0.0;
+	o = 0.0;
+	rest = 1.0;
+	for (k = 0; k < c->m && c->nk * rest >= BSPACE_MIN_EXPECTED; k++) {
+		pk = bspace_poisson(lambda, k);
+		e += c->nk * pk;
+		o += hist[k];
+		rest -= pk;
+		if (e >= BSPACE_MIN_EXPECTED &&
+		    c->nk * rest >= BSPACE_MIN_EXPECTED) {
+			chi2 += (o - e) * (o - e) / e;
+			ncls++;
+			e = 0.0;
+			o = 0.0;
+		}
 	}
-}
-printf("Kt = %u\n", K);
 
+	/* The last class takes the tail of the distribution */
+	for (; k < c->m; k++)
+		o += hist[k];
+	e += c->nk * max(rest, 0.0);
+	if (e > 0.0) {
+		chi2 += (o - e) * (o - e) / e;
+		ncls++;
+	}
 
+	pvalue = (ncls > 1) ? igamc((ncls - 1) / 2.0, chi2 / 2.0) : 1.0;
 
-for (i = 0; i < c->m; i++)
-	printf("%08x ", c->bdays[i]);
-printf("\n");
-K = 0;
-for (j = 0; j < c->m - 1; j++) {
-	if (c->bdays[j] == c->bdays[j + 1])
-		K++;
-}
-printf("K=%u\n", K);
+	if (pvalue < c->alpha)
+		r->status = TRAS_TEST_FAILED;
+	else
+		r->status = TRAS_TEST_PASSED;
 
-	/*
-	 * Create intervals.
-	 */
-	c->intvs[0] = c->bdays[0];
-	for (i = 1; i < c->m; i++)
-		c->intvs[i] = c->bdays[i] - c->bdays[i - 1];
+	r->discard = c->nbits - c->nk * c->m * 32;
+	r->stats1 = chi2;
+	r->stats2 = lambda;
+	r->pvalue1 = pvalue;
+	r->pvalue2 = 0;
+}
 
-	/*
-	 * Sort intervals list.
-	 */
-	bspace_sort_intvs(c);
+int
+bspace_final(struct tras_ctx *ctx)
+{
+	struct bspace_ctx *c;
+	struct tras_result *r;
+	unsigned int o;
 
-	/*
-	 * Count spacing values between birthdays that occurs more than once.
-	 */
-	for (i = 0, K = 0, diff = 1; i < c->m - 1; i++) {
-		if (c->intvs[i] == c->intvs[i + 1]) {
-			if (diff)
-				K++;
-			diff = 0;
-		} else {
-			diff = 1;
-		}
-	}
+	TRAS_CHECK_FINAL(ctx);
 
-	printf("%s: final K = %u\n", __func__, K);
-	printf("%s: nbits = %u\n", __func__, c->nbits);
+	c = ctx->context;
 
-	/*
-	 * todo: implementation.
-	 */
+	if (c->ik < c->nk)
+		return (EALREADY);
 
-	pvalue = 0.0;
+	bspace_result(c, c->hist, &ctx->result);
 
 	/*
-	 * Compute the Poisson distribution parameter.
+	 * In the sweep mode the test result is the one of the offset with
+	 * the lowest p-value, the test fails if any of the offsets fails.
 	 */
-	lambda = (pow((double)c->m, 3.0) / 4.0 / (double)c->n);
-	(void)lambda;
-	printf("%s: lambda = %g\n", __func__, lambda);
-
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
-
-	ctx->result.discard = c->nbits - c->nk * c->m * c->q;
-	ctx->result.stats1 = 0.0;
-	ctx->result.stats2 = 0.0;
-	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0;
+	if (c->sweep != NULL) {
+		c->sweep->n = c->noffs;
+		for (o = 0; o < c->noffs; o++) {
+			r = &c->sweep->result[o];
+			bspace_result(c, c->hist + o * c->m, r);
+			if (r->pvalue1 < ctx->result.pvalue1)
+				ctx->result = *r;
+			if (r->status == TRAS_TEST_FAILED)
+				ctx->result.status = TRAS_TEST_FAILED;
+		}
+	}
 
-	ctx->state = TRAS_STATE_FINAL;
+	tras_fini_context(ctx, 0);
 
 	return (0);
 }
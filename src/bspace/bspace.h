@@ -34,22 +34,34 @@
 #define	__BSPACE_H__
 
 struct bspace_params {
-	unsigned int	b;	/* bit offset in integer */
+	unsigned int	b;	/* bit offset in integer, from msb */
 	unsigned int	m;	/* number of birthdays */
 	unsigned int	q;	/* number of bits per day */
 	unsigned int	n;	/* number of days in a year */
 	unsigned int	nk;	/* number of K values in chi2 */
 	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* if set, test all offsets of a day */
 };
 
 /*
  * Practical restrictions for the test.
  */
 #define	BSPACE_MIN_M		8
-#define	BSPACE_MAX_M		32
+#define	BSPACE_MAX_M		(1 << 20)
+
+#define	BSPACE_MIN_Q		8
+#define	BSPACE_MAX_Q		31
+
+#define	BSPACE_MIN_NK		1
 
 #define	BSPACE_MIN_BIT_OFFSET	0
-#define	BSPACE_MAX_BIT_OFFSET	7
+
+/* Minimum expected number of samples in a chi-square class */
+#define	BSPACE_MIN_EXPECTED	5.0
+
+/* Bits of the radix sort digit */
+#define	BSPACE_RADIX_BITS	8
+#define	BSPACE_RADIX		(1 << BSPACE_RADIX_BITS)
 
 TRAS_DECLARE_ALGO(bspace);
 
@@ -83,13 +83,27 @@ bstream_init(struct tras_ctx *ctx, void *params)
 	return (0);	
 }
 
+/*
+ * Get 64 bits of the stream starting at byte d, as a big endian number.
+ */
+inline static uint64_t
+bstream_be64(const uint8_t *d)
+{
+
+	return (((uint64_t)d[0] << 56) | ((uint64_t)d[1] << 48) |
+	    ((uint64_t)d[2] << 40) | ((uint64_t)d[3] << 32) |
+	    ((uint64_t)d[4] << 24) | ((uint64_t)d[5] << 16) |
+	    ((uint64_t)d[6] << 8) | (uint64_t)d[7]);
+}
+
 int
 bstream_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct sparse_ctx *c;
-	unsigned int n, i, j, k;
-	uint32_t word, mask, wpos;
+	unsigned int n, i, j, k, l, m, nbytes;
+	uint32_t word, bit, words[BSTREAM_BATCH];
 	uint8_t *bytes = (uint8_t *)data;
+	uint64_t reg;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -103,10 +117,12 @@ bstream_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	k = min(c->letters, BSTREAM_WORDLEN);
 	k = min(nbits, BSTREAM_WORDLEN - k);
 	for (i = 0; i < k; i++) {
-		c->word = ((c->word << 1) & ~0x01) & 0x000fffff;
-		c->word |= (bytes[i >> 3] >> (7 - (i & 0x07))) & 0x01;
+		c->word[0] = ((c->word[0] << 1) & ~0x01) & 0x000fffff;
+		c->word[0] |= (bytes[i >> 3] >> (7 - (i & 0x07))) & 0x01;
 	}
 	c->letters += k;
+	if (k > 0 && c->letters == BSTREAM_WORDLEN)
+		SPARSE_WMAP_SET(c->wmap, c->word[0]);
 
 	if (c->letters < BSTREAM_WORDLEN || c->letters >= BSTREAM_LETTERS) {
 		c->nbits += nbits;
@@ -115,19 +131,45 @@ bstream_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 
 	n = nbits - k;
 	n = min(n, BSTREAM_LETTERS - c->letters);
-	word = c->word;
-	for (j = 0, i = k; j < n; j++, i++) {
-		mask = (bytes[i >> 3] >> (7 - (i & 0x07))) & 0x01;
-		word = ((word << 1) | mask) & 0x000fffff;
-		mask = 1 << (word & 0x1f);
-		wpos = word >> 5;
-		if ((c->wmap[wpos] & mask) == 0) {
-			c->wmap[wpos] |= mask;
-			c->sparse--;
+	nbytes = (nbits + 7) / 8;
+	word = c->word[0];
+	m = 0;
+
+	/*
+	 * The 64-bit register keeps the last 19 bits of the previous word on
+	 * top of the next 44 bits of the stream, so 44 consecutive words are
+	 * taken from it with constant shifts.
+	 */
+	for (j = 0, i = k; n - j >= BSTREAM_REGBITS &&
+	    (i >> 3) + 8 <= nbytes; j += BSTREAM_REGBITS,
+	    i += BSTREAM_REGBITS) {
+		reg = ((uint64_t)(word & 0x0007ffff) << BSTREAM_REGBITS) |
+		    ((bstream_be64(bytes + (i >> 3)) << (i & 0x07)) >> 20);
+		for (l = 0; l < BSTREAM_REGBITS; l++) {
+			words[m + l] = (uint32_t)(reg >>
+			    (BSTREAM_REGBITS - 1 - l)) & 0x000fffff;
+		}
+		word = words[m + BSTREAM_REGBITS - 1];
+		m += BSTREAM_REGBITS;
+		if (m + BSTREAM_REGBITS > BSTREAM_BATCH) {
+			sparse_wmap_update(c->wmap, words, m);
+			m = 0;
+		}
+	}
+
+	/* The tail of the data, bit by bit */
+	for (; j < n; j++, i++) {
+		bit = (bytes[i >> 3] >> (7 - (i & 0x07))) & 0x01;
+		word = ((word << 1) | bit) & 0x000fffff;
+		words[m++] = word;
+		if (m == BSTREAM_BATCH) {
+			sparse_wmap_update(c->wmap, words, m);
+			m = 0;
 		}
 	}
+	sparse_wmap_update(c->wmap, words, m);
 
-	c->word = word;
+	c->word[0] = word;
 	c->letters += n;
 	c->nbits += nbits;
 
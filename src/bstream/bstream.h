@@ -49,6 +49,12 @@ struct bstream_params {
 /* Number of bits to finalize the bstream test. */
 #define	BSTREAM_BITS		BSTREAM_LETTERS
 
+/* Number of words collected at once before the words map update */
+#define	BSTREAM_BATCH		264
+
+/* Number of new words taken from one 64-bit register */
+#define	BSTREAM_REGBITS		44
+
 TRAS_DECLARE_ALGO(bstream);
 
 #endif
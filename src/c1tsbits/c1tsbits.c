@@ -33,23 +33,23 @@
 
 #include <stdint.h>
 #include <errno.h>
+#include <limits.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
 #include <utils.h>
 #include <cdefs.h>
 #include <igamc.h>
-#include <bits.h>
 #include <c1tsbits.h>
 
-	#include <stdio.h>
-
 /*
  * Bytes to letters map.
  */
-static uint8_t b2lmap[256] = {
+const uint8_t c1tsbits_b2lmap[256] = {
 	0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 2,
 	0, 0, 0, 1, 0, 1, 1, 2, 0, 1, 1, 2, 1, 2, 2, 3,
 	0, 0, 0, 1, 0, 1, 1, 2, 0, 1, 1, 2, 1, 2, 2, 3,
@@ -69,20 +69,16 @@ static uint8_t b2lmap[256] = {
 };
 
 /*
- * Two letters word to index map.
+ * Number of ones in a byte to letter map, the same classes as above.
  */
-static uint8_t w2imap[40] = {
-	 0,  1,  2,  3,  4,  0,  0,  0, 
-	 5,  6,  7,  8,  9,  0,  0,  0, 
-	10, 11, 12, 13, 14,  0,  0,  0, 
-	15, 16, 17, 18, 19,  0,  0,  0, 
-	20, 21, 22, 23, 24,  0,  0,  0, 
+static const uint8_t c2lmap[16] = {
+	0, 0, 0, 1, 2, 3, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
 };
 
 /*
  * Letters probabilities.
  */
-static double lprob[5] = {
+static const double lprob[5] = {
 	0.14453125,
 	0.21875000,
 	0.27343750,
@@ -91,27 +87,25 @@ static double lprob[5] = {
 };
 
 /*
- * The V1 - V2 statistics is asymptotically normal with the below parameters.
- */
-#define	C1TSBITS_MEAN		2500
-
-#define	C1TSBITS_STDDEV		70.71
-
-/*
- * XXX: temporary definition here to move to an include file.
+ * The word keeps five letters, three bits each, the oldest letter in the
+ * highest bits. The frequencies are counted directly by this index.
  */
-#define miss(c, cmax)   (((c) < (cmax)) ? (cmax) - (c) : 0)
-#define	min(a, b)	(((a) < (b)) ? (a) : (b))
+#define	C1TSBITS_WORDMASK	0x00007fff
+#define	C1TSBITS_WORDSIZE	(C1TSBITS_WORDMASK + 1)
 
 /*
  * The context for the Count-the-1's Test (Stream of Bits)
  */
 struct c1tsbits_ctx {
-	unsigned int	nbits;	/* number of bits processed */
-	uint8_t		last;	/* bits left from previous update */
-	uint32_t	word;	/* last word colected from updates */
-	unsigned int *	w4freq;	/* four letter words frequencies */
+	uint64_t	nbits;	/* number of bits processed */
+	uint64_t	nletter;/* number of letters collected */
+	uint64_t	nmax;	/* number of letters needed */
+	uint32_t	word;	/* last five letters */
+	uint8_t		last;	/* bits of an incomplete byte, MSB first */
+	unsigned int	nlast;	/* number of bits in last */
 	unsigned int *	w5freq;	/* five letter words frequencies */
+	unsigned int *	w5;	/* frequencies by five letter word number */
+	unsigned int	K;	/* number of five letter words */
 	double		alpha;	/* significance level for H0 */
 };
 
@@ -126,39 +120,32 @@ c1tsbits_init(struct tras_ctx *ctx, void *params)
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	size = sizeof(struct c1tsbits_ctx) + 625 * sizeof(unsigned int) +
-	    3125 * sizeof(unsigned int);
+	if (p->K < C1TSBITS_MIN_WORDS || p->K > C1TSBITS_MAX_WORDS)
+		return (EINVAL);
+
+	size = sizeof(struct c1tsbits_ctx) +
+	    (C1TSBITS_WORDSIZE + C1TSBITS_W5) * sizeof(unsigned int);
 
 	error = tras_init_context(ctx, &c1tsbits_algo, size, TRAS_F_ZERO);
 	if (error != 0)
 		return (error);
 	c = ctx->context;
 
-	c->w4freq = (unsigned int *)(c + 1);
-	c->w5freq = (unsigned int *)(c->w4freq + 625);
+	c->w5freq = (unsigned int *)(c + 1);
+	c->w5 = c->w5freq + C1TSBITS_WORDSIZE;
+	c->K = p->K;
+	c->nmax = (uint64_t)p->K + 4;
 	c->alpha = p->alpha;
 
 	return (0);
 }
 
-#define	__EXTRACT_BYTE_0(p, o)	\
-	(((p)[(o) >> 3] << ((o) & 0x07)) & ~lmask8[(o) & 0x07])
-
-#define	__EXTRACT_BYTE_1(p, o)	\
-	(((o) & 0x07) ?		\
-	(((p)[((o) >> 3) + 1] >> (8-((o) & 0x07))) & lmask8[8-((o) & 0x07)]) \
-	: 0)
-
-#define	__EXTRACT_BYTE(p, o)	\
-	__EXTRACT_BYTE_0(p, o) | __EXTRACT_BYTE_1(p, o)
-
-#ifdef __not_yet__
-#define	__EXTRACT_LETTER(p, o)	\
-{}
-#endif
-
+/*
+ * Get the byte starting at the bit offset offs, the next byte is read only
+ * if the offset is not byte aligned.
+ */
 static inline uint8_t
-c1tsbits_extract_byte(uint8_t *p, unsigned int offs)
+c1tsbits_extract_byte(const uint8_t *p, unsigned int offs)
 {
 	uint16_t u16;
 	unsigned int n;
@@ -169,179 +156,199 @@ c1tsbits_extract_byte(uint8_t *p, unsigned int offs)
 		return (p[n]);
 
 	u16 = (((uint16_t)p[n]) << 8) & 0xff00;
-       	u16 |= (uint16_t)p[n + 1] & 0x00ff;
+	u16 |= (uint16_t)p[n + 1] & 0x00ff;
 	u16 = (u16 >> (8 - (offs & 0x07)));
 
 	return ((uint8_t)(u16 & 0x00ff));
 }
 
-#ifdef notyet
+/*
+ * Add one letter, words are counted once five letters are collected.
+ */
+static inline void
+c1tsbits_letter(struct c1tsbits_ctx *c, uint8_t b)
+{
 
-int
-c1tsbits_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
+	c->word = ((c->word << 3) | c1tsbits_b2lmap[b]) & C1TSBITS_WORDMASK;
+	if (++c->nletter > 4)
+		c->w5freq[c->word]++;
+}
+
+/*
+ * Add eight letters from the big endian word x. The ones are counted in all
+ * bytes at once, then each count selects its letter from a small table.
+ */
+static inline uint32_t
+c1tsbits_letter8(unsigned int *freq, uint32_t word, uint64_t x)
 {
-	struct c1tsbits_ctx *c;
-	uint8_t *p, h, b;
-	unsigned int i, n, r, offs;
+	int s;
 
-	TRAS_CHECK_UPDATE(ctx, data, nbits);
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
 
-	c = ctx->context;
-	p = (uint8_t *)data;
-
-	r = c->nbits & 0x07;
-
-	if (nbits > 0) {
-		offs = 8 - r;
-		if (r > 0) {
-			c->last |= (*p >> r) & lmask8[offs];
-			if (nbits < offs) {
-				c->last &= mmask8[nbits + r];
-			} else {
-				h = hamming8[c->last];
-				c1tsbits_update_freq(c, h);
-				c->last = 0;
-				n = nbits - offs;
-				r = n & 0x07;
-				n = n >> 3;
-				for (i = 0; i < n; i++, p++) {
-					b = __EXTRACT_BYTE(p, offs);
-					h = hamming8[b];
-					c1tsbits_update_freq(c, h);
-				}
-			}
-		} else {
-			n = nbits >> 3;
-			for (i = 0; i < n; i++, p++) {
-				h = hamming8[*p];
-				c1tsbits_update_freq(c, h);
-			}
-			r = nbits & 0x07;
-		}
-		if (r > 0)
-			c->last = *p & mmask8[r];
-		break;
+	for (s = 56; s >= 0; s -= 8) {
+		word = ((word << 3) | c2lmap[(x >> s) & 0x0f]) &
+		    C1TSBITS_WORDMASK;
+		freq[word]++;
 	}
-	c->nbits += nbits;
 
-	return (0);
+	return (word);
 }
-#endif
 
-#define	C1TSBITS_WORDMASK	0x00007fff
+/*
+ * Add n letters from the bytes starting at the bit offset off of p.
+ */
+static void
+c1tsbits_bytes(struct c1tsbits_ctx *c, const uint8_t *p, unsigned int off,
+    unsigned int n)
+{
+	unsigned int i, i0;
+	uint32_t word;
+	uint64_t x;
 
-	#include <stdio.h>
+	for (i = 0; i < n && c->nletter < 4; i++)
+		c1tsbits_letter(c, c1tsbits_extract_byte(p, off + 8 * i));
+
+	word = c->word;
+	for (i0 = i; i + 8 <= n; i += 8) {
+		memcpy(&x, p + i, sizeof(x));
+		x = be64toh(x);
+		if (off > 0)
+			x = (x << off) | (p[i + 8] >> (8 - off));
+		word = c1tsbits_letter8(c->w5freq, word, x);
+	}
+	c->word = word;
+	c->nletter += i - i0;
+
+	for (; i < n; i++)
+		c1tsbits_letter(c, c1tsbits_extract_byte(p, off + 8 * i));
+}
 
 int
-c1tsbits_update8(struct tras_ctx *ctx, void *data, unsigned int nbits)
+c1tsbits_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct c1tsbits_ctx *c;
-	unsigned int j, n, id4, id5;
-	uint32_t word;
-	uint8_t *p;
+	const uint8_t *p;
+	unsigned int k, n, r, off;
+	uint8_t b;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	if (nbits & 0x07) {
-		printf("nbits = %u\n", nbits);
-		return (EINVAL);
-	}
-
 	c = ctx->context;
-	p = (uint8_t *)data;
-
-	j = c->nbits >> 3;
-	n = miss(j, C1TSBITS_BYTES);
-	n = min(n, (nbits >> 3));
+	p = (const uint8_t *)data;
 
-	word = c->word;
-
-	/* Get first four letters */
-	while (j < 4 && n > 0) {
-		word = (word << 3) | b2lmap[*p++];
-		n--; j++;
+	c->nbits += nbits;
+	if (nbits == 0 || c->nletter >= c->nmax)
+		return (0);
+
+	/* Complete the byte left from the previous update */
+	off = 0;
+	if (c->nlast > 0) {
+		k = min(8 - c->nlast, nbits);
+		c->last |= (p[0] >> c->nlast) & mmask8[c->nlast + k];
+		c->nlast += k;
+		if (c->nlast < 8)
+			return (0);
+		c1tsbits_letter(c, c->last);
+		c->last = 0;
+		c->nlast = 0;
+		off = k;
+		nbits -= k;
 	}
-	/* Iterate with five and four letters words */
-	while (n > 0) {
-		word = ((word << 3) | b2lmap[*p++]) & C1TSBITS_WORDMASK;
-		/* 6 bits map is used to calculate four letter word position */
-		id4 = 25 * w2imap[(word >> 6) & 0x3f] + w2imap[word & 0x3f];
-		/* get five letters word position */
-		id5 = 625 * ((word >> 12) & 0x07) + id4;
-		/* update frequencies */
-		c->w4freq[id4]++;
-		c->w5freq[id5]++;
-		n--;
+
+	n = nbits >> 3;
+	if (n > c->nmax - c->nletter)
+		n = c->nmax - c->nletter;
+	c1tsbits_bytes(c, p, off, n);
+
+	/* Keep the bits of an incomplete byte for the next update */
+	r = nbits & 0x07;
+	if (r > 0 && c->nletter < c->nmax) {
+		off += nbits - r;
+		b = p[off >> 3] << (off & 0x07);
+		if ((off & 0x07) + r > 8)
+			b |= p[(off >> 3) + 1] >> (8 - (off & 0x07));
+		c->last = b & mmask8[r];
+		c->nlast = r;
 	}
-	c->word = word;
-	c->nbits += nbits;
 
 	return (0);
 }
 
+/*
+ * Get the chi-square of the words with l letters. The counts of the words
+ * with four letters are the sums over the oldest letter of five letters words.
+ */
+static double
+c1tsbits_chi2(const unsigned int *w5, unsigned int K, unsigned int l)
+{
+	double e, d, q;
+	unsigned int i, j, n, o, w;
+
+	n = (l == 5) ? C1TSBITS_W5 : C1TSBITS_W4;
+	for (i = 0, q = 0.0; i < n; i++) {
+		for (j = 0, w = i, e = (double)K; j < l; j++, w /= 5)
+			e *= lprob[w % 5];
+		if (l == 5)
+			d = (double)w5[i];
+		else
+			for (o = 0, d = 0.0; o < 5; o++)
+				d += (double)w5[i + o * C1TSBITS_W4];
+		d -= e;
+		q += d * d / e;
+	}
+
+	return (q);
+}
+
+double
+c1tsbits_q5q4(const unsigned int *w5, unsigned int K)
+{
+
+	return (c1tsbits_chi2(w5, K, 5) - c1tsbits_chi2(w5, K, 4));
+}
+
+/*
+ * Get the frequencies by word number from the packed words.
+ */
+static void
+c1tsbits_unpack(struct c1tsbits_ctx *c)
+{
+	unsigned int i, j, w, code;
+
+	for (i = 0; i < C1TSBITS_W5; i++) {
+		for (j = 0, w = i, code = 0; j < 5; j++, w /= 5)
+			code |= (w % 5) << (3 * j);
+		c->w5[i] = c->w5freq[code];
+	}
+}
+
 int
 c1tsbits_final(struct tras_ctx *ctx)
 {
 	struct c1tsbits_ctx *c;
-	double pvalue, s, d, v2, v1, *exp;
-	int i, j, w, l;
+	double pvalue, q;
+	uint64_t discard;
 
 	TRAS_CHECK_FINAL(ctx);
 
 	c = ctx->context;
-	if (c->nbits < C1TSBITS_MIN_NBITS) {
-		printf("nbits = %u, needed = %u\n", c->nbits, C1TSBITS_MIN_NBITS);
+	if (c->nletter < c->nmax)
 		return (EALREADY);
-	}
-
-	exp = malloc(3125 * sizeof(double));
-	if (exp == NULL)
-		return (ENOMEM);
-
-	/* Get expected value for five letter words */
-	for (i = 0; i < 3125; i++) {
-		exp[i] = C1TSBITS_WORDS;
-		w = i;
-		for (j = 0; j < 5; j++) {
-			l = w % 5;
-			exp[i] = exp[i] * lprob[l];
-			w = w / 5;
-		}
-	}
-	for (i = 0, v2 = 0.0; i < 3125; i++) {
-		d = (double)c->w5freq[i]  - exp[i];
-		v2 += d * d / exp[i];
-	}
-	// pvalue = igamc(3124.0 / 2, v2 / 2.0);
-	// printf("v2 = %f\n", v2);
-
-	/* Get expected value for four letter words */
-	for (i = 0; i < 625; i++) {
-		exp[i] = C1TSBITS_WORDS;
-		w = i;
-		for (j = 0; j < 4; j++) {
-			l = w % 5;
-			exp[i] = exp[i] * lprob[l];
-			w = w / 5;
-		}
-	}
-	for (i = 0, v1 = 0.0; i < 625; i++) {
-		d = (double)c->w4freq[i] - exp[i];
-		v1 += d * d / exp[i];
-	}
-	// pvalue = igamc(624 / 2, v1 / 2.0);
-	// printf("v1 = %f\n", v1);
-	// printf("v2 - v1 = %f\n", v2 - v1);
 
-	s = fabs(v2 - v1 - C1TSBITS_MEAN) / C1TSBITS_STDDEV / sqrt((double)2.0);
-	pvalue = erfc(fabs(s));
+	c1tsbits_unpack(c);
+	q = c1tsbits_q5q4(c->w5, c->K);
+	pvalue = igamc(C1TSBITS_DF / 2.0, max(q, 0.0) / 2.0);
 
 	if (pvalue < c->alpha)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
 
-	ctx->result.discard = c->nbits - C1TSBITS_MIN_NBITS;
+	discard = c->nbits - (c->nmax << 3);
+	ctx->result.discard = min(discard, UINT_MAX);
+	ctx->result.stats1 = q;
 	ctx->result.pvalue1 = pvalue;
 
 	tras_fini_context(ctx, 0);
@@ -376,7 +383,7 @@ const struct tras_algo c1tsbits_algo = {
 	.id =		0,
 	.version =	{ 0, 1, 1 },
 	.init =		c1tsbits_init,
-	.update =	c1tsbits_update8,
+	.update =	c1tsbits_update,
 	.test =		c1tsbits_test,
 	.final =	c1tsbits_final,
 	.restart =	c1tsbits_restart,
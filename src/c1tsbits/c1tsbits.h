@@ -37,14 +37,18 @@
  * The Count-the-1's Test parameters
  */
 struct c1tsbits_params {
-	double	alpha;	/* significance level for H0 */
+	unsigned int	K;	/* number of five letters words */
+	double		alpha;	/* significance level for H0 */
 };
 
 /*
- * Words to process.
+ * Words to process in the Diehard test.
  */
 #define	C1TSBITS_WORDS		256000
 
+#define	C1TSBITS_MIN_WORDS	C1TSBITS_WORDS
+#define	C1TSBITS_MAX_WORDS	(1U << 31)
+
 /*
  * The number of letters needed to get (overlapped) all five letters words.
  */
@@ -56,11 +60,27 @@ struct c1tsbits_params {
 #define	C1TSBITS_BYTES		C1TSBITS_LETTERS
 
 /*
- * The number of bits is strictly defined.
+ * The number of bits needed for C1TSBITS_WORDS words.
  */
 #define	C1TSBITS_MIN_NBITS	(C1TSBITS_BYTES << 3)
 
-#define	C1TSBITS_MAX_NBITS	C1TSBITS_MIN_NBITS
+/*
+ * The number of four and five letters words. A word number is the word
+ * in base 5, the oldest letter is the most significant digit.
+ */
+#define	C1TSBITS_W4		625
+#define	C1TSBITS_W5		3125
+
+/*
+ * The Q5 - Q4 statistics is chi-square with 5^5 - 5^4 degrees of freedom.
+ */
+#define	C1TSBITS_DF		(C1TSBITS_W5 - C1TSBITS_W4)
+
+/* Letter of each byte, by the number of ones in it */
+extern const uint8_t c1tsbits_b2lmap[256];
+
+/* Q5 - Q4 for K words counted by word number */
+double c1tsbits_q5q4(const unsigned int *w5, unsigned int K);
 
 TRAS_DECLARE_ALGO(c1tsbits);
 
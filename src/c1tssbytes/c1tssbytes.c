@@ -0,0 +1,239 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * The Count-the-1's Test (Specific Bytes)
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+#include <endian.h>
+#include <math.h>
+
+#include <tras.h>
+#include <cdefs.h>
+#include <igamc.h>
+#include <c1tsbits.h>
+#include <c1tssbytes.h>
+
+/*
+ * The context for the Count-the-1's Test (Specific Bytes). In the sweep
+ * mode each offset of the byte has its own letters and frequency table.
+ */
+struct c1tssbytes_ctx {
+	uint64_t	nbits;	/* number of bits processed */
+	unsigned int	nword;	/* number of integers used */
+	unsigned int	nmax;	/* number of integers needed */
+	unsigned int	noffs;	/* number of byte offsets tested */
+	unsigned int	s;	/* shift of the byte at the first offset */
+	unsigned int	w4[C1TSSBYTES_OFFSETS]; /* last four letters, by offset */
+	unsigned int *	w5freq;	/* five letters words frequencies, by offset */
+	unsigned int	K;	/* number of five letters words */
+	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* results for each offset */
+};
+
+int
+c1tssbytes_init(struct tras_ctx *ctx, void *params)
+{
+	struct c1tssbytes_params *p = params;
+	struct c1tssbytes_ctx *c;
+	unsigned int noffs;
+	int error;
+
+	TRAS_CHECK_INIT(ctx);
+	TRAS_CHECK_PARA(p, p->alpha);
+
+	if (p->sweep == NULL && p->b >= C1TSSBYTES_OFFSETS)
+		return (EINVAL);
+	if (p->K < C1TSSBYTES_MIN_WORDS || p->K > C1TSSBYTES_MAX_WORDS)
+		return (EINVAL);
+
+	/* In the sweep mode all offsets of a byte in 32-bit integer */
+	noffs = (p->sweep != NULL) ? C1TSSBYTES_OFFSETS : 1;
+
+	error = tras_init_context(ctx, &c1tssbytes_algo,
+	    sizeof(struct c1tssbytes_ctx) +
+	    noffs * C1TSBITS_W5 * sizeof(unsigned int), TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
+
+	c->w5freq = (unsigned int *)(c + 1);
+	c->noffs = noffs;
+	c->s = 24 - ((p->sweep != NULL) ? 0 : p->b);
+	c->nmax = p->K + 4;
+	c->K = p->K;
+	c->alpha = p->alpha;
+	c->sweep = p->sweep;
+
+	return (0);
+}
+
+/*
+ * Take the letters of all tested bytes of the integer u. The frequency
+ * tables are updated only when five letters are collected.
+ */
+static inline void
+c1tssbytes_letters(struct c1tssbytes_ctx *c, uint32_t u, int count)
+{
+	unsigned int *freq, o, l, w5, noffs, s;
+
+	freq = c->w5freq;
+	noffs = c->noffs;
+	s = c->s;
+	for (o = 0; o < noffs; o++, freq += C1TSBITS_W5) {
+		l = c1tsbits_b2lmap[(u >> (s - o)) & 0xff];
+		w5 = c->w4[o] * 5 + l;
+		if (count)
+			freq[w5]++;
+		c->w4[o] = w5 % C1TSBITS_W4;
+	}
+}
+
+int
+c1tssbytes_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+	struct c1tssbytes_ctx *c;
+	const uint32_t *p;
+	unsigned int i, n;
+	uint32_t u;
+
+	TRAS_CHECK_UPDATE(ctx, data, nbits);
+
+	if (nbits & 0x1f)
+		return (EINVAL);
+
+	c = ctx->context;
+	p = (const uint32_t *)data;
+
+	c->nbits += nbits;
+	n = min(nbits >> 5, c->nmax - c->nword);
+
+	for (i = 0; i < n && c->nword < 4; i++, c->nword++) {
+		memcpy(&u, p + i, sizeof(u));
+		c1tssbytes_letters(c, be32toh(u), 0);
+	}
+	for (c->nword += n - i; i < n; i++) {
+		memcpy(&u, p + i, sizeof(u));
+		c1tssbytes_letters(c, be32toh(u), 1);
+	}
+
+	return (0);
+}
+
+static void
+c1tssbytes_result(struct c1tssbytes_ctx *c, unsigned int *w5,
+    struct tras_result *r)
+{
+	double q;
+
+	q = c1tsbits_q5q4(w5, c->K);
+
+	r->stats1 = q;
+	r->pvalue1 = igamc(C1TSBITS_DF / 2.0, max(q, 0.0) / 2.0);
+	if (r->pvalue1 < c->alpha)
+		r->status = TRAS_TEST_FAILED;
+	else
+		r->status = TRAS_TEST_PASSED;
+	r->discard = min(c->nbits - ((uint64_t)c->nmax << 5), UINT_MAX);
+}
+
+int
+c1tssbytes_final(struct tras_ctx *ctx)
+{
+	struct c1tssbytes_ctx *c;
+	struct tras_result *r;
+	unsigned int o;
+
+	TRAS_CHECK_FINAL(ctx);
+
+	c = ctx->context;
+	if (c->nword < c->nmax)
+		return (EALREADY);
+
+	c1tssbytes_result(c, c->w5freq, &ctx->result);
+
+	/*
+	 * In the sweep mode the test result is the one of the offset with
+	 * the lowest p-value, the test fails if any of the offsets fails.
+	 */
+	if (c->sweep != NULL) {
+		c->sweep->n = c->noffs;
+		for (o = 0; o < c->noffs; o++) {
+			r = &c->sweep->result[o];
+			c1tssbytes_result(c, c->w5freq + o * C1TSBITS_W5, r);
+			if (r->pvalue1 < ctx->result.pvalue1)
+				ctx->result = *r;
+			if (r->status == TRAS_TEST_FAILED)
+				ctx->result.status = TRAS_TEST_FAILED;
+		}
+	}
+
+	tras_fini_context(ctx, 0);
+
+	return (0);
+}
+
+int
+c1tssbytes_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+
+	return (tras_do_test(ctx, data, nbits));
+}
+
+int
+c1tssbytes_restart(struct tras_ctx *ctx, void *params)
+{
+
+	return (tras_do_restart(ctx, params));
+}
+
+int
+c1tssbytes_free(struct tras_ctx *ctx)
+{
+
+	return (tras_do_free(ctx));
+}
+
+const struct tras_algo c1tssbytes_algo = {
+	.name =		"c1tssbytes",
+	.desc =		"Count-the-1's Test (Specific Bytes)",
+	.id =		0,
+	.version =	{ 0, 1, 1 },
+	.init =		c1tssbytes_init,
+	.update =	c1tssbytes_update,
+	.test =		c1tssbytes_test,
+	.final =	c1tssbytes_final,
+	.restart =	c1tssbytes_restart,
+	.free =		c1tssbytes_free,
+};
@@ -0,0 +1,64 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#ifndef __C1TSSBYTES_H__
+#define	__C1TSSBYTES_H__
+
+/*
+ * The Count-the-1's Test (Specific Bytes) parameters
+ */
+struct c1tssbytes_params {
+	unsigned int	b;	/* bit offset of the byte in integer, from msb */
+	unsigned int	K;	/* number of five letters words */
+	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* if set, test all offsets of a byte */
+};
+
+/*
+ * Words to process in the Diehard test, one letter per 32-bit integer.
+ */
+#define	C1TSSBYTES_WORDS	256000
+
+#define	C1TSSBYTES_MIN_WORDS	C1TSSBYTES_WORDS
+#define	C1TSSBYTES_MAX_WORDS	(1U << 28)
+
+/*
+ * The number of bits needed for C1TSSBYTES_WORDS words.
+ */
+#define	C1TSSBYTES_MIN_NBITS	((C1TSSBYTES_WORDS + 4) * 32)
+
+/* Number of offsets of a byte in 32-bit integer */
+#define	C1TSSBYTES_OFFSETS	25
+
+TRAS_DECLARE_ALGO(c1tssbytes);
+
+#endif
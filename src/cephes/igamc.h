@@ -1,6 +1,28 @@
 #ifndef __CEPHES_IGAMC_H__
 #define	__CEPHES_IGAMC_H__
 
+/*
+ * The incomplete gamma integrals and the log gamma function of Cephes.
+ * They keep no state and do no I/O, so any thread may call them.
+ */
+double lgam(double x);
+double igam(double a, double x);
 double igamc(double a, double x);
 
+/*
+ * The inverse of igamc() in x, for critical values of chi-square tests:
+ * chi2 with k degrees of freedom fails at alpha above 2 igamci(k/2, alpha)
+ * and a normal |z| above sqrt(2 igamci(1/2, alpha)).
+ */
+double igamci(double a, double y);
+
+/*
+ * The same for n arguments, y[i] = igamc(a[i], x[i]) and so on, several
+ * at once. The erfc() of libm is reentrant as well, erfc_batch() gets it
+ * as igamc(1/2, x^2).
+ */
+void igam_batch(double *y, const double *a, const double *x, unsigned int n);
+void igamc_batch(double *y, const double *a, const double *x, unsigned int n);
+void erfc_batch(double *y, const double *x, unsigned int n);
+
 #endif
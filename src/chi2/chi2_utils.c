@@ -48,6 +48,7 @@ chi_square_test(unsigned int K, unsigned int df, const double *exp,
 
 	p.df = (df == 0) ? K - 1 : df;
 
+	tras_ctx_init(&ctx);
 	if (chi2_init(&ctx, &p) != 0)
 		return (EINVAL);
 
@@ -36,231 +36,356 @@
 #include <errno.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
+#include <cdefs.h>
 #include <hamming8.h>
 #include <utils.h>
 #include <bits.h>
+#include <igamc.h>
 #include <craps.h>
 
-	#include <stdio.h>
+/*
+ * Dice are made from 32-bit words in batches of CRAPS_BATCH words.
+ */
+#define	CRAPS_BATCH		1024
+
+/*
+ * A word u gives the die (6 * u) >> 32. The low 32 bits of 6 * u below
+ * 2^32 mod 6 are rejected, so all six faces come from the same number of
+ * words and dice are exactly uniform.
+ */
+#define	CRAPS_REJECT		((uint32_t)((UINT64_C(1) << 32) % 6))
+
+/*
+ * Flags of a game transition, the game ended and the game was won.
+ */
+#define	CRAPS_END		0x01
+#define	CRAPS_WON		0x02
 
 /*
  * The context for the Craps Test.
  */
 struct craps_ctx {
-	unsigned int	freq[21];/* throws to win frequencies */
+	unsigned int	freq[21];/* games by number of throws */
 	unsigned int	K;	/* number of repetition the game */
 	unsigned int	thrs;	/* number of throws */
 	unsigned int	wins;	/* number of wins */
 	unsigned int 	games;	/* number of games */
-	int		next;	/* game not finished */
-	unsigned int	toss;	/* last toss dice sum */
+	unsigned int	point;	/* state of game not finished, 0 if none */
+	unsigned int	die;	/* first die of the pending toss */
+	int		ndie;	/* the first die is pending */
+	unsigned int	nbuf;	/* number of bytes in buf */
+	uint8_t		buf[4];	/* to store incomplete word */
 	double		alpha1;	/* significance level for wins test */
 	double		alpha2;	/* significance level for throws freq test */
 	unsigned int	throws;	/* security, maximum number of throws */
-	unsigned int	nbits;	/* number of bits updated */
+	unsigned int	nthrows;/* number of throws done */
+	uint64_t	nbits;	/* number of bits updated */
+	uint64_t	used;	/* number of bits used by games */
+	uint8_t		dice[CRAPS_BATCH + 1];/* pending die and batch dice */
 };
 
 /*
- * Convert uniformly on interval [0, 1) 32-bits random value.
+ * Game transitions for the state and the sum of a toss, in rows of 16
+ * sums. The state is 0 before the come-out toss or 1 to 6 for the points
+ * 4, 5, 6, 8, 9 and 10, kept shifted by 4 as the offset of its row. An
+ * entry is the next state with CRAPS_END and CRAPS_WON flags; the next
+ * state of an ended game is 0.
  */
-static double
-craps_uniform01(uint32_t r32)
-{
-
-	/*
-	 * XXX: temporary procedure, simple, not uniformly disributing
-	 * value r32 to double in [0, 1) interval. Some values are more
-	 * likely than others
-	 */
-
-	return ((double)r32 / (double)pow(2.0, 32));
-}
+#define	W	(CRAPS_END | CRAPS_WON)
+#define	L	CRAPS_END
+#define	S(x)	((x) << 4)
+static const uint8_t craps_next[7 * 16] = {
+	/* come-out */
+	0, 0, L, L, S(1), S(2), S(3), W, S(4), S(5), S(6), W, L, 0, 0, 0,
+	/* point 4 */
+	0, 0, S(1), S(1), W, S(1), S(1), L,
+	S(1), S(1), S(1), S(1), S(1), 0, 0, 0,
+	/* point 5 */
+	0, 0, S(2), S(2), S(2), W, S(2), L,
+	S(2), S(2), S(2), S(2), S(2), 0, 0, 0,
+	/* point 6 */
+	0, 0, S(3), S(3), S(3), S(3), W, L,
+	S(3), S(3), S(3), S(3), S(3), 0, 0, 0,
+	/* point 8 */
+	0, 0, S(4), S(4), S(4), S(4), S(4), L,
+	W, S(4), S(4), S(4), S(4), 0, 0, 0,
+	/* point 9 */
+	0, 0, S(5), S(5), S(5), S(5), S(5), L,
+	S(5), W, S(5), S(5), S(5), 0, 0, 0,
+	/* point 10 */
+	0, 0, S(6), S(6), S(6), S(6), S(6), L,
+	S(6), S(6), W, S(6), S(6), 0, 0, 0,
+};
+#undef	W
+#undef	L
+#undef	S
 
 int
 craps_init(struct tras_ctx *ctx, void *params)
 {
 	struct craps_ctx *c;
 	struct craps_params *p = params;
-	int i;
+	int error;
 
 	TRAS_CHECK_INIT(ctx);
 
 	TRAS_CHECK_PARA(p, p->alpha1);
 	TRAS_CHECK_PARA(p, p->alpha2);
 
-	c = malloc(sizeof(struct craps_ctx));
-	if (c == NULL) {
-		ctx->state = TRAS_STATE_NONE;
-		return (ENOMEM);
-	}
+	if (p->K < CRAPS_MIN_GAMES)
+		return (EINVAL);
 
-	for (i = 0; i < 21; i++)
-		c->freq[i] = 0;
+	error = tras_init_context(ctx, &craps_algo, sizeof(struct craps_ctx),
+	    TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
 
+	c = ctx->context;
 	c->K = p->K;
-	c->thrs = 0;
-	c->wins = 0;
-	c->next = 0;
-	c->toss = 0;
-	c->games = 0;
 	c->throws = p->throws;
-
-	c->nbits = 0;
 	c->alpha1 = p->alpha1;
 	c->alpha2 = p->alpha2;
 
-	ctx->context = c;
-	ctx->algo = &craps_algo;
-	ctx->state = TRAS_STATE_INIT;
-
 	return (0);
 }
 
-#define	offs_to32(s, o)	(((uint32_t *)(s))[(o) >> 5])
+/*
+ * Get the die from the word u and the low 32 bits of 6 * u in lo. The
+ * product is split into u << 2 and u << 1 so that only 32-bit operations
+ * are used, which the compiler vectorizes.
+ */
+inline static uint8_t
+craps_die(uint32_t u, uint32_t *lo)
+{
+	uint32_t l4, l2;
 
-#define	seq_get32(s, o)	((offs_to32(s, o) << ((o) & 0x1f)) |	\
-	(((o) & 0x1f) ? offs_to32(s, (o) + 32) >> (32 - ((o) & 0x1f)) : 0))
+	l4 = u << 2;
+	l2 = u << 1;
+	*lo = l4 + l2;
 
+	return ((u >> 30) + (u >> 31) + (*lo < l4));
+}
+
+/*
+ * Make dice from n big endian 32-bit words. The loop without rejection
+ * has no branches and is vectorized; only a batch with a rejected word,
+ * which is very rare, is made again skipping it. Return number of dice.
+ */
 static unsigned int
-craps_toss(void *data, unsigned int offs)
+craps_dice(uint8_t *dice, const uint8_t *d, unsigned int n)
 {
-	unsigned int dice;
-	uint32_t die1, die2;
-	double u01;
+	unsigned int i, j;
+	uint32_t u, lo, rej;
+
+	rej = 0;
+	for (i = 0; i < n; i++) {
+		memcpy(&u, d + 4 * i, sizeof(u));
+		u = be32toh(u);
+		dice[i] = craps_die(u, &lo);
+		rej |= lo < CRAPS_REJECT;
+	}
+	if (!rej)
+		return (n);
+
+	for (i = 0, j = 0; i < n; i++) {
+		memcpy(&u, d + 4 * i, sizeof(u));
+		u = be32toh(u);
+		dice[j] = craps_die(u, &lo);
+		if (lo >= CRAPS_REJECT)
+			j++;
+	}
+	return (j);
+}
 
-	if (offs & 0x1f) {
-		die1 = seq_get32(data, offs);
-		die2 = seq_get32(data, offs + 32);
-	} else {
-		die1 = offs_to32(data, offs);
-		die2 = offs_to32(data, offs + 32);
+/*
+ * Play games with the nd dice made from nw words at dice[1], two dice for
+ * a toss. A die left without a pair is kept in the context and put at
+ * dice[0] for the next batch. Faces are from 0 to 5, so the sum of a toss
+ * is the sum of dice plus 2. Games are played with the craps_next
+ * transitions, without branches but for the end of the test.
+ */
+static void
+craps_play(struct craps_ctx *c, unsigned int nd, unsigned int nw)
+{
+	const uint8_t *dice;
+	unsigned int *freq;
+	unsigned int i, n, t, st, thrs, wins, games, nthrows, end, K, throws;
+
+	c->dice[0] = c->die;
+	dice = c->dice + 1 - c->ndie;
+	n = nd + c->ndie;
+
+	st = c->point;
+	thrs = c->thrs;
+	wins = c->wins;
+	games = c->games;
+	nthrows = c->nthrows;
+	freq = c->freq;
+	K = c->K;
+	throws = c->throws;
+
+	for (i = 0; i + 1 < n; ) {
+		t = craps_next[st + dice[i] + dice[i + 1] + 2];
+		i += 2;
+		nthrows++;
+
+		st = t & 0x70;
+		end = t & CRAPS_END;
+		wins += (t & CRAPS_WON) >> 1;
+		freq[thrs] += end;
+		games += end;
+		thrs = min(thrs + 1, 20) & (end - 1);
+		if ((games >= K) | (nthrows >= throws))
+			break;
 	}
 
-	u01 = craps_uniform01(die1);
-	dice = (unsigned int)(u01 * 6);
-	u01 = craps_uniform01(die2);
-	dice += (unsigned int)(u01 * 6);
+	/*
+	 * Count bits of the words used, rejected words are counted as used
+	 * unless the test ended in this batch.
+	 */
+	if (i + 1 < n) {
+		c->used += (uint64_t)32 * (i - c->ndie);
+		c->ndie = 0;
+	} else {
+		c->used += (uint64_t)32 * nw;
+		c->ndie = n - i;
+		c->die = c->ndie ? dice[i] : 0;
+	}
 
-	return (dice);
+	c->point = st;
+	c->thrs = thrs;
+	c->wins = wins;
+	c->games = games;
+	c->nthrows = nthrows;
 }
 
+/*
+ * Update the test with any number of whole bytes. A word split between
+ * updates is kept in the context until completed.
+ */
 int
 craps_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct craps_ctx *c;
-	unsigned int thrs, dice, next, toss;
-	unsigned int r, i, n, offs, throws;
-	double u01;
+	const uint8_t *d;
+	unsigned int n, k, nd;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
+	if (nbits & 0x07)
+		return (EINVAL);
+
 	c = ctx->context;
+	c->nbits += nbits;
+	d = data;
+	n = nbits / 8;
 
-	if (c->games >= c->K) {
-		c->nbits += nbits;
+	if (c->games >= c->K || c->nthrows >= c->throws)
 		return (0);
-	}
 
-	/*
-	 * Support only updates with multiple of 64 bits.
-	 */
-	r = c->nbits & 0x3f;
-	if (r > 0 || (nbits & 0x3f))
-		return (ENOSYS);
-
-	/*
-	 * We use numbers of spots on the face of a die from 0 to 5 to
-	 * avoid adding one to random number. So, the result of of a toss
-	 * of two dice can vary from 0 to 10. (5 and 9 are for win;
-	 * 0, 1, 10 are for loss; continue when 5).
-	 */
-	throws = c->nbits >> 6;
+	if (c->nbuf > 0) {
+		k = min(n, 4 - c->nbuf);
+		memcpy(c->buf + c->nbuf, d, k);
+		c->nbuf += k;
+		d += k;
+		n -= k;
+		if (c->nbuf < 4)
+			return (0);
+		c->nbuf = 0;
+		nd = craps_dice(c->dice + 1, c->buf, 1);
+		craps_play(c, nd, 1);
+	}
 
-	n = nbits >> 6;
-	thrs = c->thrs;
-	next = c->next;
-	toss = c->toss;
-	for (i = 0, offs = 0; i < n; i++, offs += 64) {
-		if (c->games >= c->K)
-			break;
-		if (throws >= c->throws)
-			break;
-		dice = craps_toss(data, offs);
-		throws++;
-		if (next) {
-			thrs = (thrs < 20) ? ++thrs : 20;
-			if (dice != 5 && (dice != toss))
-				continue;
-			c->freq[thrs]++;
-			if (dice == toss)
-				c->wins++;
-		} else if (dice == 5 || dice == 9) {
-			c->freq[0]++;
-			c->wins++;
-		} else if (dice == 0 || dice == 1 || dice == 10) {
-			c->freq[0]++;
-		} else {
-			next = 1;
-			toss = dice;
-			continue;
-		}
-		next = thrs = 0;
-		c->games++;
+	while (n >= 4 && c->games < c->K && c->nthrows < c->throws) {
+		k = min(n / 4, CRAPS_BATCH);
+		nd = craps_dice(c->dice + 1, d, k);
+		craps_play(c, nd, k);
+		d += 4 * k;
+		n -= 4 * k;
 	}
-	c->thrs = thrs;
-	c->next = next;
-	c->toss = toss;
 
-	c->nbits += nbits;
+	if (n > 0 && n < 4 && c->games < c->K && c->nthrows < c->throws) {
+		memcpy(c->buf, d, n);
+		c->nbuf = n;
+	}
 
 	return (0);
 }
 
+/*
+ * Probabilities of a game of 1 to 20 throws and of more than 20 throws,
+ * the classes of freq. A game ends at the come-out toss with 12 of 36
+ * sums, otherwise with the point of w ways after more tosses, each of
+ * which ends it with the w + 6 ways of the point or of 7.
+ */
+static void
+craps_pthrows(double *pr)
+{
+	static const unsigned int ways[6] = { 3, 4, 5, 5, 4, 3 };
+	double r;
+	unsigned int i, k;
+
+	pr[0] = 12.0 / 36.0;
+	for (k = 1; k < 21; k++)
+		pr[k] = 0.0;
+	for (i = 0; i < 6; i++) {
+		r = (ways[i] + 6) / 36.0;
+		for (k = 1; k < 20; k++)
+			pr[k] += ways[i] / 36.0 * pow(1.0 - r, k - 1) * r;
+		pr[20] += ways[i] / 36.0 * pow(1.0 - r, 19);
+	}
+}
+
 int
 craps_final(struct tras_ctx *ctx)
 {
 	struct craps_ctx *c;
-	double pvalue1, pvalue2, sobs;
-	double mean, stdev, p, s;
-	int i, sum;
+	double pvalue1, pvalue2, chi2, e;
+	double mean, stdev, p, s, pr[21];
+	unsigned int i;
 
 	TRAS_CHECK_FINAL(ctx);
 
 	c = ctx->context;
 
-	if (c->games < CRAPS_MIN_GAMES)
-		return (EALREADY);
-	if ((c->nbits >> 6) >= c->throws)
+	if (c->nthrows >= c->throws && c->games < c->K)
 		return (ENXIO);
-
-printf("%s: games = %u, wins = %u, ratio = %g, finished %s\n", __func__, c->games, c->wins,
-    (double)c->wins / (double)c->games,   c->next ? "yes" : "no");
+	if (c->games < c->K)
+		return (EALREADY);
 
 	p = 244.0 / 495.0;
 	mean = p * c->K;
-	stdev = mean * (1.0 - p);
+	stdev = sqrt(mean * (1.0 - p));
 
 	s = ((double)c->wins - mean);
 	s = fabs(s) / sqrt((double)2.0) / stdev;
 	pvalue1 = erfc(s);
-	/* TODO: temporary */
-	pvalue2 = pvalue1;
+
+	/* The chi-square of the throws per game, 20 degrees of freedom */
+	craps_pthrows(pr);
+	for (i = 0, chi2 = 0.0; i < 21; i++) {
+		e = pr[i] * c->games;
+		chi2 += ((double)c->freq[i] - e) * ((double)c->freq[i] - e) / e;
+	}
+	pvalue2 = igamc(10.0, chi2 / 2.0);
 
 	if (pvalue1 < c->alpha1 || pvalue2 < c->alpha2)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
 
-	ctx->result.discard = c->nbits & 0x07;
+	ctx->result.discard = c->nbits - c->used;
 	ctx->result.stats1 = s;
-	ctx->result.stats2 = (double)c->wins;
+	ctx->result.stats2 = chi2;
 	ctx->result.pvalue1 = pvalue1;
 	ctx->result.pvalue2 = pvalue2;
 
-	ctx->state = TRAS_STATE_FINAL;
+	tras_fini_context(ctx, 0);
 
 	return (0);
 }
@@ -98,7 +98,10 @@ struct cusum_ctx {
 	int		sumr;		/* helper sum for backward mode */
 	int		mode;		/* forward or backward direction */
 	unsigned int	nbits;		/* number of bits processed */
+	int		flags;		/* flags from params */
 	double		alpha;		/* significance level */
+	unsigned int	critn;		/* number of bits of crit */
+	int		crit;		/* first z failing for critn bits */
 };
 
 int
@@ -121,6 +124,7 @@ cusum_init(struct tras_ctx *ctx, void *params)
 	c = ctx->context;
 
 	c->mode = p->mode;
+	c->flags = p->flags;
 	c->alpha = p->alpha;
 
 	return (0);
@@ -287,12 +291,89 @@ cusum_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 #define	stdnorm_cpdf(x)	\
 	((1.0 + erf((double)(x) / SQRT_2)) / 2.0)
 
+/*
+ * The p-value of the maximum excursion z of a random walk of n steps.
+ */
+static double
+cusum_pvalue(int z, int n, double *psum)
+{
+	double sum, sqrtn;
+	int first, last, k;
+
+	sqrtn = sqrt((double)n);
+
+	first = (-n / z + 1) / 4;
+	last = (n / z - 1) / 4;
+	for (k = first, sum = 0.0; k <= last; k++) {
+		sum += stdnorm_cpdf((double)(4 * k + 1) * z / sqrtn);
+		sum -= stdnorm_cpdf((double)(4 * k - 1) * z / sqrtn);
+	}
+
+	first = (-n / z - 3) / 4;
+	last = (n / z - 1) / 4;
+	for (k = first; k <= last; k++) {
+		sum -= stdnorm_cpdf((double)(4 * k + 3) * z / sqrtn);
+		sum += stdnorm_cpdf((double)(4 * k + 1) * z / sqrtn);
+	}
+	if (psum != NULL)
+		*psum = sum;
+
+	return (1.0 - sum);
+}
+
+/*
+ * The p-value goes down with z, find the first z failing for n steps.
+ */
+static int
+cusum_crit(int n, double alpha)
+{
+	int lo, hi, z;
+
+	for (lo = 1, hi = n + 1; lo < hi; ) {
+		z = lo + (hi - lo) / 2;
+		if (cusum_pvalue(z, n, NULL) < alpha)
+			hi = z;
+		else
+			lo = z + 1;
+	}
+	return (lo);
+}
+
+/*
+ * The result for the maximum excursion z of n steps, shared by final and
+ * batch, the critical z is used in the decide-only mode.
+ */
+static void
+cusum_result(struct tras_result *result, int z, int n, int flags,
+    double alpha, int crit)
+{
+	double pvalue, sum;
+	int fail;
+
+	if (flags & TRAS_P_DECIDE) {
+		pvalue = NAN;
+		sum = NAN;
+		fail = (z >= crit);
+	} else {
+		pvalue = cusum_pvalue(z, n, &sum);
+		fail = (pvalue < alpha);
+	}
+
+	if (fail)
+		result->status = TRAS_TEST_FAILED;
+	else
+		result->status = TRAS_TEST_PASSED;
+
+	result->stats1 = (double)z;
+	result->stats2 = sum;
+	result->pvalue1 = pvalue;
+}
+
 int
 cusum_final(struct tras_ctx *ctx)
 {
 	struct cusum_ctx *c;
-	double pvalue, sum, sqrtn;
-	int first, last, k, n, z;
+	int n, z;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -306,35 +387,76 @@ cusum_final(struct tras_ctx *ctx)
 		c->maxs = c->sum + c->maxs;
 	}
 	z = max(abs(c->mins), abs(c->maxs));
-
 	n = (int)c->nbits;
-	sqrtn = sqrt(c->nbits);
 
-	first = (-n / z + 1) / 4;
-	last = (n / z - 1) / 4;
-	for (k = first, sum = 0.0; k <= last; k++) {
-		sum += stdnorm_cpdf((double)(4 * k + 1) * z / sqrtn);
-		sum -= stdnorm_cpdf((double)(4 * k - 1) * z / sqrtn);
+	/* The critical z depends on n, keep the last one */
+	if ((c->flags & TRAS_P_DECIDE) && c->critn != c->nbits) {
+		c->crit = cusum_crit(n, c->alpha);
+		c->critn = c->nbits;
 	}
+	cusum_result(&ctx->result, z, n, c->flags, c->alpha, c->crit);
 
-	first = (-n / z - 3) / 4;
-	last = (n / z - 1) / 4;
-	for (k = first; k <= last; k++) {
-		sum -= stdnorm_cpdf((double)(4 * k + 3) * z / sqrtn);
-		sum += stdnorm_cpdf((double)(4 * k + 1) * z / sqrtn);
-	}
-	pvalue = 1.0 - sum;
+	tras_fini_context(ctx, 0);
 
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
+	return (0);
+}
+
+/*
+ * Test k sequences of nbits forward, TRAS_BATCH_LANES at a time byte by
+ * byte. The backward mode is not supported as in the update.
+ */
+int
+cusum_batch(void *params, const void *data, unsigned int nbits,
+    unsigned int k, struct tras_result *result)
+{
+	struct cusum_params *p = params;
+	int mins[TRAS_BATCH_LANES], maxs[TRAS_BATCH_LANES];
+	int sum[TRAS_BATCH_LANES];
+	unsigned int i, j, l, nl, n;
+	const uint8_t *s;
+	size_t stride;
+	uint8_t b, m;
+	int crit;
 
-	ctx->result.stats1 = (double)z;
-	ctx->result.stats2 = sum;
-	ctx->result.pvalue1 = pvalue;
+	TRAS_CHECK_PARA(p, p->alpha);
 
-	tras_fini_context(ctx, 0);
+	if (p->mode == CUSUM_MODE_BACKWARD)
+		return (ENOSYS);
+	if (p->mode != CUSUM_MODE_FORWARD)
+		return (EINVAL);
+	if (nbits < CUSUM_MIN_BITS)
+		return (EALREADY);
+
+	/* All sequences are of nbits, one critical z for all */
+	crit = (p->flags & TRAS_P_DECIDE) ? cusum_crit(nbits, p->alpha) : 0;
+	stride = TRAS_BATCH_STRIDE(nbits);
+	n = nbits >> 3;
+
+	for (i = 0; i < k; i += nl) {
+		nl = min(k - i, TRAS_BATCH_LANES);
+		s = (const uint8_t *)data + i * stride;
+		for (l = 0; l < nl; l++)
+			mins[l] = maxs[l] = sum[l] = 0;
+		for (j = 0; j < n; j++) {
+			for (l = 0; l < nl; l++) {
+				b = s[l * stride + j];
+				mins[l] = min(mins[l], sum[l] - cusum_mintab[b]);
+				maxs[l] = max(maxs[l], sum[l] + cusum_maxtab[b]);
+				sum[l] += hamming8_norm[b];
+			}
+		}
+		for (l = 0; l < nl; l++) {
+			b = (nbits & 0x07) ? s[l * stride + n] : 0;
+			for (j = 0, m = 0x80; j < (nbits & 0x07); j++, m >>= 1) {
+				sum[l] += (b & m) ? 1 : -1;
+				mins[l] = min(mins[l], sum[l]);
+				maxs[l] = max(maxs[l], sum[l]);
+			}
+			memset(&result[i + l], 0, sizeof(result[i + l]));
+			cusum_result(&result[i + l], max(abs(mins[l]),
+			    abs(maxs[l])), (int)nbits, p->flags, p->alpha, crit);
+		}
+	}
 
 	return (0);
 }
@@ -346,18 +468,43 @@ cusum_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	return (tras_do_test(ctx, data, nbits));
 }
 
+/*
+ * Restart in place, the critical z of the last n holds for the same alpha.
+ */
 int
 cusum_restart(struct tras_ctx *ctx, void *params)
 {
+	struct cusum_params *p = params;
+	struct cusum_ctx *c;
+	unsigned int critn = 0;
+	int error, crit = 0;
 
-	return (tras_do_restart(ctx, params));
+	if (ctx == NULL || p == NULL)
+		return (EINVAL);
+
+	c = ctx->context;
+	if (ctx->state >= TRAS_STATE_INIT && c != NULL &&
+	    c->alpha == p->alpha) {
+		critn = c->critn;
+		crit = c->crit;
+	}
+
+	error = tras_do_restart(ctx, params);
+	if (error != 0)
+		return (error);
+
+	c = ctx->context;
+	c->critn = critn;
+	c->crit = crit;
+
+	return (0);
 }
 
 int
 cusum_free(struct tras_ctx *ctx)
 {
 
-	tras_do_free(ctx);
+	return (tras_do_free(ctx));
 }
 
 const struct tras_algo cusum_algo = {
@@ -371,4 +518,5 @@ const struct tras_algo cusum_algo = {
 	.final =	cusum_final,
 	.restart =	cusum_restart,
 	.free =		cusum_free,
+	.batch =	cusum_batch,
 };
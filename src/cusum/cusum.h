@@ -38,6 +38,7 @@
  */
 struct cusum_params {
 	int	mode;		/* mode of operation, forward or backward */
+	int	flags;		/* TRAS_P_* flags */
 	double	alpha;		/* significance level */
 };
 
@@ -49,4 +50,6 @@ struct cusum_params {
 
 TRAS_DECLARE_ALGO(cusum);
 
+tras_test_batch_t cusum_batch;
+
 #endif
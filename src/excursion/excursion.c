@@ -227,7 +227,7 @@ excursion_final(struct tras_ctx *ctx)
 			obs[k] = c->cycle * c->sfreq[j * 6 + k];
 		for (k = 0; k <= 5; k++)
 			exp[k] = c->cycle * excursion_prob[x][k];
-		memset(&chi2c, 0, sizeof(chi2c));
+		tras_ctx_init(&chi2c);
 		chi2p.K = 6;
 		chi2p.df = 5;
 		chi2p.exp = exp;
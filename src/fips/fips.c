@@ -0,0 +1,400 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * The FIPS 140-1 and 140-2 statistical tests fused in one pass over each
+ * block of 20000 bits. The block is read in 64-bit words and the runs of
+ * each length are counted with bit masks of the words, so there is no
+ * branch or loop for each run.
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <endian.h>
+#include <math.h>
+
+#include <tras.h>
+#include <cdefs.h>
+#include <bits.h>
+#include <frequency.h>
+#include <fips.h>
+
+/*
+ * The intervals of the statistics passing the tests. The ones and the
+ * poker statistic must be strictly inside their intervals, the numbers of
+ * runs of each length and polarity inside or on the bounds.
+ */
+struct fips_bounds {
+	unsigned int	onesmin;			/* monobit */
+	unsigned int	onesmax;
+	double		pokermin;			/* poker */
+	double		pokermax;
+	unsigned int	runmin[FIPS_RUN_CLASSES];	/* runs */
+	unsigned int	runmax[FIPS_RUN_CLASSES];
+	unsigned int	longrun;			/* failing long run */
+};
+
+static const struct fips_bounds fips_bounds[] = {
+	[FIPS_140_1 - 1] = {
+		.onesmin =	FREQUENCY_FIPS_140_1_MIN_SUM,
+		.onesmax =	FREQUENCY_FIPS_140_1_MAX_SUM,
+		.pokermin =	1.03,
+		.pokermax =	57.4,
+		.runmin =	{ 2267, 1079, 502, 223, 90, 90 },
+		.runmax =	{ 2733, 1421, 748, 402, 223, 223 },
+		.longrun =	34,
+	},
+	[FIPS_140_2 - 1] = {
+		.onesmin =	FREQUENCY_FIPS_140_2_MIN_SUM,
+		.onesmax =	FREQUENCY_FIPS_140_2_MAX_SUM,
+		.pokermin =	2.16,
+		.pokermax =	46.17,
+		.runmin =	{ 2315, 1114, 527, 240, 103, 103 },
+		.runmax =	{ 2685, 1386, 723, 384, 209, 209 },
+		.longrun =	26,
+	},
+};
+
+/*
+ * The FIPS battery context.
+ */
+struct fips_ctx {
+	const struct fips_bounds *b;	/* bounds of the version tested */
+	struct fips_report *report;	/* the report from params */
+	struct fips_report r;		/* the counts so far */
+	uint64_t	nbits;		/* number of bits updated */
+	unsigned int	fill;		/* bytes of the partial block */
+	uint8_t		buf[FIPS_BLOCK_BYTES];	/* the partial block */
+};
+
+int
+fips_init(struct tras_ctx *ctx, void *params)
+{
+	struct fips_params *p = params;
+	struct fips_ctx *c;
+	int error;
+
+	TRAS_CHECK_INIT(ctx);
+	TRAS_CHECK_PARAM(p);
+
+	if (p->version != FIPS_140_1 && p->version != FIPS_140_2)
+		return (EINVAL);
+
+	error = tras_init_context(ctx, &fips_algo, sizeof(struct fips_ctx),
+	    TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
+
+	c->b = &fips_bounds[p->version - 1];
+	c->report = p->report;
+
+	return (0);
+}
+
+/* The bit at pos of the block, the first bit is the MSB of p[0] */
+#define	FIPS_BIT(p, pos)	(((p)[(pos) >> 3] >> (7 - ((pos) & 7))) & 1)
+
+/*
+ * The block in 64-bit words, the last one partial. The words are padded
+ * with zeros to a multiple of 8, so that the loops over them have no
+ * remainder and the compiler may vectorize them.
+ */
+#define	FIPS_WORDS	((FIPS_BLOCK_BITS + 63) / 64)
+#define	FIPS_TAIL	(FIPS_BLOCK_BITS - 64 * (FIPS_WORDS - 1))
+#define	FIPS_PWORDS	((FIPS_WORDS + 7) & ~7)
+
+/*
+ * The MSB of each zero byte of x set, 0 if none. The byte before a zero
+ * byte may be set too, which costs only a look at a run.
+ */
+#define	FIPS_ZERO_BYTES(x)						\
+	(((x) - 0x0101010101010101ULL) & ~(x) & 0x8080808080808080ULL)
+
+/*
+ * The length of the run with the bit at pos of the block.
+ */
+static unsigned int
+fips_run_at(const uint8_t *p, unsigned int pos)
+{
+	unsigned int b, lo, hi;
+
+	b = FIPS_BIT(p, pos);
+	for (lo = pos; lo > 0 && FIPS_BIT(p, lo - 1) == b; lo--)
+		;
+	for (hi = pos + 1; hi < FIPS_BLOCK_BITS && FIPS_BIT(p, hi) == b; hi++)
+		;
+	return (hi - lo);
+}
+
+/*
+ * The longest run with two bytes of 0 or 0xff in a row from the word i,
+ * the pairs of bytes are taken at the MSB of each byte set in z.
+ */
+static unsigned int
+fips_long_run(const uint8_t *p, unsigned int i, uint64_t z)
+{
+	unsigned int j, maxlen;
+
+	for (maxlen = 0, j = 0; j < 8; j++) {
+		if ((z >> (63 - 8 * j)) & 1)
+			maxlen = max(maxlen, fips_run_at(p, 64 * i + 8 * j));
+	}
+	return (maxlen);
+}
+
+/*
+ * Test one block with all of the tests and count its failures.
+ *
+ * The runs are counted for both polarities at once, each length in one
+ * pass over the words. A bit of a is set where a run starts and a bit of
+ * e where the bit after it is equal, so the starts of runs of k + 1 bits
+ * or more are a and the k bits of e from each start. The runs of ones are
+ * those starting with a 1, the runs of zeros the rest.
+ *
+ * Any run of 23 bits or more takes two whole bytes in a row, so the long
+ * run is looked for only from such bytes of 0 or 0xff, which are rare.
+ */
+static void
+fips_block(struct fips_ctx *c, const uint8_t *p)
+{
+	const struct fips_bounds *b = c->b;
+	uint64_t w[FIPS_PWORDS + 1], e[FIPS_PWORDS + 1], a[FIPS_PWORDS];
+	uint16_t bytes[2][256];
+	unsigned int poker[16];
+	unsigned int ge[2][FIPS_RUN_CLASSES];
+	unsigned int ones, i, j, k, v, n, maxlen, fail;
+	uint64_t x, y, z;
+	uint64_t sq;
+	double X;
+
+	memset(bytes, 0, sizeof(bytes));
+	memset(poker, 0, sizeof(poker));
+
+	/* Two tables, so that a byte repeated does not wait for its count */
+	for (i = 0; i < FIPS_BLOCK_BYTES; i += 2) {
+		bytes[0][p[i]]++;
+		bytes[1][p[i + 1]]++;
+	}
+
+	memset(w, 0, sizeof(w));
+	for (i = 0; i < FIPS_WORDS - 1; i++) {
+		memcpy(&x, p + 8 * i, sizeof(x));
+		w[i] = be64toh(x);
+	}
+	for (j = 0, x = 0; j < FIPS_TAIL / 8; j++)
+		x |= (uint64_t)p[8 * i + j] << (56 - 8 * j);
+	w[FIPS_WORDS - 1] = x;
+
+	/* The last bit of the block has no bit after it */
+	for (i = 0; i < FIPS_PWORDS; i++)
+		e[i] = ~(w[i] ^ ((w[i] << 1) | (w[i + 1] >> 63)));
+	e[FIPS_WORDS - 1] &= ~0ULL << (65 - FIPS_TAIL);
+	e[FIPS_PWORDS] = 0;
+
+	/* The first bit of the block starts a run */
+	a[0] = w[0] ^ ((w[0] >> 1) | (~w[0] & (1ULL << 63)));
+	for (i = 1; i < FIPS_PWORDS; i++)
+		a[i] = w[i] ^ ((w[i] >> 1) | (w[i - 1] << 63));
+	a[FIPS_WORDS - 1] &= ~0ULL << (64 - FIPS_TAIL);
+
+	for (i = 0, ones = 0; i < FIPS_PWORDS; i++)
+		ones += bitcount_64(w[i]);
+
+	for (k = 0; k < FIPS_RUN_CLASSES; k++) {
+		if (k == 1) {
+			for (i = 0; i < FIPS_PWORDS; i++)
+				a[i] &= e[i];
+		} else if (k > 1) {
+			for (i = 0; i < FIPS_PWORDS; i++)
+				a[i] &= (e[i] << (k - 1)) |
+				    (e[i + 1] >> (65 - k));
+		}
+		for (i = 0, n = 0, v = 0; i < FIPS_PWORDS; i++) {
+			n += bitcount_64(a[i]);
+			v += bitcount_64(a[i] & w[i]);
+		}
+		ge[1][k] = v;
+		ge[0][k] = n - v;
+	}
+
+	/* Two bytes of 0 or 0xff in a row, not past the block */
+	for (i = 0, maxlen = 0; i < FIPS_WORDS; i++) {
+		x = w[i];
+		y = (x << 8) | (w[i + 1] >> 56);
+		z = FIPS_ZERO_BYTES(x | y) | FIPS_ZERO_BYTES(~(x & y));
+		if (i == FIPS_WORDS - 1)
+			z &= ~0ULL << (72 - FIPS_TAIL);
+		if (z != 0)
+			maxlen = max(maxlen, fips_long_run(p, i, z));
+	}
+
+	fail = 0;
+	if (ones <= b->onesmin || ones >= b->onesmax)
+		fail |= 1 << FIPS_MONOBIT;
+
+	for (i = 0; i < 256; i++) {
+		n = bytes[0][i] + bytes[1][i];
+		poker[i >> 4] += n;
+		poker[i & 0x0f] += n;
+	}
+	for (j = 0, sq = 0; j < 16; j++)
+		sq += (uint64_t)poker[j] * poker[j];
+	X = 16.0 / (FIPS_BLOCK_BITS / 4) * (double)sq - FIPS_BLOCK_BITS / 4;
+	if (X <= b->pokermin || X >= b->pokermax)
+		fail |= 1 << FIPS_POKER;
+
+	/* The runs of k bits are the runs of k or more less k + 1 or more */
+	for (v = 0; v < 2; v++) {
+		for (j = 0; j < FIPS_RUN_CLASSES; j++) {
+			n = ge[v][j];
+			if (j + 1 < FIPS_RUN_CLASSES)
+				n -= ge[v][j + 1];
+			if (n < b->runmin[j] || n > b->runmax[j])
+				fail |= 1 << FIPS_RUNS;
+		}
+	}
+
+	if (maxlen >= b->longrun)
+		fail |= 1 << FIPS_LONGRUN;
+
+	c->r.nblks++;
+	if (fail != 0)
+		c->r.nfail++;
+	for (j = 0; j < FIPS_NTESTS; j++)
+		c->r.fail[j] += (fail >> j) & 1;
+}
+
+int
+fips_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+	struct fips_ctx *c;
+	const uint8_t *p;
+	unsigned int n, k;
+
+	TRAS_CHECK_UPDATE(ctx, data, nbits);
+
+	if ((nbits & 0x07) != 0)
+		return (EINVAL);
+
+	c = ctx->context;
+	p = (const uint8_t *)data;
+	n = nbits >> 3;
+	c->nbits += nbits;
+
+	if (c->fill > 0) {
+		k = min(n, FIPS_BLOCK_BYTES - c->fill);
+		memcpy(c->buf + c->fill, p, k);
+		c->fill += k;
+		p += k;
+		n -= k;
+		if (c->fill < FIPS_BLOCK_BYTES)
+			return (0);
+		fips_block(c, c->buf);
+		c->fill = 0;
+	}
+
+	for (; n >= FIPS_BLOCK_BYTES; n -= FIPS_BLOCK_BYTES) {
+		fips_block(c, p);
+		p += FIPS_BLOCK_BYTES;
+	}
+
+	memcpy(c->buf, p, n);
+	c->fill = n;
+
+	return (0);
+}
+
+int
+fips_final(struct tras_ctx *ctx)
+{
+	struct fips_ctx *c;
+
+	TRAS_CHECK_FINAL(ctx);
+
+	c = ctx->context;
+
+	if (c->r.nblks == 0)
+		return (EALREADY);
+
+	if (c->r.nfail > 0)
+		ctx->result.status = TRAS_TEST_FAILED;
+	else
+		ctx->result.status = TRAS_TEST_PASSED;
+
+	ctx->result.discard = c->nbits - c->r.nblks * FIPS_BLOCK_BITS;
+	ctx->result.stats1 = (double)c->r.nblks;
+	ctx->result.stats2 = (double)c->r.nfail;
+	ctx->result.pvalue1 = NAN;
+	ctx->result.pvalue2 = NAN;
+
+	if (c->report != NULL)
+		*c->report = c->r;
+
+	tras_fini_context(ctx, 0);
+
+	return (0);
+}
+
+int
+fips_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+
+	return (tras_do_test(ctx, data, nbits));
+}
+
+int
+fips_restart(struct tras_ctx *ctx, void *params)
+{
+
+	return (tras_do_restart(ctx, params));
+}
+
+int
+fips_free(struct tras_ctx *ctx)
+{
+
+	return (tras_do_free(ctx));
+}
+
+const struct tras_algo fips_algo = {
+	.name =		"FIPS 140",
+	.desc =		"FIPS 140-1 and 140-2 Statistical Tests",
+	.id =		0,
+	.version =	{ 0, 1, 0 },
+	.init =		fips_init,
+	.update =	fips_update,
+	.test =		fips_test,
+	.final =	fips_final,
+	.restart =	fips_restart,
+	.free =		fips_free,
+};
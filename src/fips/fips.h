@@ -0,0 +1,74 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#ifndef __FIPS_H__
+#define	__FIPS_H__
+
+/*
+ * The statistical random number generator tests of FIPS 140-1 and 140-2:
+ * monobit, poker, runs and long run, each on every block of 20000 bits.
+ */
+#define	FIPS_140_1		1
+#define	FIPS_140_2		2
+
+#define	FIPS_BLOCK_BITS		20000	/* bits tested at once */
+#define	FIPS_BLOCK_BYTES	(FIPS_BLOCK_BITS / 8)
+#define	FIPS_RUN_CLASSES	6	/* runs of 1 to 5 and 6 or more */
+
+/* The tests of the battery, to count their failures */
+#define	FIPS_MONOBIT		0
+#define	FIPS_POKER		1
+#define	FIPS_RUNS		2
+#define	FIPS_LONGRUN		3
+#define	FIPS_NTESTS		4
+
+/*
+ * The counts of blocks tested and failed.
+ */
+struct fips_report {
+	uint64_t	nblks;			/* blocks tested */
+	uint64_t	nfail;			/* blocks failing any test */
+	uint64_t	fail[FIPS_NTESTS];	/* blocks failing each test */
+};
+
+/*
+ * The data is taken in whole bytes, the bits of a partial block are kept
+ * for the next update.
+ */
+struct fips_params {
+	int			version;	/* FIPS_140_1 or FIPS_140_2 */
+	struct fips_report *	report;		/* filled in final if any */
+};
+
+TRAS_DECLARE_ALGO(fips);
+
+#endif
@@ -31,6 +31,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -38,6 +39,7 @@
 
 #include <tras.h>
 #include <cdefs.h>
+#include <igamc.h>
 #include <utils.h>
 #include <bits.h>
 #include <hamming8.h>
@@ -54,7 +56,9 @@ struct frequency_ctx {
 	unsigned int	minbits;	/* mimimum number of bits */
 	unsigned int	maxbits;	/* maximum number of bits */
 	unsigned int	discard;	/* number of bits discarded */
+	int		flags;		/* flags from parameters */
 	double		alpha;		/* significance level if any */
+	double		crit;		/* sobs critical value for alpha */
 };
 
 #define	FREQUENCY_ID_GENERIC		0
@@ -181,20 +185,17 @@ frequency_init_algo(struct tras_ctx *ctx, void *params,
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	c = malloc(sizeof(struct frequency_ctx));
-	if (c == NULL) {
-		ctx->state = TRAS_STATE_NONE;
-		return (ENOMEM);
-	}
+	error = tras_init_context(ctx, algo, sizeof(struct frequency_ctx), 0);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
 
 	c->sum = 0;
 	c->discard = 0;
 	c->nbits = 0;
+	c->flags = p->flags;
 	c->alpha = p->alpha;
-
-	ctx->context = c;
-	ctx->algo = algo;
-	ctx->state = TRAS_STATE_INIT;
+	c->crit = sqrt(igamci(0.5, p->alpha));
 
 	return (0);
 }
@@ -219,12 +220,38 @@ frequency_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	return (0);
 }
 
+/*
+ * The result for ones bits set of nbits, shared by final and batch.
+ */
+static void
+frequency_result(struct tras_result *result, unsigned int ones,
+    unsigned int nbits, int flags, double crit)
+{
+	double pvalue, sobs;
+	int sum;
+
+	sum = (int)(2 * ones) - (int)nbits;
+	sobs = abs((double)(sum));
+	sobs = sobs / sqrt((double)nbits);
+	sobs = sobs / sqrt((double)2.0);
+	pvalue = (flags & TRAS_P_DECIDE) ? NAN : erfc(sobs);
+
+	if (sobs > crit)
+		result->status = TRAS_TEST_FAILED;
+	else
+		result->status = TRAS_TEST_PASSED;
+
+	result->discard = 0;
+	result->stats1 = sum;
+	result->stats2 = sobs;
+	result->pvalue1 = pvalue;
+	result->pvalue2 = 0;
+}
+
 int
 frequency_final(struct tras_ctx *ctx)
 {
 	struct frequency_ctx *c;
-	double pvalue, sobs;
-	int sum;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -233,24 +260,55 @@ frequency_final(struct tras_ctx *ctx)
 	if (c->nbits < FREQUENCY_MIN_BITS)
 		return (EALREADY);
 
-	sum = (int)(2 * c->sum) - (int)c->nbits;
-	sobs = abs((double)(sum));
-	sobs = sobs / sqrt((double)c->nbits);
-	sobs = sobs / sqrt((double)2.0);
-	pvalue = erfc(sobs);
+	frequency_result(&ctx->result, c->sum, c->nbits, c->flags, c->crit);
 
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
+	ctx->state = TRAS_STATE_FINAL;
+
+	return (0);
+}
 
-	ctx->result.discard = 0;
-	ctx->result.stats1 = sum;
-	ctx->result.stats2 = sobs;
-	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0;
+/*
+ * Test k sequences of nbits, TRAS_BATCH_LANES at a time word by word.
+ */
+int
+frequency_batch(void *params, const void *data, unsigned int nbits,
+    unsigned int k, struct tras_result *result)
+{
+	struct frequency_params *p = params;
+	unsigned int sum[TRAS_BATCH_LANES];
+	const uint8_t *s;
+	size_t stride;
+	unsigned int i, l, nl, w, nw;
+	uint64_t x;
+	double crit;
 
-	ctx->state = TRAS_STATE_FINAL;
+	TRAS_CHECK_PARA(p, p->alpha);
+
+	if (nbits < FREQUENCY_MIN_BITS)
+		return (EALREADY);
+
+	crit = sqrt(igamci(0.5, p->alpha));
+	stride = TRAS_BATCH_STRIDE(nbits);
+	nw = nbits / 64;
+
+	for (i = 0; i < k; i += nl) {
+		nl = min(k - i, TRAS_BATCH_LANES);
+		s = (const uint8_t *)data + i * stride;
+		for (l = 0; l < nl; l++)
+			sum[l] = 0;
+		for (w = 0; w < nw; w++) {
+			for (l = 0; l < nl; l++) {
+				memcpy(&x, s + l * stride + w * 8, sizeof(x));
+				sum[l] += bitcount_64(x);
+			}
+		}
+		for (l = 0; l < nl; l++) {
+			sum[l] += frequency_sum1((void *)(s + l * stride +
+			    nw * 8), nbits - nw * 64);
+			frequency_result(&result[i + l], sum[l], nbits,
+			    p->flags, crit);
+		}
+	}
 
 	return (0);
 }
@@ -287,6 +345,7 @@ const struct tras_algo frequency_algo = {
 	.final =	frequency_final,
 	.restart =	frequency_restart,
 	.free =		frequency_free,
+	.batch =	frequency_batch,
 };
 
 static int
@@ -300,20 +359,15 @@ frequency_fips_140_init_algo(struct tras_ctx *ctx, void *params,
 
 	TRAS_CHECK_INIT(ctx);
 
-	c = malloc(sizeof(struct frequency_ctx));
-	if (c == NULL) {
-		ctx->state = TRAS_STATE_NONE;
-		return (ENOMEM);
-	}
+	error = tras_init_context(ctx, algo, sizeof(struct frequency_ctx), 0);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
 
 	c->sum = 0;
 	c->discard = 0;
 	c->alpha = 0.0;
 	c->nbits = 0.0;
-	
-	ctx->context = c;
-	ctx->algo = algo;
-	ctx->state = TRAS_STATE_INIT;
 
 	return (0);
 }
@@ -344,9 +398,24 @@ frequency_fips_140_final(struct tras_ctx *ctx, unsigned int minsum,
 	return (0);
 }
 
+/*
+ * Only the first FREQUENCY_FIPS_MAX_BITS bits are tested, the rest are
+ * discarded.
+ */
 int
 frequency_fips_140_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
+	struct frequency_ctx *c;
+	unsigned int n;
+
+	TRAS_CHECK_UPDATE(ctx, data, nbits);
+
+	c = ctx->context;
+	n = FREQUENCY_FIPS_MAX_BITS - min(c->nbits, FREQUENCY_FIPS_MAX_BITS);
+	n = min(n, nbits);
+	c->sum += frequency_sum1(data, n);
+	c->nbits += n;
+	c->discard += nbits - n;
 
 	return (0);
 }
@@ -403,7 +472,7 @@ frequency_fips_140_2_final(struct tras_ctx *ctx)
 }
 
 const struct tras_algo frequency_fips_140_2_algo = {
-	.name =		"140-1 Monobit",
+	.name =		"140-2 Monobit",
 	.desc =		"FIPS 140-2 Frequency Test",
 	.id =		FREQUENCY_ID_FIPS_140_2,
 	.version =	{ 0, 1, 1 },
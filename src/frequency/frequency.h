@@ -39,6 +39,7 @@
 struct frequency_params {
 	unsigned int	minbits;	/* minimum number of bits */
 	unsigned int	maxbits;	/* maximum number of bits */
+	int		flags;		/* TRAS_P_* flags */
 	double		alpha;		/* significance level for H0 */
 };
 
@@ -65,6 +66,8 @@ struct frequency_params {
 
 TRAS_DECLARE_ALGO(frequency);
 
+tras_test_batch_t frequency_batch;
+
 TRAS_DECLARE_ALGO(frequency_fips_140_1);
 
 TRAS_DECLARE_ALGO(frequency_fips_140_2);
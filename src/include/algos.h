@@ -57,6 +57,13 @@
 #include <craps.h>
 #include <chi2.h>
 #include <c1tsbits.h>
+#include <c1tssbytes.h>
+#include <ntmatch.h>
+#include <otmatch.h>
+#include <operm5.h>
+#include <ovlpsum.h>
+#include <kstest.h>
+#include <fips.h>
 #include <bmatrix.h>
 #include <bmrank.h>
 #include <brank31.h>
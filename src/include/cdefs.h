@@ -37,4 +37,11 @@
 
 #define	abs(a)		(((a) < 0) ? -(a) : (a))
 
+/* Prefetch the cache line for write, only a hint for the compiler */
+#if defined(__GNUC__)
+#define	prefetchw(a)	__builtin_prefetch((a), 1)
+#else
+#define	prefetchw(a)	do { } while (0)
+#endif
+
 #endif
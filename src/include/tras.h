@@ -50,12 +50,41 @@ struct tras_result {
 #define	TRAS_TEST_PASSED	1		/* test passed */
 #define	TRAS_TEST_FAILED	0		/* test failed */
 
+/* Max number of bit offsets tested in one sweep */
+#define	TRAS_MAX_OFFSETS	32
+
+/*
+ * Test results for each bit offset of a word, for tests which can sweep
+ * over all offsets in one pass.
+ */
+struct tras_sweep {
+	unsigned int		n;		/* number of offsets tested */
+	struct tras_result	result[TRAS_MAX_OFFSETS]; /* by offset */
+};
+
 /*
- * Generic structure for test context.
+ * A pool of context memory. The contexts using it put their memory back
+ * in the pool when freed, and the next init of the same size takes it
+ * from there instead of malloc.
+ */
+#define	TRAS_POOL_SLOTS		8
+
+struct tras_pool {
+	void *			block[TRAS_POOL_SLOTS];	/* free blocks */
+	size_t			size[TRAS_POOL_SLOTS];	/* their sizes */
+};
+
+/*
+ * Generic structure for test context. It must be set up by tras_ctx_init()
+ * before the first init, the init takes back the memory the context keeps.
+ * The final keeps the context memory for a restart, so the free method
+ * must be called when the context is no longer used.
  */
 struct tras_ctx {
 	int			state;	/* state of test */
 	void *			context;/* private test context */
+	size_t			size;	/* context size, 0 if not owned */
+	struct tras_pool *	pool;	/* pool of context memory if any */
 	struct tras_result	result;	/* to keep results of test */
 	const struct tras_algo*	algo;	/* the test description */
 };
@@ -74,6 +103,17 @@ typedef int (tras_test_update_t)(struct tras_ctx *, void *, unsigned int);
 typedef int (tras_test_final_t)(struct tras_ctx *);
 typedef int (tras_test_restart_t)(struct tras_ctx *, void *);
 typedef int (tras_test_free_t)(struct tras_ctx *);
+typedef int (tras_test_batch_t)(void *, const void *, unsigned int,
+    unsigned int, struct tras_result *);
+
+/*
+ * The batch method tests k sequences of nbits bits, the sequence i from
+ * the byte i * TRAS_BATCH_STRIDE(nbits) of data, and puts its result in
+ * the i-th result. It needs no context: the counters of TRAS_BATCH_LANES
+ * sequences at a time are kept side by side on the stack.
+ */
+#define	TRAS_BATCH_LANES	8
+#define	TRAS_BATCH_STRIDE(nbits)	(((nbits) + 7) / 8)
 
 /*
  * Helper macros for tras context and tests methods.
@@ -140,6 +180,7 @@ struct tras_algo {
 	tras_test_final_t *	final;		/* finalize method */
 	tras_test_restart_t *	restart;	/* restar test method */
 	tras_test_free_t *	free;		/* free memory method */
+	tras_test_batch_t *	batch;		/* many sequences, if any */
 };
 
 #define TRAS_DEFINE_ALGO(pref, name, desc, parent, mj, mn, b)	\
@@ -167,6 +208,10 @@ tras_test_free_t pref##_free;
 
 void tras_ctx_init(struct tras_ctx *);
 void tras_ctx_free(struct tras_ctx *);
+void tras_ctx_set_pool(struct tras_ctx *, struct tras_pool *);
+
+void tras_pool_init(struct tras_pool *);
+void tras_pool_destroy(struct tras_pool *);
 
 int tras_test_init(struct tras_ctx *, const struct tras_algo *, size_t);
 int tras_test_update(struct tras_ctx *, void *, unsigned int);
@@ -178,9 +223,18 @@ int tras_test_free(struct tras_ctx *);
 int tras_do_free(struct tras_ctx *);
 int tras_do_restart(struct tras_ctx *, void *);
 int tras_do_test(struct tras_ctx *, void *, unsigned int);
+int tras_do_batch(const struct tras_algo *, void *, const void *,
+    unsigned int, unsigned int, struct tras_result *);
 
 #define	TRAS_F_ZERO	0x0001
 
+/*
+ * Flags of test params. With TRAS_P_DECIDE the final method only decides
+ * if the test passed, comparing the statistics with the critical value
+ * for alpha, and leaves the p-values as NAN.
+ */
+#define	TRAS_P_DECIDE	0x0001
+
 int tras_init_context(struct tras_ctx *, const struct tras_algo *, size_t, int);
 void tras_fini_context(struct tras_ctx *, int);
 
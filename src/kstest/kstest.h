@@ -0,0 +1,70 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#ifndef __KSTEST_H__
+#define	__KSTEST_H__
+
+/* The number of bins of the uniformity test of NIST */
+#define	KSTEST_BINS		10
+
+/* The significance level of the uniformity test of NIST */
+#define	KSTEST_ALPHA		0.0001
+
+#define	KSTEST_MIN_PVALUES	1
+#define	KSTEST_MAX_PVALUES	(1U << 28)
+
+/*
+ * Details of the result of the second-level test.
+ */
+struct kstest_report {
+	unsigned int	n;		/* number of p-values collected */
+	unsigned int	npass;		/* number of them not below alpha1 */
+	double		lo;		/* lowest proportion passing expected */
+	double		hi;		/* highest proportion passing expected */
+	unsigned int	hist[KSTEST_BINS];	/* p-values by bin */
+};
+
+struct kstest_params {
+	unsigned int		N;	/* max number of p-values to collect */
+	double			alpha1;	/* level of the tests of p-values */
+	double			alpha;	/* significance level for H0 */
+	struct kstest_report *	report;	/* filled in final, if not NULL */
+};
+
+/*
+ * P(D >= d) for the Kolmogorov-Smirnov statistic of n uniforms.
+ */
+double kstest_pvalue(double d, unsigned int n);
+
+TRAS_DECLARE_ALGO(kstest);
+
+#endif
@@ -62,7 +62,9 @@ struct longruns_ctx {
 	unsigned int	run;		/* runs length for update */
 	unsigned int	maxrun;		/* block maximum run length */
 	unsigned int	nbits;		/* number of bits processed */
+	int		flags;		/* flags from params */
 	double		alpha;		/* significance level for H0*/
+	double		crit;		/* stats critical value for alpha */
 int version;
 };
 
@@ -198,7 +200,9 @@ if (p->version != 1 && p->version != 2)
 	c->M = p->M;
 	c->N = p->N;
 	c->nbmax = p->M * p->N;
+	c->flags = p->flags;
 	c->alpha = p->alpha;
+	c->crit = 2.0 * igamci((double)cl->K / 2.0, p->alpha);
 
 c->version = p->version;
 
@@ -329,9 +333,10 @@ longruns_final(struct tras_ctx *ctx)
 		stats += (c->v[i] - npi) * (c->v[i] - npi) / npi;
 	}
 
-	pvalue = igamc((double)cl->K / 2, stats / 2);
+	pvalue = (c->flags & TRAS_P_DECIDE) ? NAN :
+	    igamc((double)cl->K / 2, stats / 2);
 
-	if (pvalue < c->alpha)
+	if (stats > c->crit)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
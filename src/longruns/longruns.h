@@ -39,6 +39,7 @@
 struct longruns_params {
 	unsigned int	M;	/* the length of each block */
 	unsigned int	N;	/* the number of blocks */
+	int		flags;	/* TRAS_P_* flags */
 	double		alpha;	/* the significance level for H0 */
 int		version;/* the update version */
 };
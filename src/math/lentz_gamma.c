@@ -50,7 +50,7 @@ lentz2_algo(double a, double x, seqfun_t afun, seqfun_t bfun, double epsilon,
 	double C, D, f, delta, af, bf, dm;
 	int n;
 
-	if (afun == NULL || bfun == NULL | epsilon == 0.0) {
+	if (afun == NULL || bfun == NULL || epsilon == 0.0) {
 		if (error != NULL)
 			*error = EDOM;
 		return (NAN);
@@ -82,7 +82,7 @@ lentz2_algo(double a, double x, seqfun_t afun, seqfun_t bfun, double epsilon,
 	} while (fabs(delta - 1.0) >= epsilon);
 
 	if (error != NULL)
-		error = 0;
+		*error = 0;
 
 	return (f);
 }
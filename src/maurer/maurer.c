@@ -61,7 +61,7 @@ maurer_init(struct tras_ctx *ctx, void *params)
 	memcpy(&p, params, sizeof(struct universal_params));
 	p.coeff = maurer_coef;
 
-	return (universal_init_algo(ctx, &p, &universal_algo));
+	return (universal_init_algo(ctx, &p, &maurer_algo));
 }
 
 int
@@ -40,9 +40,9 @@
 #include <tras.h>
 #include <cdefs.h>
 #include <const.h>
+#include <utils.h>
 #include <universal.h>
 
-		#include <stdio.h>
 /* Notes:
  * - Q shoud be selected as Q := 10 * 2 ^ L (why ?)
  */
@@ -101,6 +101,81 @@ static const struct universal_stats universal_stats[UNIVERSAL_MAX_L + 1] = {
 	{ 15.167379, 3.421 },	/* L = 16 */
 };
 
+/*
+ * Body of the block loop specialized for each supported block length L.
+ * The function is instantiated below with constant L for every length, so
+ * the compiler can fold the masks and shifts. The L-bit blocks are taken
+ * from a 64-bit register refilled byte by byte, starting at bit offset
+ * 'offs' of the data, and the number of bytes read never exceeds the bits
+ * of 'nblks' full blocks.
+ */
+#define	UNIVERSAL_BLOCKS_BODY(L) do {					\
+	const uint8_t *d = data + (offs >> 3);				\
+	uint64_t reg;							\
+	unsigned int i, iblk, Q, avail;					\
+	uint32_t block;							\
+	double stats;							\
+									\
+	reg = *d++ & lmask8[8 - (offs & 0x07)];				\
+	avail = 8 - (offs & 0x07);					\
+	iblk = c->iblk;							\
+	Q = c->Q;							\
+	stats = c->stats;						\
+									\
+	for (i = 0; i < nblks; i++) {					\
+		while (avail < (L)) {					\
+			reg = (reg << 8) | *d++;			\
+			avail += 8;					\
+		}							\
+		avail -= (L);						\
+		block = (uint32_t)(reg >> avail) & ((1U << (L)) - 1);	\
+		iblk++;							\
+		if (iblk > Q)						\
+			stats += log2(iblk - c->lblks[block]);		\
+		c->lblks[block] = iblk;					\
+	}								\
+	c->iblk = iblk;							\
+	c->stats = stats;						\
+} while (0)
+
+#define	UNIVERSAL_DEFINE_BLOCKS(L)					\
+static void								\
+universal_blocks_##L(struct universal_ctx *c, const uint8_t *data,	\
+    unsigned int offs, unsigned int nblks)				\
+{									\
+									\
+	UNIVERSAL_BLOCKS_BODY(L);					\
+}
+
+UNIVERSAL_DEFINE_BLOCKS(6)
+UNIVERSAL_DEFINE_BLOCKS(7)
+UNIVERSAL_DEFINE_BLOCKS(8)
+UNIVERSAL_DEFINE_BLOCKS(9)
+UNIVERSAL_DEFINE_BLOCKS(10)
+UNIVERSAL_DEFINE_BLOCKS(11)
+UNIVERSAL_DEFINE_BLOCKS(12)
+UNIVERSAL_DEFINE_BLOCKS(13)
+UNIVERSAL_DEFINE_BLOCKS(14)
+UNIVERSAL_DEFINE_BLOCKS(15)
+UNIVERSAL_DEFINE_BLOCKS(16)
+
+/*
+ * Block loops dispatch table, selected once by L at initialization.
+ */
+static const universal_blocks_t universal_blocks[UNIVERSAL_MAX_L + 1] = {
+	[6] =	universal_blocks_6,
+	[7] =	universal_blocks_7,
+	[8] =	universal_blocks_8,
+	[9] =	universal_blocks_9,
+	[10] =	universal_blocks_10,
+	[11] =	universal_blocks_11,
+	[12] =	universal_blocks_12,
+	[13] =	universal_blocks_13,
+	[14] =	universal_blocks_14,
+	[15] =	universal_blocks_15,
+	[16] =	universal_blocks_16,
+};
+
 int
 universal_init_algo(struct tras_ctx *ctx, void *params,
     const struct tras_algo *algo)
@@ -120,7 +195,7 @@ universal_init_algo(struct tras_ctx *ctx, void *params,
 	if (p->coeff == NULL)
 		return (EINVAL);
 
-	size = (1 << p->L) * sizeof(unsigned int);
+	size = sizeof(struct universal_ctx) + (1 << p->L) * sizeof(unsigned int);
 
 	error = tras_init_context(ctx, algo, size, TRAS_F_ZERO);
 	if (error != 0)
@@ -132,6 +207,7 @@ universal_init_algo(struct tras_ctx *ctx, void *params,
 	c->L = p->L;
 	c->Q = 10 * (1UL << p->L);
 	c->coeff = p->coeff;
+	c->blocks = universal_blocks[p->L];
 	c->alpha = p->alpha;
 
 	return (0);
@@ -189,7 +265,7 @@ universal_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct universal_ctx *c;
 	uint32_t block;
-	unsigned int i, n, b, r;
+	unsigned int n, b, r;
 	uint8_t *p;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
@@ -225,12 +301,9 @@ universal_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	 * Iterate over m buff blocks.
 	 */
 	b = (nbits - n) / c->L;
-	for (i = 0; i < b; i++, n += c->L) {
-		block = universal_get_sequence_1(data, n, c->L);
-		c->iblk++;
-		if (c->iblk > c->Q)
-			c->stats += log2(c->iblk - c->lblks[block]);
-		c->lblks[block] = c->iblk;
+	if (b > 0) {
+		c->blocks(c, p, n, b);
+		n += b * c->L;
 	}
 
 	/*
@@ -299,18 +372,15 @@ universal_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
 int
 universal_restart(struct tras_ctx *ctx, void *params)
 {
-	struct universal_ctx *c;
-	struct universal_params pm;
 
 	if (ctx == NULL || params == NULL)
 		return (EINVAL);
 
-	c = ctx->context;
-
-	memcpy(&pm, params, sizeof(pm));
-	pm.coeff = c->coeff;
-
-	return (tras_do_restart(ctx, &pm));
+	/*
+	 * The context is released by final, so the coefficient function
+	 * is set again by the init method of the particular algorithm.
+	 */
+	return (tras_do_restart(ctx, params));
 }
 
 int
@@ -36,6 +36,8 @@
 struct universal_ctx;
 
 typedef	double (*coef_fun_t)(struct universal_ctx *);
+typedef	void (*universal_blocks_t)(struct universal_ctx *, const uint8_t *,
+    unsigned int, unsigned int);
 
 /*
  * The private context for Universal Statistical Test (Maurer, Coron).
@@ -49,6 +51,7 @@ struct universal_ctx {
 	unsigned int *	lblks;		/* last occurence of L-blocks */
 	double		stats;		/* statistic sum of log distance */
 	coef_fun_t	coeff;		/* coeficient calculation function */
+	universal_blocks_t blocks;	/* block loop specialized for L */
 	unsigned int	nbits;		/* number of bits processed */
 	double		alpha;		/* significance level */
 };
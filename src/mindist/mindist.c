@@ -43,178 +43,184 @@
 #include <cdefs.h>
 #include <utils.h>
 #include <bits.h>
+#include <uniform.h>
 #include <mindist.h>
 
 #include <stdio.h>
 
 /*
- * Vector respresenting point in 2D space.
- */
-struct point {
-	double	x;		/* x component */
-	double	y;		/* y component */
-};
-
-/*
- * The minimum distance test context.
+ * The minimum distance test context. Points are kept as a structure of
+ * arrays, x and y components in separate tables.
  */
 struct mindist_ctx {
 	unsigned int	nbits;	/* number of bits processed */
-	struct point *	points;	/* list of points collected */
+	double *	x;	/* x components of points collected */
+	double *	y;	/* y components of points collected */
+	double *	gx;	/* x components ordered by grid cell */
+	double *	gy;	/* y components ordered by grid cell */
+	double *	coords;	/* coordinates as updated, in gx and gy */
+	unsigned int *	cell;	/* grid cell boundaries in gx/gy */
 	unsigned int	npoint;	/* number of points collected */
 	unsigned int	K;	/* number of points to get */
 	double		alpha;	/* significance level for H0 */
 };
 
 /*
- * Swap two points in the table of points.
+ * Get the grid column or row of the point component for the grid
+ * of g x g cells.
  */
-inline static void
-swap_points(struct point *table, int a, int b)
+inline static unsigned int
+mindist_grid_index(double v, double scale, unsigned int g)
 {
-	double x, y;
-
-	x = table[a].x;
-	y = table[a].y;
-	table[a].x = table[b].x;
-	table[a].y = table[b].y;
-	table[b].x = x;
-	table[b].y = y;
+	unsigned int i;
+
+	i = (unsigned int)(v * scale);
+	return (min(i, g - 1));
 }
 
 /*
- * Sort the collected list of points in ascending order with x-axis.
+ * Distribute the points into the grid of g x g cells with a counting sort.
+ * After the call, points of the cell k are gx/gy[cell[k] .. cell[k+1]).
  */
 static void
-quicksort_int(struct point *table, int l, int r)
+mindist_grid_build(struct mindist_ctx *c, unsigned int g)
 {
-	unsigned int p, a;
-	unsigned int i, j;
-	double v;
-
-	if (l >= r || l < 0)
-		return;
+	unsigned int *cell;
+	unsigned int i, k, n;
+	double scale;
 
-	/*
-	 * Use simple "in the middle" for pivot point.
-	 */
-	p = l + (r - l) / 2;
-	v = table[p].x;
+	cell = c->cell;
+	n = g * g;
+	scale = g / MINDIST_SIDE;
 
-	/*
-	 * Swap pivot value with last element.
-	 */
-	swap_points(table, p, r);
-
-	for (a = l, i = l; i < r; i++) {
-		if (table[i].x < v) {
-			swap_points(table, i, a);
-			a++;
-		}
+	for (k = 0; k < n + 2; k++)
+		cell[k] = 0;
+	for (i = 0; i < c->K; i++) {
+		k = mindist_grid_index(c->y[i], scale, g) * g +
+		    mindist_grid_index(c->x[i], scale, g);
+		cell[k + 2]++;
+	}
+	for (k = 2; k < n + 2; k++)
+		cell[k] += cell[k - 1];
+	for (i = 0; i < c->K; i++) {
+		k = mindist_grid_index(c->y[i], scale, g) * g +
+		    mindist_grid_index(c->x[i], scale, g);
+		k = cell[k + 1]++;
+		c->gx[k] = c->x[i];
+		c->gy[k] = c->y[i];
 	}
-	swap_points(table, a, r);
-
-	quicksort_int(table, l, a - 1);
-	quicksort_int(table, a + 1, r);
-}
-
-/*
- * Quick sort a list of points.
- */
-inline static void
-quicksort(struct point *table, int n)
-{
-
-	quicksort_int(table, 0, n - 1);
-}
-
-/*
- * Quick sort the collected list of points for minimimum distance algorithm.
- */
-inline static void
-quicksort_points(struct mindist_ctx *c)
-{
-
-	quicksort(c->points, c->K);
 }
 
 /*
- * The function returns the Euclidean distance between two points
- * raised to the power of 2.
+ * Get the minimum squared distance between points of the same cell
+ * [a0, a1) and d2min.
  */
 static double
-mindist_distance_euclidean_pow2(struct point *p1, struct point *p2)
+mindist_cell_self(const double *x, const double *y, unsigned int a0,
+    unsigned int a1, double d2min)
 {
-	double dx, dy;
-
-	dx = (p2->x - p1->x);
-	dy = (p2->y - p1->y);
-
-	return (dx * dx + dy * dy);
+	unsigned int i, j;
+	double dx, dy, d2;
+
+	for (i = a0; i < a1; i++) {
+		for (j = i + 1; j < a1; j++) {
+			dx = x[j] - x[i];
+			dy = y[j] - y[i];
+			d2 = dx * dx + dy * dy;
+			d2min = d2 < d2min ? d2 : d2min;
+		}
+	}
+	return (d2min);
 }
 
 /*
- * Convert 32-bit unsigned int value to the double in the range <0.0, 1.0)
+ * Get the minimum squared distance between points of two different
+ * cells [a0, a1) and [b0, b1) and d2min.
  */
-inline static double
-mindist_uint_to_floatU01(uint32_t u32)
+static double
+mindist_cell_pair(const double *x, const double *y, unsigned int a0,
+    unsigned int a1, unsigned int b0, unsigned int b1, double d2min)
 {
-
-	/* XXX: this is wrong function that need to be corrected
-	 * because since u32 is uniformly distributed the
-	 * return value is not.
-	 */
-	return ((double)u32 / pow(2.0, 32));
+	unsigned int i, j;
+	double dx, dy, d2;
+
+	for (i = a0; i < a1; i++) {
+		for (j = b0; j < b1; j++) {
+			dx = x[j] - x[i];
+			dy = y[j] - y[i];
+			d2 = dx * dx + dy * dy;
+			d2min = d2 < d2min ? d2 : d2min;
+		}
+	}
+	return (d2min);
 }
 
 /*
- * Normalize the single point component to <0, 1000> range.
+ * Find the minimum squared distance between the points distributed in
+ * the grid of g x g cells. Each cell is compared with itself and with
+ * the four neighbours following it, so every pair of adjacent cells is
+ * checked once. The result is exact if it is not greater than the
+ * squared cell width; otherwise it is only an upper bound.
  */
-inline static double
-mindist_point_component(uint32_t u32)
-{
-
-	return ((mindist_uint_to_floatU01(u32) * 10000.0));
-}
-
 static double
-mindist_min_distance_pow2(struct point *points, unsigned int n)
+mindist_grid_search(struct mindist_ctx *c, unsigned int g)
 {
-	struct point *p1, *p2;
-	unsigned int i, j;
-	double d2min, d2;
+	const unsigned int *cell;
+	unsigned int cx, cy, k, a0, a1;
+	double d2min;
 
-	d2min = mindist_distance_euclidean_pow2(points, points + 1);
+	cell = c->cell;
+	d2min = DBL_MAX;
 
-	for (i = 0, p1 = points; i < n - 1; i++, p1++) {
-		for (j = i + 1, p2 = p1 + 1; j < n; j++, p2++) {
-			d2 = mindist_distance_euclidean_pow2(p1, p2);
-			if (d2 < d2min)
-				d2min = d2;
+	for (cy = 0; cy < g; cy++) {
+		for (cx = 0; cx < g; cx++) {
+			k = cy * g + cx;
+			a0 = cell[k];
+			a1 = cell[k + 1];
+			if (a0 == a1)
+				continue;
+			d2min = mindist_cell_self(c->gx, c->gy, a0, a1, d2min);
+			if (cx + 1 < g) {
+				d2min = mindist_cell_pair(c->gx, c->gy, a0, a1,
+				    cell[k + 1], cell[k + 2], d2min);
+			}
+			if (cy + 1 == g)
+				continue;
+			k += g;
+			d2min = mindist_cell_pair(c->gx, c->gy, a0, a1,
+			    cell[cx > 0 ? k - 1 : k], cell[cx + 1 < g ? k + 2 :
+			    k + 1], d2min);
 		}
 	}
 	return (d2min);
 }
 
+/*
+ * The function returns the minimum Euclidean distance between
+ * the collected points raised to the power of 2. The grid starts with
+ * about one point per cell, which gives expected linear time. If the
+ * minimum found is larger than the cell width, the grid is rebuilt with
+ * cells wide enough to contain it and the search is repeated.
+ */
 static double
-mindist_min_distance_pow2_sorted(struct point *points, unsigned int n)
+mindist_min_distance_pow2(struct mindist_ctx *c)
 {
-	struct point *p1, *p2;
-	unsigned int i, j;
-	double d2min, d2;
-
-	quicksort(points, n);
-
-	d2min = DBL_MAX;
-
-	for (i = 0, p1 = points; i < n - 1; i++, p1++) {
-		for (j = i + 1, p2 = p1 + 1; j < n; j++, p2++) {
-			if (abs(p1->x - p2->x) >= sqrt(d2min))
-				break;
-			d2 = mindist_distance_euclidean_pow2(p1, p2);
-			if (d2 < d2min)
-				d2min = d2;
-		}
+	unsigned int g;
+	double d2min, w;
+
+	g = (unsigned int)sqrt((double)c->K);
+	for (;;) {
+		mindist_grid_build(c, g);
+		d2min = mindist_grid_search(c, g);
+		w = MINDIST_SIDE / g;
+		if (g == 1 || d2min <= w * w)
+			break;
+		if (d2min == DBL_MAX)
+			g = (g + 1) / 2;
+		else
+			g = min(g - 1, (unsigned int)(MINDIST_SIDE /
+			    sqrt(d2min)));
+		g = max(g, 1);
 	}
 	return (d2min);
 }
@@ -233,14 +239,20 @@ mindist_init(struct tras_ctx *ctx, void *params)
 	if (p->K < MINDIST_MIN_POINTS || p->K > MINDIST_MAX_POINTS)
 		return (EINVAL);
 
-	size = sizeof(struct mindist_ctx) + p->K * sizeof(struct point);
+	size = sizeof(struct mindist_ctx) + 4 * p->K * sizeof(double) +
+	    (p->K + 2) * sizeof(unsigned int);
 
 	error = tras_init_context(ctx, &mindist_algo, size, TRAS_F_ZERO);
 	if (error != 0)
 		return (error);
 
 	c = ctx->context;
-	c->points = (struct point *)(c + 1);
+	c->x = (double *)(c + 1);
+	c->y = c->x + p->K;
+	c->gx = c->y + p->K;
+	c->gy = c->gx + p->K;
+	c->coords = c->gx;
+	c->cell = (unsigned int *)(c->gy + p->K);
 
 	c->K = p->K;
 	c->alpha = p->alpha;
@@ -253,8 +265,6 @@ mindist_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct mindist_ctx *c;
 	unsigned int n, b;
-	struct point *p;
-	uint32_t *d;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -264,29 +274,19 @@ mindist_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 		return (EINVAL);
 
 	c = ctx->context;
-	d = (uint32_t *)data;	/* endianism ??? */
-	p = c->points + c->npoint;
 
 	/*
-	 * Get number of coordinates to update.
+	 * Get number of coordinates to update. The coordinates are
+	 * converted in stream order, x and y of each point in turn, to
+	 * the space of gx and gy, which is not used until final.
 	 */
 	b = c->nbits / 32;
 	b = min(b, 2 * c->K);
 	n = 2 * c->K - b;
 	n = min(n, nbits / 32);
 
-	while (n > 0) {
-		if (b & 0x01) {
-			p->y = mindist_point_component(*d);
-			c->npoint++;
-			p++;
-		} else {
-			p->x = mindist_point_component(*d);
-		}
-		b++;
-		d++;
-		n--;
-	}
+	uniform_be32_to_double(c->coords + b, data, n, MINDIST_SIDE);
+	c->npoint = (b + n) / 2;
 	c->nbits += nbits;
 
 	return (0);
@@ -300,21 +300,8 @@ mindist_show_points(struct mindist_ctx *c)
 
 	for (i = 0; i < c->K; i++) {
 		printf("point %d : <%.16f, %.16f>\n", i,
-		    c->points[i].x, c->points[i].y);
-	}
-}
-
-static int
-mindst_quicksort_verify(struct mindist_ctx *c)
-{
-	unsigned int i;
-
-
-	for (i = 0; i < c->K - 1; i++) {
-		if (c->points[i].x > c->points[i + 1].x)
-			return (EINVAL);
+		    c->x[i], c->y[i]);
 	}
-	return (0);
 }
 #endif
 
@@ -323,7 +310,7 @@ mindist_final(struct tras_ctx *ctx)
 {
 	struct mindist_ctx *c;
 	double pvalue, d2min, mean;
-	int sum;
+	unsigned int i;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -332,8 +319,19 @@ mindist_final(struct tras_ctx *ctx)
 	if (c->npoint < c->K)
 		return (EALREADY);
 
-	d2min = mindist_min_distance_pow2_sorted(c->points, c->K);
-	mean = 0.995;
+	for (i = 0; i < c->K; i++) {
+		c->x[i] = c->coords[2 * i];
+		c->y[i] = c->coords[2 * i + 1];
+	}
+
+	/*
+	 * The number of pairs closer than d is close to Poisson with
+	 * mean K(K-1)/2 * pi d^2 / A, so d^2 is exponential with the mean
+	 * 2A / (pi K(K-1)); 0.995 for Diehard 8000 points.
+	 */
+	d2min = mindist_min_distance_pow2(c);
+	mean = 2.0 * MINDIST_SIDE * MINDIST_SIDE /
+	    (M_PI * c->K * (c->K - 1.0));
 	pvalue = 1.0 - exp(-d2min / mean);
 
 	if (pvalue < c->alpha)
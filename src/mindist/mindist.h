@@ -39,7 +39,12 @@ struct mindist_params {
 };
 
 #define	MINDIST_MIN_POINTS	8000
-#define	MINDIST_MAX_POINTS	8000
+#define	MINDIST_MAX_POINTS	(1 << 24)
+
+/*
+ * Side of the square the points are placed in.
+ */
+#define	MINDIST_SIDE		10000.0
 
 TRAS_DECLARE_ALGO(mindist);
 
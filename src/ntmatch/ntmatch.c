@@ -30,65 +30,128 @@
  *
  */
 
+
 /*
  * Implementation of the Non-overlapping Template Matching Test.
  */
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <stddef.h>
+#include <endian.h>
+#include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
+#include <igamc.h>
 #include <ntmatch.h>
 
-	#include <stdio.h>
 /*
- * Private context for the test.
+ * Private context for the test. All templates share one sliding window,
+ * the window value maps to the template number, 0 if it is no template.
+ * The slot 0 of the tables is a sink for the windows without template.
  */
 struct ntmatch_ctx {
-	unsigned int *	w;	/* templates frequency table */
+	unsigned int *	w;	/* templates frequency table, by block */
+	unsigned int *	last;	/* position of the last match, by template */
+	uint16_t *	map;	/* window value to template number */
+	uint32_t *	B;	/* the m-bits templates to be matched */
+	unsigned int	ntmpl;	/* the number of templates */
 	unsigned int	m;	/* the length of each template */
 	unsigned int	M;	/* the length of each substring */
 	unsigned int 	N;	/* the number of independent blocks */
-	uint32_t	B;	/* the m-bits template to be matched */
 	unsigned int 	nbmax;	/* max number of bits to be tested */
-	unsigned int	wbits;	/* the number of valid bits in the word */
-	uint32_t	word;	/* word saved from last update */
+	unsigned int	b;	/* the current block */
+	unsigned int	bend;	/* position of the end of the block */
+	unsigned int	pos;	/* position of the next bit */
+	uint32_t	word;	/* the window, last m bits */
 	unsigned int	nbits;	/* number of bits updated */
+	struct ntmatch_report *report; /* results by template, if any */
 	double		alpha;	/* the significance level for H0 */
 };
 
+/*
+ * A template is aperiodic if none of its proper prefixes is its suffix,
+ * then two matches of the template can never overlap.
+ */
 static int
-ntmatch_check_template(uint32_t B)
+ntmatch_check_template(uint32_t B, unsigned int m)
 {
+	unsigned int d;
 
-	/*
-	 * TODO: implementation.
-	 */
+	if (B >> m)
+		return (0);
+	for (d = 1; d < m; d++)
+		if ((B >> d) == (B & ((1U << (m - d)) - 1)))
+			return (0);
 
 	return (1);
 }
 
+/*
+ * Get all aperiodic templates of m bits in increasing order, returns the
+ * number of templates.
+ */
+static unsigned int
+ntmatch_templates(uint32_t *B, unsigned int m)
+{
+	uint32_t t;
+	unsigned int n;
+
+	for (t = 0, n = 0; t < (1U << m); t++)
+		if (ntmatch_check_template(t, m))
+			B[n++] = t;
+
+	return (n);
+}
+
+/*
+ * Start a new block, no template is matched before m bits of the block.
+ */
+static void
+ntmatch_block(struct ntmatch_ctx *c)
+{
+	unsigned int t;
+
+	for (t = 0; t <= c->ntmpl; t++)
+		c->last[t] = c->pos - 1;
+}
+
 int
 ntmatch_init(struct tras_ctx *ctx, void *params)
 {
 	struct ntmatch_params *p = params;
 	struct ntmatch_ctx *c;
-	int size, error;
+	uint32_t B[NTMATCH_MAX_TEMPLATES];
+	unsigned int ntmpl, t;
+	size_t size;
+	int error;
 
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
 	if (p->m < NTMATCH_MIN_M || p->m > NTMATCH_MAX_M)
 		return (EINVAL);
-	if (p->M < NTMATCH_MIN_SUBS_LEN || p->N < NTMATCH_MIN_N)
+	if (p->M < NTMATCH_MIN_SUBS_LEN || p->N < NTMATCH_MIN_N ||
+	    p->N > NTMATCH_MAX_N)
 	       return (EINVAL);
-	if (!ntmatch_check_template(p->B))
+	if (p->M < p->m)
 		return (EINVAL);
 
-	size = sizeof(struct ntmatch_ctx) + p->N * sizeof(unsigned int);
+	if (p->all) {
+		ntmpl = ntmatch_templates(B, p->m);
+	} else {
+		if (!ntmatch_check_template(p->B, p->m))
+			return (EINVAL);
+		B[0] = p->B;
+		ntmpl = 1;
+	}
+
+	size = sizeof(struct ntmatch_ctx) +
+	    (p->N + 1) * (ntmpl + 1) * sizeof(unsigned int) +
+	    ntmpl * sizeof(uint32_t) + (1U << p->m) * sizeof(uint16_t);
 
 	error = tras_init_context(ctx, &ntmatch_algo, size, TRAS_F_ZERO);
 	if (error != 0)
@@ -96,25 +159,75 @@ ntmatch_init(struct tras_ctx *ctx, void *params)
 
 	c = ctx->context;
 	c->w = (unsigned int *)(c + 1);
+	c->last = c->w + p->N * (ntmpl + 1);
+	c->B = (uint32_t *)(c->last + ntmpl + 1);
+	c->map = (uint16_t *)(c->B + ntmpl);
 
+	memcpy(c->B, B, ntmpl * sizeof(uint32_t));
+	for (t = 0; t < ntmpl; t++)
+		c->map[B[t]] = t + 1;
+
+	c->ntmpl = ntmpl;
 	c->m = p->m;
 	c->M = p->M;
 	c->N = p->N;
-	c->B = p->B;
 	c->nbmax = c->N * c->M;
+	c->bend = c->M;
+	c->report = p->report;
 	c->alpha = p->alpha;
 
+	ntmatch_block(c);
+
 	return (0);
 }
 
+/*
+ * Match k bits of x, from the msb. A window counts for its template only
+ * m bits after the last match, in all templates at once.
+ */
+static void
+ntmatch_scan(struct ntmatch_ctx *c, uint64_t x, unsigned int k)
+{
+	unsigned int *w, *last, pos, t, i, l, ok, m;
+	uint32_t word, mask;
+	const uint16_t *map;
+
+	last = c->last;
+	map = c->map;
+	m = c->m;
+	mask = (1U << m) - 1;
+	pos = c->pos;
+	word = c->word;
+
+	while (k > 0) {
+		if (pos == c->bend) {
+			c->b++;
+			c->bend += c->M;
+			c->pos = pos;
+			ntmatch_block(c);
+		}
+		w = c->w + c->b * (c->ntmpl + 1);
+		l = min(k, c->bend - pos);
+		for (i = 0; i < l; i++, pos++, x <<= 1) {
+			word = ((word << 1) | (uint32_t)(x >> 63)) & mask;
+			t = map[word];
+			ok = (pos - last[t] >= m);
+			w[t] += ok;
+			last[t] = ok ? pos : last[t];
+		}
+		k -= l;
+	}
+	c->pos = pos;
+	c->word = word;
+}
+
 int
 ntmatch_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct ntmatch_ctx *c;
-	uint8_t *p, bm;
-	unsigned int n, o, i, m, k;
-	unsigned int b, wbits;
-	uint32_t mask, word;
+	uint8_t *p;
+	unsigned int n, i, j, k;
+	uint64_t x;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -122,53 +235,20 @@ ntmatch_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	p = (uint8_t *)data;
 
 	/* the number of bits to update */
-	n = min(c->nbits, c->nbmax);
-	n = min(c->nbmax - n, nbits);
-
-	/* the block number and the offset in the block */
-	b = c->nbits / c->M;
-	o = c->nbits % c->M;
-
-	/* the number of valid bits in the saved word */
-	wbits = c->wbits;
-
-	/* the mask for template and the word from previous update */
-	word = (o != 0) ? c->word : 0;
-	mask = (1 << c->m) - 1;
-
-	while (n > 0) {
-		k = c->M - o;
-		k = min(k, n);
-		for (i = 0, bm = 0x80; i < k; i++) {
-			word = ((word << 1) | ((*p & bm) ? 1:0)) & mask;
-			if (wbits >= c->m) {
-				/* the next full m-bits word with one new bit */
-				if (c->B == word) {
-					c->w[b]++;
-					word = 0;
-					wbits = 0;
-				}
-			} else {
-				/* still constructing m-bits word */
-				wbits++;
-			}
-			bm = bm >> 1;
-			if (bm == 0x00) {
-				bm = 0x80;
-				p++;
-			}
+	n = min(c->nbmax - c->pos, nbits);
+
+	/* the bits are taken in 64-bit words */
+	for (i = 0; i < n; i += k, p += 8) {
+		k = min(n - i, 64);
+		if (k == 64) {
+			memcpy(&x, p, sizeof(x));
+			x = be64toh(x);
+		} else {
+			for (j = 0, x = 0; j < 8; j++)
+				x = (x << 8) | ((j < (k + 7) / 8) ? p[j] : 0);
 		}
-		o = o + k;
-		if (o == c->M) {
-			o = 0;
-			wbits = 0;
-			word = 0;
-			b++;
-		}
-		n = n - k;
+		ntmatch_scan(c, x, k);
 	}
-	c->word = word;
-	c->wbits = wbits;
 
 	c->nbits += nbits;
 
@@ -179,9 +259,11 @@ int
 ntmatch_final(struct tras_ctx *ctx)
 {
 	struct ntmatch_ctx *c;
-	double mean, var;
-	double chi2, pvalue;
-	unsigned int i, k;
+	struct tras_result *r;
+	double a[NTMATCH_MAX_TEMPLATES], x[NTMATCH_MAX_TEMPLATES];
+	double pvalue[NTMATCH_MAX_TEMPLATES];
+	double mean, var, d, chi2, pmin, chi2min, pp;
+	unsigned int b, t, nfail;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -190,40 +272,67 @@ ntmatch_final(struct tras_ctx *ctx)
 	if (c->nbits < c->nbmax)
 		return (EALREADY);
 
-#if 0
-	printf("frequency table for ntmatch algorithm:\n");
-	for (i = 0; i < c->N; i++) {
-		printf("w[%d] = %u\n", i, c->w[i]);
+	mean = ((double)c->M - (double)c->m + 1.0) / ldexp(1.0, c->m);
+	var = (double)c->M * (1.0 / ldexp(1.0, c->m) -
+	    (2.0 * c->m - 1.0) / ldexp(1.0, 2 * c->m));
+
+	/* Get the p-values of all templates at once */
+	for (t = 1; t <= c->ntmpl; t++) {
+		for (chi2 = 0.0, b = 0; b < c->N; b++) {
+			d = (double)c->w[b * (c->ntmpl + 1) + t] - mean;
+			chi2 += d * d;
+		}
+		a[t - 1] = (double)c->N / 2.0;
+		x[t - 1] = chi2 / var / 2.0;
+	}
+	igamc_batch(pvalue, a, x, c->ntmpl);
+
+	pmin = 1.0;
+	chi2min = 0.0;
+	for (t = 0, nfail = 0; t < c->ntmpl; t++) {
+		if (pvalue[t] < c->alpha)
+			nfail++;
+		if (pvalue[t] <= pmin) {
+			pmin = pvalue[t];
+			chi2min = 2.0 * x[t];
+		}
+	}
+
+	if (c->report != NULL) {
+		c->report->n = c->ntmpl;
+		for (t = 0; t < c->ntmpl; t++) {
+			r = &c->report->result[t];
+			memset(r, 0, sizeof(*r));
+			r->status = (pvalue[t] < c->alpha) ?
+			    TRAS_TEST_FAILED : TRAS_TEST_PASSED;
+			r->stats1 = 2.0 * x[t];
+			r->pvalue1 = pvalue[t];
+			c->report->B[t] = c->B[t];
+		}
 	}
-	printf("\n");
-#endif
-
-	mean = (double)c->M - (double)c->m + 1.0;
-	var = (double)c->M;
-	i = c->m;
-	while (i > 0) {
-		k = min(i, 16);
-		mean = mean / (double)(1UL << k);
-		i = i - k;
+
+	/*
+	 * With all templates the test fails if the proportion of passed
+	 * templates is out of the range expected for the significance level.
+	 */
+	if (c->ntmpl > 1) {
+		pp = 1.0 - c->alpha - 3.0 * sqrt(c->alpha * (1.0 - c->alpha) /
+		    (double)c->ntmpl);
+		if ((double)(c->ntmpl - nfail) / (double)c->ntmpl < pp)
+			ctx->result.status = TRAS_TEST_FAILED;
+		else
+			ctx->result.status = TRAS_TEST_PASSED;
+	} else {
+		if (nfail > 0)
+			ctx->result.status = TRAS_TEST_FAILED;
+		else
+			ctx->result.status = TRAS_TEST_PASSED;
 	}
 
-	for (chi2 = 0.0, i = 0; i < c->N; i++)
-		chi2 += ((double)c->w[i] - mean) * ((double)c->w[i] - mean);
-	chi2 = chi2 / var;
-
-#ifdef __not_yet__
-	pvalue = igamc((double)c->N / 2.0, chi2 / 2.0);
-#else
-	pvalue = 0.0;
-#endif
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
-
-	ctx->result.discard = c->nbits % c->M;
-	ctx->result.stats1 = chi2;	/* XXX: temp */
-	ctx->result.pvalue1 = pvalue;
+	ctx->result.discard = c->nbits - c->nbmax;
+	ctx->result.stats1 = chi2min;
+	ctx->result.stats2 = (double)nfail;
+	ctx->result.pvalue1 = (c->ntmpl > 1) ? NAN : pmin;
 
 	tras_fini_context(ctx, 0);
 
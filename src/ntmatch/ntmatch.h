@@ -33,6 +33,29 @@
 #ifndef __TRAS_NT_MATCH_H__
 #define	__TRAS_NT_MATCH_H__
 
+#define	NTMATCH_MIN_M		2	/* the minimum length of template */
+#define	NTMATCH_MAX_M		10	/* the maximum length of template */
+
+#define	NTMATCH_MIN_N		1	/* minimum number of substrings */
+#define	NTMATCH_MAX_N		100	/* maximum number of substrings */
+
+#define	NTMATCH_MIN_SUBS_LEN	100	/* the minimum length of substrings */
+#define	NTMATCH_MAX_SUBS_LEN	0	/* the maximum length of substrings */
+
+/* The number of aperiodic templates of NTMATCH_MAX_M bits */
+#define	NTMATCH_MAX_TEMPLATES	284
+
+/*
+ * The results of each template, filled by the final if given in params.
+ * With all templates the minimum p-value is no p-value, so the pvalue1 of
+ * the test is NAN and the p-values are only here.
+ */
+struct ntmatch_report {
+	unsigned int		n;	/* number of templates */
+	uint32_t		B[NTMATCH_MAX_TEMPLATES]; /* the templates */
+	struct tras_result	result[NTMATCH_MAX_TEMPLATES]; /* by template */
+};
+
 /*
  * Non-overlapping Template Matching Test definitions params.
  */
@@ -41,18 +64,11 @@ struct ntmatch_params {
 	unsigned int	M;	/* length of subsequence to be tested */
 	unsigned int	N;	/* number of independent blocks */
 	uint32_t	B;	/* the m-bits template to be matched */
+	unsigned int	all;	/* if set, match all aperiodic templates */
+	struct ntmatch_report *report; /* if set, results by template */
 	double		alpha;	/* the significance level for H0 */
 };
 
-#define	NTMATCH_MIN_M		2	/* the minimum length of template */
-#define	NTMATCH_MAX_M		10	/* the maximum length of template */
-
-#define	NTMATCH_MIN_N		100	/* minimum number of substrings */
-#define	NTMATCH_MAX_N		0	/* maximum number of substrings */
-
-#define	NTMATCH_MIN_SUBS_LEN	100	/* the minimum length of substrings */
-#define	NTMATCH_MAX_SUBS_LEN	0	/* the maximum length of substrings */
-
 TRAS_DECLARE_ALGO(ntmatch);
 
 #endif
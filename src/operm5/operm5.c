@@ -28,103 +28,227 @@
  * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
  * SUCH DAMAGE.
  *
- * The Minimum Distance Test.
+ * The Overlapping 5-Permutation Test.
  */
 
 #include <stdint.h>
 #include <errno.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
-#include <hamming8.h>
-#include <utils.h>
-#include <bits.h>
+#include <cdefs.h>
+#include <igamc.h>
 #include <operm5.h>
+#include <operm5_pinv.h>
 
 /*
- * The minimum distance test context.
+ * Each word keeps 4 bits of comparisons with the 4 words before it, bit j
+ * is set if the word is less than the word j + 1 places before. The last
+ * four of them are kept in a 16-bit history, the newest in the low bits.
+ * The comparisons inside the 5-tuple are selected by the mask below and
+ * give the permutation through the lookup table.
+ */
+#define	OPERM5_KEY_MASK		0x137f
+#define	OPERM5_KEYS		(OPERM5_KEY_MASK + 1)
+
+/*
+ * The overlapping 5-permutation test context.
  */
 struct operm5_ctx {
 	unsigned int	nbits;	/* number of bits processed */
+	unsigned int	nword;	/* number of words used */
+	unsigned int	K;	/* number of words in a sample */
+	uint32_t	w[4];	/* last four words, the newest first */
+	uint32_t	h;	/* comparisons of the last four words */
+	unsigned int	cnt[2][OPERM5_PERMS];	/* permutations, by sample */
+	uint8_t		perm[OPERM5_KEYS];	/* comparisons to permutation */
 	double		alpha;	/* significance level for H0 */
 };
 
+/*
+ * Fill the table of the comparisons in a 5-tuple to its Lehmer code.
+ */
+static void
+operm5_perm_table(uint8_t *perm)
+{
+	static const unsigned int fact[5] = { 24, 6, 2, 1, 1 };
+	unsigned int r, i, j, k, d, key, used, v[5];
+
+	for (r = 0; r < OPERM5_PERMS; r++) {
+		/* Decode the Lehmer code r, v[i] is the order of word i */
+		for (i = 0, k = r, used = 0; i < 5; i++) {
+			d = k / fact[i];
+			k %= fact[i];
+			for (j = 0; (used & (1U << j)) || d-- > 0; j++)
+				;
+			used |= 1U << j;
+			v[i] = j;
+		}
+		/* The comparisons of word i are 4 * (4 - i) bits up the key */
+		for (i = 1, key = 0; i < 5; i++)
+			for (j = 0; j < i; j++)
+				if (v[i] < v[i - 1 - j])
+					key |= 1U << (4 * (4 - i) + j);
+		perm[key] = r;
+	}
+}
+
 int
 operm5_init(struct tras_ctx *ctx, void *params)
 {
 	struct operm5_ctx *c;
 	struct operm5_params *p = params;
+	int error;
 
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	c = malloc(sizeof(struct operm5_ctx));
-	if (c == NULL) {
-		ctx->state = TRAS_STATE_NONE;
-		return (ENOMEM);
-	}
+	if (p->K < OPERM5_MIN_WORDS || p->K > OPERM5_MAX_WORDS)
+		return (EINVAL);
+
+	error = tras_init_context(ctx, &operm5_algo, sizeof(struct operm5_ctx),
+	    TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
 
-	/*
-	 * todo: other initializations when defined.
-	 */
+	operm5_perm_table(c->perm);
 
-	c->nbits = 0;
+	c->K = p->K;
 	c->alpha = p->alpha;
 
-	ctx->context = c;
-	ctx->algo = &operm5_algo;
-	ctx->state = TRAS_STATE_INIT;
-
 	return (0);
 }
 
+/*
+ * Count the permutations of the 5-tuples ending at each of n words, if
+ * cnt is NULL the words only start the 5-tuples.
+ */
+static inline void
+operm5_count(struct operm5_ctx *c, const uint32_t *p, unsigned int n,
+    unsigned int *cnt)
+{
+	uint32_t u, w0, w1, w2, w3, h;
+	unsigned int i;
+
+	w0 = c->w[0];
+	w1 = c->w[1];
+	w2 = c->w[2];
+	w3 = c->w[3];
+	h = c->h;
+	for (i = 0; i < n; i++) {
+		memcpy(&u, p + i, sizeof(u));
+		u = be32toh(u);
+		h = (h << 4) | (u < w0) | ((u < w1) << 1) | ((u < w2) << 2) |
+		    ((u < w3) << 3);
+		if (cnt != NULL)
+			cnt[c->perm[h & OPERM5_KEY_MASK]]++;
+		w3 = w2;
+		w2 = w1;
+		w1 = w0;
+		w0 = u;
+	}
+	c->w[0] = w0;
+	c->w[1] = w1;
+	c->w[2] = w2;
+	c->w[3] = w3;
+	c->h = h;
+}
+
 int
 operm5_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct operm5_ctx *c;
+	const uint32_t *p;
+	unsigned int i, n, o, l, *cnt;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	c = ctx->context;
-
-	(void)c;
+	if (nbits & 0x1f)
+		return (EINVAL);
 
-	/* todo: implementation */
+	c = ctx->context;
+	p = (const uint32_t *)data;
 
 	c->nbits += nbits;
+	n = min(nbits >> 5, 2 * c->K - c->nword);
+
+	for (i = 0; i < n; i += l) {
+		cnt = c->cnt[c->nword / c->K];
+		o = c->nword % c->K;
+		/* The first four words of a sample start the 5-tuples */
+		if (o < 4) {
+			l = min(n - i, 4 - o);
+			operm5_count(c, p + i, l, NULL);
+		} else {
+			l = min(n - i, c->K - o);
+			operm5_count(c, p + i, l, cnt);
+		}
+		c->nword += l;
+	}
 
 	return (0);
 }
 
+/*
+ * The quadratic form of the deviations of the counts from their mean with
+ * the pseudo-inverse of the covariance.
+ */
+static double
+operm5_chi2(const unsigned int *cnt, unsigned int n)
+{
+	double d[OPERM5_PERMS], e, q, s;
+	const double *m;
+	unsigned int a, b;
+
+	e = (double)n / OPERM5_PERMS;
+	for (a = 0; a < OPERM5_PERMS; a++)
+		d[a] = (double)cnt[a] - e;
+
+	for (a = 0, q = 0.0, m = operm5_pinv; a < OPERM5_PERMS; a++) {
+		for (b = a + 1, s = 0.0; b < OPERM5_PERMS; b++)
+			s += m[b - a] * d[b];
+		q += d[a] * (m[0] * d[a] + 2.0 * s);
+		m += OPERM5_PERMS - a;
+	}
+
+	return (q / (double)n);
+}
+
 int
 operm5_final(struct tras_ctx *ctx)
 {
 	struct operm5_ctx *c;
-	double pvalue, sobs;
-	int sum;
+	double chi2[2], pvalue[2];
+	unsigned int s;
 
 	TRAS_CHECK_FINAL(ctx);
 
 	c = ctx->context;
+	if (c->nword < 2 * c->K)
+		return (EALREADY);
 
-	(void)c;
-
-	/* todo: implementation */
-
-	pvalue = 0.0;
+	for (s = 0; s < 2; s++) {
+		chi2[s] = operm5_chi2(c->cnt[s], c->K - 4);
+		pvalue[s] = igamc(OPERM5_DF / 2.0, max(chi2[s], 0.0) / 2.0);
+	}
 
-	if (pvalue < c->alpha)
+	if (pvalue[0] < c->alpha || pvalue[1] < c->alpha)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
 
-	ctx->result.discard = c->nbits & 0x07;
-	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0;
+	ctx->result.discard = c->nbits - 64 * c->K;
+	ctx->result.stats1 = chi2[0];
+	ctx->result.stats2 = chi2[1];
+	ctx->result.pvalue1 = pvalue[0];
+	ctx->result.pvalue2 = pvalue[1];
 
-	ctx->state = TRAS_STATE_FINAL;
+	tras_fini_context(ctx, 0);
 
 	return (0);
 }
@@ -34,9 +34,22 @@
 #define	__OPERM5_H__
 
 struct operm5_params {
-	double	alpha;	/* significance level for H0 */
+	unsigned int	K;	/* number of words in each of two samples */
+	double		alpha;	/* significance level for H0 */
 };
 
+/* The number of words in a sample for the Diehard test */
+#define	OPERM5_WORDS		1000000
+
+#define	OPERM5_MIN_WORDS	1000
+#define	OPERM5_MAX_WORDS	(1U << 30)
+
+/* The number of permutations of 5 words */
+#define	OPERM5_PERMS		120
+
+/* The quadratic form is chi-square with 5! - 4! degrees of freedom */
+#define	OPERM5_DF		96
+
 TRAS_DECLARE_ALGO(operm5);
 
 #endif
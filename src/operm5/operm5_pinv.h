@@ -0,0 +1,2468 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#ifndef __OPERM5_PINV_H__
+#define	__OPERM5_PINV_H__
+
+/*
+ * The pseudo-inverse of the asymptotic covariance matrix of the counts of
+ * overlapping 5-permutations per 5-tuple, the permutations numbered by their
+ * Lehmer code. The matrix has rank 96 and is symmetric, only the upper
+ * triangle is kept, row by row. The values are the exact rational
+ * pseudo-inverse rounded to 13 digits.
+ */
+#define	OPERM5_PINV_SIZE	(OPERM5_PERMS * (OPERM5_PERMS + 1) / 2)
+
+static const double operm5_pinv[OPERM5_PINV_SIZE] = {
+	 1.198364253182e+02, -2.010284433084e-01,  7.042088243779e+00,
+	-1.095648314267e+00,  5.804960117660e+00,  5.442495263029e+00,
+	 7.042088243779e+00,  5.836499973667e+00,  5.385231714680e+00,
+	 5.149375912347e-01,  4.158921298313e+00,  3.958633206773e+00,
+	 5.385231714680e+00,  3.957574189466e+00,  4.003048096286e+00,
+	 3.975850193648e+00,  3.105321371847e+00,  3.321916614923e+00,
+	 2.116156648272e+00,  2.618502683801e+00,  2.337977449684e+00,
+	 2.642660373778e+00,  1.779269009384e+00,  1.908460539134e+00,
+	-2.010284433084e-01,  6.945113644340e+00,  5.836499973667e+00,
+	 7.065855978652e+00,  5.643164485555e+00,  5.365853466937e+00,
+	 5.804960117660e+00,  5.643164485555e+00,  2.116156648272e+00,
+	-2.969341464189e+01, -4.243970352945e-02, -4.698931478856e+00,
+	 4.158921298313e+00,  3.372434726074e+00,  2.337977449684e+00,
+	-2.004258413994e+00, -1.724600209857e+00, -5.327642310577e+00,
+	-4.243970352945e-02,  2.021832568728e+00,  1.706579902624e-01,
+	-3.313817106892e+00, -8.227616271203e-01, -3.801824532655e+00,
+	-1.095648314267e+00,  7.065855978652e+00,  3.957574189466e+00,
+	 1.428519033495e+00,  3.372434726074e+00, -6.752871022338e-03,
+	 5.442495263029e+00,  5.365853466937e+00,  2.618502683801e+00,
+	 2.310785139207e+00,  2.021832568728e+00, -1.690305723896e+00,
+	 3.105321371847e+00, -2.021514392061e+00,  1.779269009384e+00,
+	-3.350310623590e+00, -1.017404823574e+01, -1.359534392292e+01,
+	-1.724600209857e+00, -3.351793695112e+00, -8.227616271203e-01,
+	-4.809065265750e+00, -6.759646591125e+00, -6.799221992787e+00,
+	 5.149375912347e-01,  1.428519033495e+00,  3.975850193648e+00,
+	 1.385998153569e+00, -2.021514392061e+00, -2.028026724099e+00,
+	 3.958633206773e+00, -6.752871022338e-03,  2.642660373778e+00,
+	 1.859023837738e+00, -3.351793695112e+00, -4.219257171245e+00,
+	 3.321916614923e+00, -2.028026724099e+00,  1.908460539134e+00,
+	-2.546638573012e+00, -5.736269002802e+00, -4.700763575425e+00,
+	-1.017404823574e+01, -5.736269002802e+00, -6.759646591125e+00,
+	-8.154484891569e+00, -1.078158270166e+01, -9.417930088631e+00,
+	-2.969341464189e+01,  2.310785139207e+00, -2.004258413994e+00,
+	 1.859023837738e+00, -3.350310623590e+00, -2.546638573012e+00,
+	-4.698931478856e+00, -1.690305723896e+00, -3.313817106892e+00,
+	 1.588392649944e+00, -4.809065265750e+00, -5.223133603863e+00,
+	-5.327642310577e+00, -4.219257171245e+00, -3.801824532655e+00,
+	-5.223133603863e+00, -8.154484891569e+00, -5.700818805157e+00,
+	-1.359534392292e+01, -4.700763575425e+00, -6.799221992787e+00,
+	-5.700818805157e+00, -9.417930088631e+00, -7.074519524361e+00,
+	 9.505495735115e+01,  1.463302254983e+01, -1.360046201300e+01,
+	 1.328184057653e+01,  1.313791984167e+01,  8.956758412540e+00,
+	 7.318037589393e+00,  3.304753521488e+00, -1.246585631575e+01,
+	 2.093205223347e+00,  1.203682255248e+01,  6.189716297832e+00,
+	 5.572690529472e+00,  5.593924666738e+00,  6.049670909548e+00,
+	 1.173906954842e+00,  2.833151261579e-01,  5.760912464081e+00,
+	 4.225686987885e+00,  3.967757426157e+00,  4.638619375456e+00,
+	 3.574412544294e+00,  4.240561051655e+00,  2.119065301237e+01,
+	-1.069005025805e+01,  5.826660099257e+00,  8.697969762798e+00,
+	 5.422451484902e+00,  5.253510921143e+00,  6.144011332534e+00,
+	 3.492491654036e+00, -9.637049213501e-01, -1.577146963971e+01,
+	-1.483039790023e+00, -1.273599228229e+01,  2.677993416960e+00,
+	 1.674442526061e+00,  3.003809127256e+00, -4.175255724829e+00,
+	-3.003794026140e+00, -3.047689591838e+00,  2.786433422247e+00,
+	 2.196864864521e-01,  1.430732204785e+00, -5.496898625692e+00,
+	 9.635617303076e-01, -6.034433774569e+00,  2.348732533831e+01,
+	-9.377746354727e+00,  3.431508301960e+00,  3.172391086813e+00,
+	 3.179031156918e+00, -4.532123253494e-01,  7.809624182921e+00,
+	 5.119857452701e+00,  3.357250305437e+00,  3.230429487931e+00,
+	 3.266755196989e+00, -3.159505913850e+00,  2.388187317455e+00,
+	-3.375776337465e+00,  1.358244315756e-01, -2.615177265849e+00,
+	-6.787946198354e+00, -7.427056300412e+00,  2.676029407895e+00,
+	-4.737815471167e+00, -1.397583410209e+00, -3.906907367151e+00,
+	-9.337869758298e+00, -1.188936352316e+01, -6.798830473095e-02,
+	-1.477531242987e+01,  2.763559732723e+00,  5.194870527249e+00,
+	-2.768990801558e+00, -2.806772497137e+00,  7.684382200426e+00,
+	-2.883507708059e-01,  2.766598686302e+00,  4.870831977946e+00,
+	-2.995157365797e+00, -5.511706462672e+00,  5.510653782647e+00,
+	-3.050183393459e+00,  1.726845253088e+00, -3.363540848300e+00,
+	-6.461984370919e+00, -6.575829631605e+00, -1.303981381195e+01,
+	-7.395046382972e+00, -7.042524271406e+00, -6.507284340056e+00,
+	-8.672472286849e+00, -7.265582980223e+00,  8.607179336733e+00,
+	-1.985823507029e+01, -2.932848967644e+00,  3.427218701392e-01,
+	-3.796295917225e+00, -3.789224026054e+00, -4.993383036552e+00,
+	-2.752131659222e+00, -3.144905682561e+00,  4.705232533044e-01,
+	-3.842372777174e+00, -6.458748112774e+00, -7.366581755986e+00,
+	-5.298103627098e+00, -4.232996855601e+00, -5.304662936465e+00,
+	-6.798110169058e+00, -7.475078119413e+00, -8.689360397115e+00,
+	-6.526068911173e+00, -7.622281008237e+00, -7.221397104460e+00,
+	-1.082038661554e+01, -9.417930088631e+00,  9.514104457343e+01,
+	 4.111966611895e+00, -1.268392407684e+01, -1.281697780429e+01,
+	 1.733597616587e+01,  1.390060862748e+01,  3.193681447306e+00,
+	 2.557303867076e+00,  3.005278579183e+00, -1.119770460073e+01,
+	 7.414298793425e+00,  1.192331627159e+01,  3.149849484259e+00,
+	 1.335345077867e+01,  2.185800163934e+00,  2.185227736102e+00,
+	 2.918967159751e+00, -4.978174845623e-01,  2.046817637996e+00,
+	 1.771529416317e+00,  2.370602470035e+00,  1.619280123897e+00,
+	 8.956758412540e+00,  1.656124109206e+01, -9.872296499075e+00,
+	 6.097907247659e+00,  9.428492537503e+00,  9.295759960709e+00,
+	 6.855703623591e+00,  3.237900089911e+00,  1.660417012359e-01,
+	-2.905716965306e+00,  7.168638144989e-01, -1.678778152128e+01,
+	 8.269544203279e+00,  1.074167320036e+00, -1.403807678794e+00,
+	-1.192430452262e+01,  6.170253131144e-02, -4.141063210467e+00,
+	 3.518308208680e+00, -5.803234253964e-01, -3.123380445759e+00,
+	-2.905663794295e+00, -1.791906368604e+00, -3.208098722000e+00,
+	 5.433695619918e+00,  1.230881342598e+01, -1.224326435289e+01,
+	 1.172842236345e+00,  7.917203302918e+00,  4.189548880299e+00,
+	 5.968337421429e+00,  2.338510440781e+00,  3.016385531950e+00,
+	-4.408844372209e+00,  3.626068944822e+00,  1.701081515768e+00,
+	 4.263486161716e+00, -3.828491200870e+00,  6.255865808762e-01,
+	-3.782715174312e+00, -6.790029484350e+00, -6.309706036015e+00,
+	 5.208504137773e-03, -6.029988499579e+00, -6.555006191468e-01,
+	-4.703580551709e+00, -8.096313054729e+00, -7.846534379118e+00,
+	 5.442738728633e+00,  7.543354819445e+00, -1.167297866308e+01,
+	-3.270869270798e+00,  2.481957381474e+00,  2.735392557554e+00,
+	 2.445448251375e+00, -2.274835626551e+00,  1.174164861452e+00,
+	-4.240272168066e+00, -1.784468438871e+00, -4.384660366959e-02,
+	 3.870260047783e+00, -3.882329085277e+00,  7.880721262169e-01,
+	-3.260778869354e+00, -7.153856720932e+00, -9.621412295266e+00,
+	-8.510243837528e+00, -6.935441441047e+00, -7.043492627925e+00,
+	-7.368673938686e+00, -7.936794656978e+00, -7.475078119413e+00,
+	-1.436616697598e+00, -9.391775317018e+00, -1.676345773738e+01,
+	-1.682922109043e+00,  1.557584945579e+00,  2.574727399912e+00,
+	-4.225560845873e+00, -2.459597136416e+00, -3.993708883587e+00,
+	-3.157597834813e+00, -5.089782964358e+00,  4.066309282903e+00,
+	-6.042866779721e+00, -4.439221020099e+00, -4.270796231530e+00,
+	-6.302935190683e+00, -6.849281041372e+00, -4.598325636941e+00,
+	-8.158413264879e+00, -6.194243921487e+00, -6.206309886861e+00,
+	-6.150544796433e+00, -7.221397104460e+00, -5.700818805157e+00,
+	 9.413723065305e+01,  4.400439543013e+00,  3.821326467607e+00,
+	 5.433695619918e+00,  5.279814519166e+00,  1.282342896223e+01,
+	-1.290376043377e+01,  1.321372680238e+01,  1.836172744510e+00,
+	 3.787611753904e+00,  3.613540478059e+00,  3.607110079859e+00,
+	 4.132541158062e+00,  1.107964915788e+01,  1.086704431938e+01,
+	 5.109253424275e+00,  2.127040208223e+00,  1.645442417103e+00,
+	 3.067456987635e+00,  2.403756399647e+00,  2.277526143913e+00,
+	 2.348732533831e+01,  1.108837371529e+01,  5.938872879610e+00,
+	-8.338514066157e+00,  6.130800956538e+00,  5.644322734034e+00,
+	 7.278046669974e+00,  5.848106058619e+00, -2.370334911737e+00,
+	-1.741343395461e+01, -1.831705872341e+00, -1.757735704956e+00,
+	 6.044297742142e+00,  4.188852172306e+00,  1.271906854840e+00,
+	-2.434341346827e+00, -3.022213996320e+00, -1.409124404267e+01,
+	 7.303495620369e+00,  2.545811899239e+00, -5.270493401612e-01,
+	-3.527029313144e+00,  6.480601053563e-01, -3.424324632603e+00,
+	 2.952584789772e+00,  9.540219358805e+00,  4.089626870161e+00,
+	-1.476250520358e+01,  4.575982226581e+00,  1.194626791439e-01,
+	 6.241802654244e+00,  4.934647502956e+00,  1.866096847607e+00,
+	 4.342318919497e+00,  2.273467378119e+00, -2.596374925752e+00,
+	-5.388236331488e-01, -9.866031210242e-01,  1.968441873893e+00,
+	-6.688376913594e+00, -1.008696088605e+01, -7.888096785292e+00,
+	-2.142159352763e+00, -2.662946707408e+00,  8.728167739136e-02,
+	-8.028801403943e+00, -7.906071484181e+00, -5.103736318548e+00,
+	 1.363256479725e+01,  4.724777030396e+00,  3.346680124015e+00,
+	-1.636065878856e+01, -2.502069944112e+00, -1.326291246903e+00,
+	 3.147559236067e-01, -2.176212322976e-01,  8.923842269424e-01,
+	 2.776917641371e+00, -4.357839888469e+00, -4.183611478610e+00,
+	-1.395355716380e+00, -2.810046656598e+00,  8.596065312587e-01,
+	-4.208463205027e+00, -7.617857162435e+00, -6.509297316739e+00,
+	-3.583326707102e+00, -3.456265130000e+00, -5.838502223296e+00,
+	-8.492762726010e+00, -9.795986009264e+00, -1.188936352316e+01,
+	 1.014709932633e+01,  6.592615705799e-01, -1.461896057301e+00,
+	-2.078294739554e+01, -2.040819721128e+00, -1.749310225963e+00,
+	-3.451302164383e+00, -6.078625248680e-01, -3.571550258759e+00,
+	-2.001354624233e+00, -4.095791269288e+00, -4.915340817885e+00,
+	-4.263890114734e+00, -3.352106445628e+00, -3.766746276574e+00,
+	-5.146789834531e+00, -8.565954662100e+00, -7.846534379118e+00,
+	-5.032639310386e+00, -5.374326968317e+00, -7.610477576841e+00,
+	-6.206309886861e+00, -7.622281008237e+00, -6.799221992787e+00,
+	 9.645187011145e+01, -1.149379246006e+01,  6.855703623591e+00,
+	 3.473358105703e+00,  2.269074240177e+00,  3.113726507635e+00,
+	 3.618552637972e+00, -1.041791013693e+01,  1.484689417767e+01,
+	 6.773275636975e-01,  2.729363586295e+00,  2.967502268886e+00,
+	 2.176865652904e+00,  2.465329951839e+00,  1.385279655634e+01,
+	 1.039773108504e+01,  1.317289517217e+00,  1.194165228981e+01,
+	 1.879421398968e+00,  1.396541830474e+00,  6.144011332534e+00,
+	 1.367630178786e+01,  6.803783661084e+00,  3.942845800978e+00,
+	-1.200894313004e+01,  7.212473530872e+00,  7.362412567751e+00,
+	 4.157778776832e+00,  5.304757044775e-01, -4.090708814997e+00,
+	 1.051582537081e+00, -1.732201712213e+01,  4.059405706693e+00,
+	 1.067529385234e+00, -6.429579141658e-01, -1.615027943979e+00,
+	-3.802109614301e-01, -3.639802435673e+00,  3.381035142867e+00,
+	 8.495879428693e-02, -1.390592210966e+00, -1.319430480890e+01,
+	-2.422870916489e+00, -2.111362245076e+00,  7.278046669974e+00,
+	 1.553497773043e+01,  8.510962617547e+00, -1.055105268277e+00,
+	-1.125058937662e+01,  2.568940779971e+00,  5.647224242487e+00,
+	 2.523572268464e+00,  1.972105926837e+00, -2.276400718738e+00,
+	 1.611588167261e+00,  3.790957392383e+00, -1.374106848530e+00,
+	-2.682093844821e+00,  1.576985794401e+00, -3.838214998904e+00,
+	-9.948184353734e+00, -6.723903431767e+00, -2.497536897801e+00,
+	-3.070522677661e+00,  4.506886272349e-01, -5.414316859672e+00,
+	-8.442029225694e+00, -6.509297316739e+00,  1.395510416804e+00,
+	-7.848880696999e+00,  7.199345387488e+00,  3.041613548867e-01,
+	-1.698465874147e+01,  4.018754001348e+00,  2.098094156850e-02,
+	 5.141362124411e-01,  2.931824983821e+00, -5.720215332299e+00,
+	-4.118520727573e+00,  5.020346227853e+00, -5.887966196285e+00,
+	-3.514546276947e+00,  1.268434943283e+00, -3.406546463371e+00,
+	-6.017673154983e+00, -3.202198302064e+00, -4.707676646464e+00,
+	-7.002796935801e+00, -6.834192645476e+00, -7.333543992606e+00,
+	-9.339638657485e+00, -6.575829631605e+00,  1.887729392864e+00,
+	 9.889986917676e+00,  2.528696028619e+00, -7.023213833831e-01,
+	-1.836290956335e+01,  2.904878235750e+00,  5.453315589581e-01,
+	-2.301633129172e+00, -1.636068969221e+00, -6.496642146973e+00,
+	-3.122642508226e+00, -4.791239452346e-01, -2.096137113553e+00,
+	-6.233402098510e+00, -3.167986426739e+00, -3.862410953153e+00,
+	-8.746458503959e+00, -9.621412295266e+00, -4.054354957953e+00,
+	-6.618484122596e+00, -5.374326968317e+00, -6.194243921487e+00,
+	-6.526068911173e+00, -4.700763575425e+00,  9.582535609152e+01,
+	 5.968337421429e+00,  1.261198349478e+00,  2.849564574670e+00,
+	 1.880999975506e+00,  4.070223633294e+00, -1.137718812299e+01,
+	 4.701132815293e+00,  1.512140931027e+00,  1.213250787363e+01,
+	 3.368861080248e+00,  1.958044531414e+00,  1.637282693123e+00,
+	 4.110489866789e+00,  6.607416217983e-01,  1.144420990562e+01,
+	 2.061253084934e+00,  1.294236416278e+01,  1.258798490474e+01,
+	 7.809624182921e+00,  1.528332153163e+01,  1.145175163353e+01,
+	 4.866839874631e+00,  1.170347912756e+01, -8.297541563950e+00,
+	 5.647224242487e+00,  2.189875166806e+00,  6.514720168175e-01,
+	-3.966875133960e+00,  2.053018965971e+00, -1.839768658979e+01,
+	 4.614522252283e+00,  3.378962900472e+00, -3.046752274588e+00,
+	-5.379060010957e-01,  5.307627242695e-02, -5.531412309654e+00,
+	 4.421542495743e+00,  2.739717845743e+00, -3.496502067220e+00,
+	-1.978085165551e+00, -1.319885161179e+00, -1.392857184169e+01,
+	 6.241802654244e+00, -5.297355703432e+00,  6.666919054489e+00,
+	 6.884749559513e-02,  6.953438358800e+00, -1.425152331147e+01,
+	 8.606371226389e+00,  4.910371536422e+00,  2.346709136573e+00,
+	-3.319274027117e+00,  2.711511890228e+00,  3.974636535102e+00,
+	-4.572240886436e+00, -4.277825771633e+00, -1.204202359331e+00,
+	-3.060995013950e+00, -8.528145525572e+00, -7.362381991515e+00,
+	-1.501427402001e+00, -5.043942478076e+00, -1.236528750644e+00,
+	-4.197823403104e+00, -8.503146417492e+00, -7.888096785292e+00,
+	-3.385322917017e-01,  1.007304985431e+01,  4.965747295278e+00,
+	-1.500274545503e+00,  1.206701767011e+00, -1.853897438606e+01,
+	 1.573078646294e+00, -1.163019868429e+00,  9.342946892489e-01,
+	-3.939033477671e+00, -3.217070863418e+00,  8.461822412184e-01,
+	 1.124628046224e-01, -1.371630235095e+00,  5.906337922250e-01,
+	-6.034279734737e+00, -7.354590356675e+00, -6.723903431767e+00,
+	-3.002472086703e+00, -5.704666298488e+00, -7.889141118361e+00,
+	-4.537220624508e+00, -6.533192547079e+00, -7.427056300412e+00,
+	 1.160476605362e+00,  8.542775590209e+00,  1.305191602080e+00,
+	-2.273036169484e+00,  1.185705429959e+00, -1.955882182498e+01,
+	 2.914347521061e+00, -2.617622763510e+00, -2.904798893126e+00,
+	-3.788777598628e+00, -3.083666913486e+00,  6.996732306856e-01,
+	 7.223117961912e-01, -2.107380789316e+00, -3.524374107385e+00,
+	-5.973023955525e+00, -5.446412219730e+00, -6.309706036015e+00,
+	-7.252267380717e-01, -4.054354957953e+00, -5.032639310386e+00,
+	-8.158413264879e+00, -8.689360397115e+00, -1.359534392292e+01,
+	 9.514104457343e+01, -9.872296499075e+00,  7.414298793425e+00,
+	 5.442738728633e+00,  8.269544203279e+00,  2.445448251375e+00,
+	 3.193681447306e+00, -1.224326435289e+01,  3.149849484259e+00,
+	-1.167297866308e+01,  4.263486161716e+00,  3.870260047783e+00,
+	 1.660417012359e-01,  3.016385531950e+00, -1.403807678794e+00,
+	 1.174164861452e+00,  6.255865808762e-01,  7.880721262169e-01,
+	 1.463302254983e+01,  1.656124109206e+01,  1.390060862748e+01,
+	 1.230881342598e+01,  3.237900089911e+00,  2.338510440781e+00,
+	-1.268392407684e+01,  9.428492537503e+00,  2.918967159751e+00,
+	-1.436616697598e+00,  3.518308208680e+00, -4.225560845873e+00,
+	 3.005278579183e+00,  7.917203302918e+00,  2.046817637996e+00,
+	-1.676345773738e+01,  5.208504137773e-03, -6.042866779721e+00,
+	 7.168638144989e-01,  3.626068944822e+00, -3.123380445759e+00,
+	-3.993708883587e+00, -6.555006191468e-01, -4.270796231530e+00,
+	 4.111966611895e+00,  6.097907247659e+00,  1.192331627159e+01,
+	 7.543354819445e+00,  1.074167320036e+00, -2.274835626551e+00,
+	-1.281697780429e+01,  9.295759960709e+00, -4.978174845623e-01,
+	-9.391775317018e+00, -5.803234253964e-01, -2.459597136416e+00,
+	 2.185800163934e+00,  2.481957381474e+00,  2.370602470035e+00,
+	 1.557584945579e+00, -8.510243837528e+00, -8.158413264879e+00,
+	 6.170253131144e-02, -1.784468438871e+00, -1.791906368604e+00,
+	-5.089782964358e+00, -7.043492627925e+00, -6.206309886861e+00,
+	 2.557303867076e+00,  1.172842236345e+00,  1.335345077867e+01,
+	-3.270869270798e+00, -3.828491200870e+00, -3.882329085277e+00,
+	-1.119770460073e+01,  4.189548880299e+00,  1.771529416317e+00,
+	-1.682922109043e+00, -6.029988499579e+00, -4.439221020099e+00,
+	 2.185227736102e+00,  2.735392557554e+00,  1.619280123897e+00,
+	 2.574727399912e+00, -6.935441441047e+00, -6.194243921487e+00,
+	-6.790029484350e+00, -7.153856720932e+00, -8.096313054729e+00,
+	-6.849281041372e+00, -7.936794656978e+00, -7.221397104460e+00,
+	-2.905716965306e+00, -4.408844372209e+00, -1.192430452262e+01,
+	-4.240272168066e+00, -3.782715174312e+00, -3.260778869354e+00,
+	-1.678778152128e+01,  1.701081515768e+00, -2.905663794295e+00,
+	-3.157597834813e+00, -4.703580551709e+00, -6.302935190683e+00,
+	-4.141063210467e+00, -4.384660366959e-02, -3.208098722000e+00,
+	 4.066309282903e+00, -7.368673938686e+00, -6.150544796433e+00,
+	-6.309706036015e+00, -9.621412295266e+00, -7.846534379118e+00,
+	-4.598325636941e+00, -7.475078119413e+00, -5.700818805157e+00,
+	 9.866846183067e+01,  3.817434601725e+00,  3.662371906904e+00,
+	 4.708114569212e+00,  2.754969555675e+00,  5.714342860534e+00,
+	-1.096961967365e+01,  4.677339742782e+00, -1.123852794783e+01,
+	 2.005509099976e+00,  1.761706826520e+00,  2.836545365296e+00,
+	 4.091907345714e+00,  3.052664247082e+00,  1.390819755889e+00,
+	 2.996086680657e+00,  2.177039435268e+00,  5.826660099257e+00,
+	 7.186962222119e+00,  2.466072236085e+01,  4.981788127554e+00,
+	 1.413276130267e+01,  1.123693803017e+01,  6.803783661084e+00,
+	-1.200204628982e+01,  2.014153207221e+00, -9.833693428724e-01,
+	 2.914760062705e+00, -2.225683045697e+00,  2.872874512198e+00,
+	 6.659350941825e+00, -6.145094317617e-01, -1.735427217697e+01,
+	 6.253261181329e-01, -3.066860590088e+00,  1.455288447581e+00,
+	 2.256917174712e+00, -1.299453121381e+00, -4.338299165747e+00,
+	-1.017282612133e+00, -7.186374008370e+00,  5.938872879610e+00,
+	 7.020622315125e+00,  1.141123204030e+01,  3.138542869433e-01,
+	 8.237339231789e-01,  6.290326627743e+00,  1.145175163353e+01,
+	-7.462086587433e+00, -1.753649010648e-01, -6.222813356798e-01,
+	 1.123942412490e+00, -1.181689608179e+01,  2.259724475421e+00,
+	 1.035291238444e+00,  2.619439411635e-01,  2.345641452191e+00,
+	-5.775897341950e+00, -4.537220624508e+00,  1.001012164120e+00,
+	-3.082620429656e+00,  7.687474184356e-01, -4.236013802273e+00,
+	-9.226553962378e+00, -8.492762726010e+00,  4.328867323995e+00,
+	 1.838393288341e+00, -7.097320861696e+00, -2.065603792014e-01,
+	-4.701498066259e+00, -6.473646125492e+00,  7.421329582258e+00,
+	-1.311200218983e+01,  3.957918939460e+00, -3.106713406855e+00,
+	-6.284733820849e+00, -3.766983086450e+00,  3.512837651510e+00,
+	 4.462265434849e+00,  2.227047516773e+00,  4.339529153064e+00,
+	-7.812126645647e+00, -7.333543992606e+00, -5.386554332896e+00,
+	-1.148563216579e+01, -8.709380485627e+00, -4.498964447094e+00,
+	-6.358618853284e+00, -6.507284340056e+00, -8.175456302712e-01,
+	-4.199563822339e+00,  6.358503366212e+00, -1.142992047117e+00,
+	-4.033039103607e+00, -6.598060784486e+00,  1.882415022401e+00,
+	-2.158847452393e+01, -4.772120843622e+00, -3.708886399897e+00,
+	-3.195637320996e+00, -5.595969195406e+00, -2.875164802643e+00,
+	-3.894449256185e+00, -6.872364324784e+00,  1.425802571867e+00,
+	-7.153225536754e+00, -7.368673938686e+00, -5.446412219730e+00,
+	-8.746458503959e+00, -8.565954662100e+00, -6.849281041372e+00,
+	-6.798110169058e+00, -8.154484891569e+00,  9.303690897467e+01,
+	 1.032036931573e+00, -1.437509557119e+01,  2.376676716996e+00,
+	 6.879487540206e+00,  7.830792488315e-01,  3.531623574367e+00,
+	 3.033025904912e+00, -1.497169980516e+01, -1.276036805861e+01,
+	 4.247314768144e+00,  2.849397904601e+00,  2.719488440316e+00,
+	 1.240395017525e-01,  2.229989106936e+00,  1.709723512905e+00,
+	 6.189716297832e+00,  3.534026484252e+00,  5.714342860534e+00,
+	 1.329704366766e+01,  4.822876651696e+00,  5.494486379864e+00,
+	 1.484689417767e+01,  1.257848023690e+01, -1.615534578423e+01,
+	-3.250725426137e+00,  3.267828806549e+00, -2.113933007862e+00,
+	 2.991334631446e+00,  9.166912330762e+00,  1.514050621450e+00,
+	-1.485240321581e+00,  1.836798978688e+00, -1.796606200955e+01,
+	 8.645112766494e-01,  4.934039777925e-01, -1.562366168442e-01,
+	-6.137967782999e+00, -1.748883572120e+00, -4.112944929572e+00,
+	 3.787611753904e+00,  3.073541557360e+00,  5.693248167150e+00,
+	 8.030710324664e+00,  4.677240151748e+00,  1.495806206700e-01,
+	 4.701132815293e+00,  2.445507097984e+00, -1.477458972653e+01,
+	-5.300941841616e+00,  4.855767222409e+00, -1.764751940509e+00,
+	 2.479303162059e+00,  5.608363977668e+00, -1.917764053845e+00,
+	-1.090411611619e+01, -1.801614127779e+00,  6.996732306856e-01,
+	-1.088611273287e+00, -3.963736556695e+00, -4.105912990416e+00,
+	-5.671742031674e+00, -4.673532379350e+00, -4.915340817885e+00,
+	 5.345314793319e+00, -4.865346579622e-01,  1.736343164994e+00,
+	 9.165566070483e+00, -6.246579972538e-01,  3.800883574870e-02,
+	 4.395057575409e+00, -1.007191597567e+00, -1.264570441710e+01,
+	-2.817458265443e+00, -7.684814635687e-01, -5.149036479730e+00,
+	 3.991446696014e+00, -4.210399384737e+00,  1.018935344832e+00,
+	-2.126996365332e+00, -3.352197020544e+00, -4.791239452346e-01,
+	-7.137383601767e+00, -5.520248494528e+00, -7.688467149045e+00,
+	-5.595969195406e+00, -6.268679193732e+00, -6.458748112774e+00,
+	-1.413148855904e+00, -8.507229338521e-01, -2.775017412670e+00,
+	-1.035306549488e+01, -3.182261114663e+00, -2.453760706000e+00,
+	-5.606828428998e+00, -3.417695766792e+00, -1.816473444000e+01,
+	-1.815570294466e+00,  1.733752303319e+00, -3.328898053644e+00,
+	-3.618845571383e+00, -6.713153494862e+00, -4.344792921163e+00,
+	-3.035298035277e+00,  1.425802571867e+00,  4.066309282903e+00,
+	-5.973023955525e+00, -3.862410953153e+00, -5.146789834531e+00,
+	-6.302935190683e+00, -5.304662936465e+00, -5.223133603863e+00,
+	 9.643003993838e+01,  1.028996681257e+00,  1.542832718953e+00,
+	 5.345314793319e+00,  2.946368918109e+00,  2.521736977353e+00,
+	 2.613368597100e+00,  4.666152903875e-01,  2.032442919958e+00,
+	 6.161962224305e+00,  1.546813244233e+00,  2.305473049319e+00,
+	 1.530384771424e+00,  2.876991281206e+00,  1.741819384095e+00,
+	-6.798830473095e-02,  8.350945013180e+00,  4.328867323995e+00,
+	 8.422734964478e+00,  5.399160989020e+00,  4.267290749018e+00,
+	 1.395510416804e+00,  4.836447461486e+00,  7.294880514924e+00,
+	-3.543624885691e+01,  5.802880078672e+00, -2.884468624642e+00,
+	 2.068494564446e+00,  3.695306220970e+00,  2.289702072485e-01,
+	-3.449183212854e+00,  3.059219503326e+00, -2.233640792970e+00,
+	-7.941333429609e-01,  2.922110674780e+00, -1.303277129674e+00,
+	-4.370949407864e+00, -2.520509178183e+00, -3.951236775656e+00,
+	 1.363256479725e+01,  6.442216870324e+00,  2.388408241585e+00,
+	 3.602497640164e+00,  1.998923641038e+00, -3.298152349902e-01,
+	-3.385322917017e-01,  3.179496450517e+00,  1.114849345277e-01,
+	-1.556112555510e+01, -8.387401553610e-01, -2.127545451841e+00,
+	 3.195508595240e+00, -1.370020588042e+00, -5.461624410772e-01,
+	-3.937935079379e+00,  3.953003306613e+00, -1.392857184169e+01,
+	 2.265350295737e+00, -1.998506975319e+00, -2.366789863501e+00,
+	-4.089386035084e+00, -3.604350182078e+00, -3.424324632603e+00,
+	 1.318156858857e+01,  2.948311731521e+00,  2.241036691919e+00,
+	 2.512771427879e+00, -2.885937081098e-01, -3.746196596630e-01,
+	 7.957551721289e-01,  8.245104493751e-02, -5.036848859206e-01,
+	-1.784818972042e+01, -3.396993803252e+00, -3.041364628188e+00,
+	 7.238317266126e-01, -1.679905024308e+00, -5.480636670649e-01,
+	-2.707398102478e+00, -5.590329449613e+00, -2.111362245076e+00,
+	-1.825286897668e+00, -1.433053659009e+00, -4.097909925188e+00,
+	-7.186374008370e+00, -6.403934677445e+00, -6.034433774569e+00,
+	 8.878029250864e+00,  9.347771452562e-01, -2.999511866818e-01,
+	 6.922074314520e-01, -9.691804166041e-03,  5.092808644586e-02,
+	-2.548408267874e+00, -2.228084886420e-01, -3.315409063264e+00,
+	-2.140306424411e+01, -4.487563915455e+00, -4.112944929572e+00,
+	-3.645474573059e+00, -2.908995640068e+00, -3.120368999493e+00,
+	-4.344792921163e+00, -6.872364324784e+00, -3.208098722000e+00,
+	-3.524374107385e+00, -3.167986426739e+00, -3.766746276574e+00,
+	-4.270796231530e+00, -4.232996855601e+00, -3.801824532655e+00,
+	 9.274903098977e+01,  2.939312025270e+00,  2.991334631446e+00,
+	 3.701107506882e+00,  3.445683261855e+00,  1.107359958167e+00,
+	-1.579056035613e+01, -1.235829584516e+01,  3.587693382515e+00,
+	-1.583198579187e-01,  2.898209759739e+00,  1.962703249421e+00,
+	 1.282483886717e+00,  2.012813830950e+00,  2.677993416960e+00,
+	 1.197611596008e+00,  2.872874512198e+00,  1.106142156362e+01,
+	 3.052739500993e+00,  3.492461983959e+00,  4.059405706693e+00,
+	 2.139107897563e+00,  3.736196427945e+00, -4.148582240389e+00,
+	-1.594801584324e+01, -2.158681597749e+00,  1.100672615238e+01,
+	 1.414393533018e+00,  2.021752152485e+00, -4.732801646161e+00,
+	 9.824378689400e-01, -1.808744366841e+01,  1.141590726853e+01,
+	 8.643816426594e+00,  5.869048258890e-01, -2.998594331596e+00,
+	-7.011503139073e-01, -3.041364628188e+00,  6.044297742142e+00,
+	 5.591878380032e+00,  1.927925368708e+00,  7.756203532263e+00,
+	 2.259172468563e+00,  1.375543002819e-01,  4.614522252283e+00,
+	 2.691558853325e+00,  7.541952293392e+00, -4.870875296598e+00,
+	-1.274971040765e+01, -1.534521447602e+00, -3.199985588940e+00,
+	-2.782476175734e+00, -1.910848175947e+00, -2.743959194151e+00,
+	-3.797429310574e+00,  8.461822412184e-01, -3.095239320961e+00,
+	 4.480661864288e+00, -2.509662021919e+00, -1.054583017588e+01,
+	-6.136786920084e+00, -4.183611478610e+00,  2.068494564446e+00,
+	 2.822352104994e+00,  4.628791464403e+00, -7.832123648192e+00,
+	-2.644618580543e+00, -1.295866938924e+00, -9.408018770319e-01,
+	-5.677761772974e-02,  4.480723672471e+00, -9.362511260365e-01,
+	-1.801697508096e+01, -2.509964234417e+00, -2.350726516785e+00,
+	-1.858416284147e+00,  8.353369742732e-01, -3.907958631133e+00,
+	 1.213873959232e+00,  5.020346227853e+00, -3.881796594818e+00,
+	-7.342122503549e+00, -7.656472312125e+00, -3.766983086450e+00,
+	-7.034368675500e+00, -5.511706462672e+00,  1.396560743047e+00,
+	-2.303620264107e-01,  6.184546668867e-01,  7.938407298816e+00,
+	-9.010289531177e-01,  1.934531324629e-01,  1.819684527024e+00,
+	-1.460894852541e+00,  7.026949447723e-01, -5.253916633946e+00,
+	-2.103304812199e+01, -5.149036479730e+00, -2.757195225164e+00,
+	-2.737960496632e+00, -2.908995640068e+00, -6.713153494862e+00,
+	-3.894449256185e+00, -4.384660366959e-02, -2.107380789316e+00,
+	-6.233402098510e+00, -3.352106445628e+00, -4.439221020099e+00,
+	-5.298103627098e+00, -4.219257171245e+00,  9.805012380843e+01,
+	 4.395057575409e+00,  2.853564764686e+00,  8.661544541897e-01,
+	 1.892148962805e+00,  3.225811061359e+00,  1.915727932382e+00,
+	 3.513668774140e+00,  2.005945896488e+00,  8.547452986833e-01,
+	 1.329883501280e+00,  5.929515168959e-01,  2.042384101878e+00,
+	 7.684382200426e+00, -5.554027882823e+00,  7.421329582258e+00,
+	 5.246599889640e+00,  7.855724348795e+00,  6.913295825353e+00,
+	 2.098094156850e-02,  1.342642077732e+00, -1.199224329591e+00,
+	-5.367991489997e+00, -1.168805996024e+00, -3.619480238401e+01,
+	-9.408018770319e-01,  1.236200425223e+00,  6.733606045257e+00,
+	-2.369407090090e+00, -1.833095037434e+00, -4.998804847380e+00,
+	 1.416742656010e+00,  8.312065129088e-01,  6.334450731912e+00,
+	-2.853509113382e+00,  4.420997494786e+00, -2.233640792970e+00,
+	 3.147559236067e-01,  8.919070783472e+00,  4.753410461849e+00,
+	 8.399192354944e-01,  4.626406333315e+00,  2.388369299110e+00,
+	 1.573078646294e+00,  2.900775880867e+00,  2.482753349211e-01,
+	-1.252866663523e+00, -9.461035067327e-02, -1.702162525005e+01,
+	 4.012777854196e-01, -2.671675459565e+00, -2.157008537356e+00,
+	-1.885301049067e+00, -4.060872510365e+00, -5.531412309654e+00,
+	-8.773768561692e-01, -2.981997461892e+00, -2.708125769281e+00,
+	-2.070733228092e+00,  5.382380267126e+00, -1.409124404267e+01,
+	 7.957551721289e-01,  6.327704291092e+00,  3.721522996204e+00,
+	-1.328491639461e+00,  3.118487619975e+00,  2.058401480479e+00,
+	 1.516402736276e+00,  5.031384444130e-01, -8.185938163179e-01,
+	-4.800443070960e+00, -3.116501666214e+00, -1.808744366841e+01,
+	 2.916649469034e+00, -2.191632277969e+00, -2.054243881816e+00,
+	-3.042327186389e+00, -2.421092816485e+00, -3.639802435673e+00,
+	-6.441181678029e-01, -3.777336276928e+00, -3.613154156367e+00,
+	-3.066860590088e+00, -4.869376815950e+00, -3.047689591838e+00,
+	 1.252943229780e+00,  7.132948819558e+00,  2.878166004868e+00,
+	-1.135477341558e+00,  3.208338468776e+00,  2.139716096727e+00,
+	 1.408096203701e+00,  5.556784678295e-02, -2.564286970118e+00,
+	-3.914941677540e+00, -2.304977410456e+00, -1.796606200955e+01,
+	 2.660413334920e+00, -2.757195225164e+00, -3.645474573059e+00,
+	-3.618845571383e+00, -2.875164802643e+00, -4.141063210467e+00,
+	 7.223117961912e-01, -2.096137113553e+00, -4.263890114734e+00,
+	-6.042866779721e+00, -7.366581755986e+00, -5.327642310577e+00,
+	 9.303690897467e+01,  5.693248167150e+00,  3.531623574367e+00,
+	 1.736343164994e+00,  2.479303162059e+00,  3.991446696014e+00,
+	-1.615534578423e+01, -1.477458972653e+01,  1.514050621450e+00,
+	-1.264570441710e+01, -1.917764053845e+00,  1.018935344832e+00,
+	 3.304753521488e+00,  3.534026484252e+00,  3.817434601725e+00,
+	 3.073541557360e+00,  1.257848023690e+01,  2.445507097984e+00,
+	 2.269074240177e+00,  4.822876651696e+00,  4.247314768144e+00,
+	-1.413148855904e+00,  8.645112766494e-01, -5.606828428998e+00,
+	-1.437509557119e+01,  4.677240151748e+00,  2.719488440316e+00,
+	-2.775017412670e+00, -1.088611273287e+00, -3.618845571383e+00,
+	 3.267828806549e+00,  4.855767222409e+00, -1.562366168442e-01,
+	-1.816473444000e+01, -4.105912990416e+00, -4.344792921163e+00,
+	 1.282342896223e+01,  1.329704366766e+01,  7.830792488315e-01,
+	-4.865346579622e-01,  9.166912330762e+00, -1.007191597567e+00,
+	 2.849564574670e+00,  5.494486379864e+00,  2.849397904601e+00,
+	-8.507229338521e-01,  4.934039777925e-01, -3.417695766792e+00,
+	-1.497169980516e+01, -6.246579972538e-01,  2.229989106936e+00,
+	-3.182261114663e+00, -7.137383601767e+00, -5.973023955525e+00,
+	 1.836798978688e+00, -7.684814635687e-01, -1.748883572120e+00,
+	 1.733752303319e+00, -7.688467149045e+00, -5.146789834531e+00,
+	 1.032036931573e+00,  8.030710324664e+00,  3.033025904912e+00,
+	 9.165566070483e+00,  5.608363977668e+00, -4.210399384737e+00,
+	 2.376676716996e+00,  1.495806206700e-01,  1.240395017525e-01,
+	-1.035306549488e+01, -3.963736556695e+00, -6.713153494862e+00,
+	-1.276036805861e+01,  3.800883574870e-02,  1.709723512905e+00,
+	-2.453760706000e+00, -5.520248494528e+00, -3.862410953153e+00,
+	-1.801614127779e+00, -3.352197020544e+00, -4.673532379350e+00,
+	 1.425802571867e+00, -6.268679193732e+00, -5.304662936465e+00,
+	-3.250725426137e+00, -5.300941841616e+00, -1.485240321581e+00,
+	-2.817458265443e+00, -1.090411611619e+01, -2.126996365332e+00,
+	-2.113933007862e+00, -1.764751940509e+00, -6.137967782999e+00,
+	-1.815570294466e+00, -5.671742031674e+00, -3.035298035277e+00,
+	-1.796606200955e+01, -5.149036479730e+00, -4.112944929572e+00,
+	-3.328898053644e+00, -5.595969195406e+00, -6.302935190683e+00,
+	 6.996732306856e-01, -4.791239452346e-01, -4.915340817885e+00,
+	 4.066309282903e+00, -6.458748112774e+00, -5.223133603863e+00,
+	 9.290816092733e+01,  2.779369698098e+00, -1.061873030797e+01,
+	 2.167230955157e+00,  1.713590223900e+00,  3.357280593681e+00,
+	 5.955798164640e+00,  7.359884362462e-01,  3.903504901432e+00,
+	 2.897914106349e+00,  2.436584065765e+00,  3.431508301960e+00,
+	 5.087420698690e+00,  1.141123204030e+01,  3.333572246767e+00,
+	-2.426244342009e-01,  1.220984833694e+00,  8.510962617547e+00,
+	 9.268116694607e+00,  4.072427387263e-01, -2.051323545871e+00,
+	 1.408741408739e+00, -1.920294231742e+00,  1.927925368708e+00,
+	-1.205867682214e+01,  1.191850873101e+00, -1.835753035065e+01,
+	-5.324322134884e-01, -2.070733228092e+00,  1.347104620718e+00,
+	 3.603172949362e+00, -6.758884829443e-01, -6.245022779066e+00,
+	-1.453703516421e+00, -4.089386035084e+00,  4.089626870161e+00,
+	 5.248529057164e+00,  3.456540072900e+00, -5.235432807740e-01,
+	 1.006771630237e+01, -2.268249271026e+00,  6.666919054489e+00,
+	 7.338598223257e+00, -2.624870548749e+00, -1.083252126533e+00,
+	-2.072823293804e+00, -9.797334628981e-01,  5.809827535218e-01,
+	-1.889453730991e+01, -1.096611175365e+00,  5.549526644872e+00,
+	-3.490526700244e+00, -4.197823403104e+00, -3.080550414266e-01,
+	-5.642415176230e+00, -2.134427155471e+00, -3.597750020641e+00,
+	-7.297492607302e+00, -8.028801403943e+00,  2.388408241585e+00,
+	-5.184081626993e-01,  7.928391520504e+00,  2.419122824867e-01,
+	 7.587385098514e+00,  8.864833415614e+00,  4.753410461849e+00,
+	 1.721878827136e+00, -1.873004674726e+00, -2.758531095175e+00,
+	-4.223200701534e+00, -1.054583017588e+01,  4.059500730135e-01,
+	-2.149125395976e+01, -1.162782778495e+00,  2.988120556764e+00,
+	-4.369649749909e+00, -5.414316859672e+00, -2.925966214969e+00,
+	-2.531962724334e+00, -4.035453191726e+00, -4.236013802273e+00,
+	-3.499464928966e+00, -3.906907367151e+00,  1.717329660648e-01,
+	-3.441768233689e-01,  5.999536336859e+00, -3.712070198616e-01,
+	-5.424995482543e+00, -4.569239637934e+00,  2.557678059119e+00,
+	 1.782635634522e+00, -4.317054939110e+00, -3.458060319902e+00,
+	-1.175787178366e+00, -5.671742031674e+00, -2.304977410456e+00,
+	-2.103304812199e+01, -4.487563915455e+00,  1.733752303319e+00,
+	-3.195637320996e+00, -4.703580551709e+00, -3.083666913486e+00,
+	-3.122642508226e+00, -4.095791269288e+00, -5.089782964358e+00,
+	-3.842372777174e+00, -4.809065265750e+00,  9.543613125367e+01,
+	 3.041873824281e+00,  1.686640984030e+00,  1.406800506110e+00,
+	 1.020501379310e+00,  1.658673176060e+00, -1.519985714196e+01,
+	 1.709882678194e+00, -1.484005674089e+01, -1.386473226855e+01,
+	 5.593924666738e+00,  6.980515913471e+00,  4.677339742782e+00,
+	 2.926653816433e+00,  1.577704537606e+00,  1.070751525353e+01,
+	 2.729363586295e+00,  1.577704537606e+00,  1.020501379310e+00,
+	-1.007180511893e+00,  1.729966530416e+00, -3.275619006210e+00,
+	 3.445683261855e+00,  8.882315943526e-01, -1.519985714196e+01,
+	-1.747552032831e+00, -3.540298019642e-01, -3.914941677540e+00,
+	 1.729966530416e+00,  6.578391326512e-01,  2.203458007608e-01,
+	-4.740873293535e+00,  2.177868858619e+00, -2.140306424411e+01,
+	 3.607110079859e+00,  2.926653816433e+00,  2.779369698098e+00,
+	 1.800367798829e+00,  8.882315943526e-01,  9.028803811287e+00,
+	 1.213250787363e+01,  1.070751525353e+01,  1.658673176060e+00,
+	-1.699205803310e+00,  6.578391326512e-01, -7.697330341960e+00,
+	 1.686640984030e+00, -7.264649194424e-01, -1.484005674089e+01,
+	-1.289027284416e+00, -3.491328526191e+00, -3.788777598628e+00,
+	-3.540298019642e-01, -2.707724710007e+00,  2.177868858619e+00,
+	-3.458060319902e+00, -2.373284715575e+00, -2.001354624233e+00,
+	 2.521736977353e+00,  1.800367798829e+00,  3.041873824281e+00,
+	-6.753587189586e-01, -7.264649194424e-01,  9.090638552113e+00,
+	 8.661544541897e-01,  9.028803811287e+00,  1.709882678194e+00,
+	-1.502966327340e+00, -2.707724710007e+00, -5.253916633946e+00,
+	 1.406800506110e+00,  9.090638552113e+00, -1.386473226855e+01,
+	-1.083104463240e+01, -5.753465871563e+00, -6.496642146973e+00,
+	-3.491328526191e+00, -5.753465871563e+00, -2.373284715575e+00,
+	-3.708886399897e+00, -1.386209407304e+00,  4.705232533044e-01,
+	-1.007180511893e+00, -1.699205803310e+00, -1.747552032831e+00,
+	-1.502966327340e+00, -1.289027284416e+00, -1.083104463240e+01,
+	-3.275619006210e+00, -7.697330341960e+00, -4.740873293535e+00,
+	-3.196052351868e+00, -3.458060319902e+00, -1.815570294466e+00,
+	-3.914941677540e+00, -5.253916633946e+00, -2.140306424411e+01,
+	-1.815570294466e+00, -3.708886399897e+00, -3.157597834813e+00,
+	-3.788777598628e+00, -6.496642146973e+00, -2.001354624233e+00,
+	-3.157597834813e+00,  4.705232533044e-01,  1.588392649944e+00,
+	 9.809863073055e+01,  1.122972089771e+00,  3.517500545617e+00,
+	 8.273777261529e-01,  3.813867157833e+00,  2.324308770865e+00,
+	 1.774562871049e+00,  1.935123261318e+00,  2.285396484093e+00,
+	 2.763559732723e+00,  4.969935523010e+00, -7.097320861696e+00,
+	 3.047752985594e+00,  3.854178165127e+00,  4.353514092073e+00,
+	 7.199345387488e+00,  4.275172888550e+00, -1.564320152131e+00,
+	-4.197126666942e+00, -2.880723420834e+00, -4.564092393008e+00,
+	 4.628791464403e+00,  3.721982258708e+00, -1.652651858413e+00,
+	-3.623867046976e+01, -2.032638401305e+00, -2.853509113382e+00,
+	 2.357004646701e+00, -1.035265169900e+00, -2.966081719152e+00,
+	-5.225276657993e+00, -1.326771975566e+00, -4.370949407864e+00,
+	 3.346680124015e+00,  2.285141576036e+00,  7.928391520504e+00,
+	-1.728338669924e+00, -3.302633657468e-01, -1.597058633179e-01,
+	 4.965747295278e+00,  2.285008684803e+00,  6.434661435840e+00,
+	-2.670532264024e+00,  5.751503322452e+00, -9.738491668737e-01,
+	 1.550500625506e+00,  4.704092386074e+00, -1.113575604606e+00,
+	-1.803013077051e+01, -3.783015785345e+00, -1.978085165551e+00,
+	-8.220992832505e-01,  3.333428005631e+00, -2.686664818293e+00,
+	-6.245022779066e+00, -3.309819845396e+00, -3.527029313144e+00,
+	 2.241036691919e+00,  2.521206439850e+00,  8.019975900901e+00,
+	 3.595736760154e-01, -1.774776942331e+00, -1.493992392610e+00,
+	 3.721522996204e+00,  2.765442605035e+00, -1.298690101214e+00,
+	-3.243619297766e+00,  3.377851247095e+00, -2.998594331596e+00,
+	-8.236576663444e-02,  2.820725206637e+00, -1.077615858023e+00,
+	-1.695430235178e+01,  6.341081502003e+00, -1.319430480890e+01,
+	-4.024068644862e-01,  8.885832494799e-01, -2.782068047439e+00,
+	-4.338299165747e+00, -5.334855240480e+00, -5.496898625692e+00,
+	 2.471774491118e-01,  1.191916249158e+00,  6.125226003522e+00,
+	 1.158202353373e-01, -1.789765863900e+00, -8.529239837004e-01,
+	 2.168740291493e+00,  1.889720134756e+00, -4.734214937102e+00,
+	-4.740873293535e+00, -4.317054939110e+00, -6.137967782999e+00,
+	-2.564286970118e+00,  7.026949447723e-01, -3.315409063264e+00,
+	-1.816473444000e+01, -4.772120843622e+00, -2.905663794295e+00,
+	-2.904798893126e+00, -1.636068969221e+00, -3.571550258759e+00,
+	-3.993708883587e+00, -3.144905682561e+00, -3.313817106892e+00,
+	 9.364261020935e+01, -1.083438350932e+01,  1.830820307250e+00,
+	 8.971252047384e-01,  2.944674078974e+00,  1.654428549560e+00,
+	 1.878729158774e+00,  2.169936748497e+00,  2.388187317455e+00,
+	 6.064014729740e-01,  2.259724475421e+00,  1.147623960344e+01,
+	 2.602784094762e+00,  2.464543298102e+00, -1.374106848530e+00,
+	 1.144794431507e+00,  4.417972865159e+00, -6.054541608477e+00,
+	 1.478463607113e+00, -4.489830288734e+00, -3.199985588940e+00,
+	 1.048607983245e+00, -6.957410990949e-01, -2.552343844660e+00,
+	-1.529788411643e+01, -1.702162525005e+01, -4.519468385002e+00,
+	 2.925649669577e-01,  7.339190997350e-01, -9.738491668737e-01,
+	-1.650357334376e+00, -2.127545451841e+00, -5.388236331488e-01,
+	 2.715103187041e+00,  5.809827535218e-01, -1.072808052753e+01,
+	-2.951705755836e-01, -1.884389987614e-01, -4.572240886436e+00,
+	 1.481474730499e+00,  2.372229096380e+00, -4.105549062524e+00,
+	 2.798436080348e-01, -1.913832939540e+00,  9.062747972680e+00,
+	-2.484889463177e+00, -4.731308905270e+00, -2.986793871441e+00,
+	-1.782249160683e+01,  3.974636535102e+00,  7.710727118341e+00,
+	-2.188194744040e+00, -4.012142341002e+00, -9.797334628981e-01,
+	-2.268571295538e+00, -2.596374925752e+00,  3.195508595240e+00,
+	-2.677921010531e-01,  1.550500625506e+00,  1.106760359143e+01,
+	-2.016610530473e-01, -1.560256694684e-01,  4.012777854196e-01,
+	 6.512658752919e-01,  1.639389940471e+00, -5.858496993319e+00,
+	 1.654800292539e+00, -1.534521447602e+00, -1.280039341631e+00,
+	-8.764506148640e-01, -2.130686870214e+00, -2.777953483681e+00,
+	-1.870964526614e+01,  3.790957392383e+00,  7.672480561843e+00,
+	 7.595055124937e+00, -2.675382762403e+00, -1.181689608179e+01,
+	-3.810993393584e+00, -3.159505913850e+00,  1.620757515090e+00,
+	 8.290716070726e-01,  4.298464435759e-01,  1.212892946348e+01,
+	 1.605009937700e+00,  2.474312357149e+00,  9.187825916397e-01,
+	-5.826420729107e-02,  1.889720134756e+00, -7.697330341960e+00,
+	 1.782635634522e+00, -1.764751940509e+00,  5.556784678295e-02,
+	-1.460894852541e+00, -2.228084886420e-01, -3.417695766792e+00,
+	-2.158847452393e+01,  1.701081515768e+00, -2.617622763510e+00,
+	-2.301633129172e+00, -6.078625248680e-01, -2.459597136416e+00,
+	-2.752131659222e+00, -1.690305723896e+00,  9.835583459969e+01,
+	 4.813011069853e+00,  2.115403018659e+00,  9.082357548086e-01,
+	 3.273675383866e+00,  2.382632629644e+00,  3.479598641330e+00,
+	 5.510653782647e+00,  2.436977552096e+00,  3.512837651510e+00,
+	-8.392910900020e+00,  3.721822544441e+00,  2.824122585137e+00,
+	-5.887966196285e+00,  1.160665176664e-01, -2.442229848891e-01,
+	-6.658124915945e+00, -3.348585249309e-02, -5.290379121478e+00,
+	-2.350726516785e+00,  3.013022099523e-01, -2.576970659118e+00,
+	-4.227967275861e+00,  1.942035111048e+00, -3.619480238401e+01,
+	-1.485642957200e+00,  9.091988927309e-01, -4.052264477968e+00,
+	-4.564092393008e+00, -1.349970109104e+00, -2.884468624642e+00,
+	-1.395355716380e+00,  5.739832940490e-01,  4.059500730135e-01,
+	 8.664816344825e+00,  8.278274107761e-01,  6.983596632957e-02,
+	 1.124628046224e-01,  2.598718034329e+00,  8.429278307196e-01,
+	-5.024674488049e+00,  4.487654448981e-01, -4.489830288734e+00,
+	-1.280039341631e+00, -2.290046014199e+00,  5.172500727818e+00,
+	-1.715286422616e+00, -6.222952963445e-02, -1.839768658979e+01,
+	-3.770402423486e-01, -1.796657275996e+00,  4.381494580787e+00,
+	-1.920294231742e+00, -2.400155132297e+00, -1.757735704956e+00,
+	 7.238317266126e-01,  1.103964626815e-01, -8.236576663444e-02,
+	 7.736240594672e+00,  1.552700795700e+00,  8.405012374180e-01,
+	 2.916649469034e+00,  2.435144885289e-01,  5.169930158098e-01,
+	-3.869614355508e+00,  2.741216104640e+00, -2.158681597749e+00,
+	 1.386873238215e+00, -7.623302751877e-02, -2.905504501743e+00,
+	-4.330044494768e+00,  9.264816652456e-01, -1.732201712213e+01,
+	 1.103961864310e-01, -2.373314797010e+00,  4.445580631797e+00,
+	-2.225683045697e+00,  8.389963324371e+00, -1.273599228229e+01,
+	 1.685547656676e+00, -4.914832430175e-01,  6.134406739680e-01,
+	 7.332794443735e+00,  1.061763072627e+00, -7.894357475659e-02,
+	 2.183456166343e+00,  9.187825916397e-01,  2.168740291493e+00,
+	-3.275619006210e+00,  2.557678059119e+00, -2.113933007862e+00,
+	 1.408096203701e+00,  1.819684527024e+00, -2.548408267874e+00,
+	-5.606828428998e+00,  1.882415022401e+00, -1.678778152128e+01,
+	 2.914347521061e+00,  5.453315589581e-01, -3.451302164383e+00,
+	-4.225560845873e+00, -4.993383036552e+00, -4.698931478856e+00,
+	 9.213653555158e+01, -1.240197707428e+01,  2.136487764326e+00,
+	-1.268143958737e+01, -3.100571294301e-02,  1.445291230623e+00,
+	-9.637049213501e-01,  3.325173908952e+00,  2.014153207221e+00,
+	 1.291796501772e+00,  1.163250472437e+01,  1.971893025908e+00,
+	 5.304757044775e-01,  4.266228303961e+00,  1.204362151995e+00,
+	-5.101307646314e+00,  1.699545123050e-02, -4.330044494768e+00,
+	 3.736196427945e+00,  3.357905241379e+00, -1.214529288135e+00,
+	-3.668400173658e+00, -1.830795891540e+00, -3.042327186389e+00,
+	-1.624024783257e+01,  7.179343504372e+00,  3.370991107910e-01,
+	-1.695430235178e+01, -2.029318493937e+00, -2.707398102478e+00,
+	-2.370334911737e+00,  2.772592109608e+00,  4.072427387263e-01,
+	-1.523629515259e+00,  1.038041091126e+01, -7.747762643662e-01,
+	 6.514720168175e-01,  4.365016616731e+00, -1.439488806184e-01,
+	-2.059814455931e+00, -2.345152774570e+00, -2.777953483681e+00,
+	 4.417972865159e+00, -4.504859032840e+00, -1.958838045730e+00,
+	-3.647307715090e+00, -5.798544476761e+00, -6.034279734737e+00,
+	-1.514655589180e+01, -1.145824542711e+00, -7.372084845887e-01,
+	 2.988120556764e+00, -2.514072324466e+00, -4.208463205027e+00,
+	 7.294880514924e+00, -3.838702456029e+00, -1.564320152131e+00,
+	-2.057180131659e+00, -1.004187954766e+01, -1.491969648685e+00,
+	-1.199224329591e+00, -1.876281433685e+00, -4.452361553933e+00,
+	-6.120579894729e-01, -1.727083074403e-01, -3.907958631133e+00,
+	-2.442229848891e-01, -7.057934112183e+00, -3.346504759611e+00,
+	-1.530715715401e+00, -4.404450157996e+00, -3.406546463371e+00,
+	-1.609492043731e+01,  5.682943307355e+00, -1.051231285301e+00,
+	 4.339529153064e+00, -3.820102520079e+00, -3.363540848300e+00,
+	 7.969979784510e+00,  1.204590183564e+01, -2.571977408589e-01,
+	 8.616272062245e+00,  8.119638109618e+00, -1.951760420809e+00,
+	-7.894357475659e-02,  2.474312357149e+00, -8.529239837004e-01,
+	-1.083104463240e+01, -4.569239637934e+00, -2.126996365332e+00,
+	 2.139716096727e+00,  1.934531324629e-01,  5.092808644586e-02,
+	-2.453760706000e+00, -6.598060784486e+00, -3.260778869354e+00,
+	-1.955882182498e+01,  2.904878235750e+00, -1.749310225963e+00,
+	 2.574727399912e+00, -3.789224026054e+00, -2.546638573012e+00,
+	 9.623288235143e+01,  4.012808078943e+00, -1.087519161753e+01,
+	 2.262909316539e+00,  3.589747706759e+00,  3.357250305437e+00,
+	 4.962414278088e+00, -1.753649010648e-01,  2.994880547066e+00,
+	 1.139822559534e+01,  1.633643980228e+00,  1.972105926837e+00,
+	 2.686559002880e+00, -1.439488806184e-01, -1.901016383406e+00,
+	-9.667636843036e-01, -1.715286422616e+00,  7.541952293392e+00,
+	 2.149466681851e+00, -2.654682888356e+00, -6.226323306043e+00,
+	 1.121857935227e+00, -1.885301049067e+00,  7.393128167836e+00,
+	-1.139997753142e+01, -3.768706863233e-01, -1.803013077051e+01,
+	 7.525234379727e-01, -3.937935079379e+00,  1.866096847607e+00,
+	 3.090711690084e+00, -2.624870548749e+00,  6.246025085862e-01,
+	-9.047939385522e+00, -1.154084704986e+00,  2.346709136573e+00,
+	 3.185412846199e+00, -1.032676984279e+00, -3.293908636271e+00,
+	-1.135866212704e+00, -2.986793871441e+00,  2.372229096380e+00,
+	-8.653044894920e+00, -1.662599489702e+00, -2.694134261887e+00,
+	-3.624537397210e+00, -3.060995013950e+00,  2.630941222738e+00,
+	-1.931723779729e+01, -9.810006159352e-01,  5.549526644872e+00,
+	-7.376802657608e+00, -6.688376913594e+00,  1.114849345277e-01,
+	-3.155154912480e+00,  6.434661435840e+00, -8.735476814748e-01,
+	 9.136909585644e+00, -1.673735807736e+00,  2.482753349211e-01,
+	-2.853263034420e+00, -4.422053721042e+00, -1.737247980996e+00,
+	-2.546662985140e+00, -2.743959194151e+00,  8.429278307196e-01,
+	-5.504786348968e+00, -3.804934109543e+00, -3.647307715090e+00,
+	-3.382738058823e+00, -3.838214998904e+00,  1.351338164399e+00,
+	-1.772148135538e+01, -1.782358778089e+00,  2.345641452191e+00,
+	-3.410687068000e+00, -2.615177265849e+00,  6.636919693627e-01,
+	 1.727656652568e+00,  7.515026392630e+00, -1.054670361388e+00,
+	 1.826606628208e+01,  8.119638109618e+00,  1.061763072627e+00,
+	 1.605009937700e+00, -1.789765863900e+00, -1.289027284416e+00,
+	-5.424995482543e+00, -1.090411611619e+01,  3.208338468776e+00,
+	-9.010289531177e-01, -9.691804166041e-03, -3.182261114663e+00,
+	-4.033039103607e+00, -3.782715174312e+00,  1.185705429959e+00,
+	-1.836290956335e+01, -2.040819721128e+00,  1.557584945579e+00,
+	-3.796295917225e+00, -3.350310623590e+00,  9.265781171538e+01,
+	 2.101138762341e+00, -1.464638524846e+01, -1.257370718421e+01,
+	 3.003809127256e+00,  4.686679421839e+00, -6.145094317617e-01,
+	 4.031072889344e+00,  1.145973465451e+00,  1.072870140559e+01,
+	-6.429579141658e-01,  2.927674572077e+00, -1.214529288135e+00,
+	-2.661628305516e+00, -6.016766285328e-01, -3.869614355508e+00,
+	 2.021752152485e+00,  1.946059431946e-01,  6.818137073657e-02,
+	-3.546148341208e+00,  2.776161185327e-01, -4.800443070960e+00,
+	 1.758326144612e+00,  2.081597593152e+00, -1.759874022665e+01,
+	-3.243619297766e+00,  2.667203715066e+00, -1.784818972042e+01,
+	 1.271906854840e+00,  1.456835912736e+00,  1.191850873101e+00,
+	 1.785842841723e+00,  2.973373472682e+00,  8.665782512095e+00,
+	-3.046752274588e+00,  6.460187774569e-01, -2.654682888356e+00,
+	-4.534521658718e+00, -5.206693234587e-01, -5.858496993319e+00,
+	-6.957410990949e-01, -4.827974267738e+00,  4.026522121836e+00,
+	-1.737247980996e+00, -2.561686886301e+00, -3.939033477671e+00,
+	-1.026121687826e-01, -2.325746351568e+00, -1.532857981946e+01,
+	-2.758531095175e+00, -5.406379421492e-01,  2.776917641371e+00,
+	 2.289702072485e-01, -5.415887533009e-01, -1.652651858413e+00,
+	-1.413873420260e+00,  2.138899835333e+00, -7.065293465216e+00,
+	 6.733606045257e+00, -4.687836102042e+00, -3.051996146791e+00,
+	-1.645666919851e+00, -6.272583443811e-01, -9.362511260365e-01,
+	-2.576970659118e+00, -5.738447820655e+00, -3.026129191361e+00,
+	-6.120579894729e-01, -4.401385147200e+00, -5.720215332299e+00,
+	-1.195359061504e+00,  2.166518531248e-01, -1.516687251732e+01,
+	-3.106713406855e+00,  3.806369942815e+00,  4.870831977946e+00,
+	 7.523583977178e-01,  2.223763996573e+00,  1.914982132685e-01,
+	-1.378319765033e+00, -1.054670361388e+00,  8.616272062245e+00,
+	 7.332794443735e+00,  1.212892946348e+01,  1.158202353373e-01,
+	-1.502966327340e+00, -3.712070198616e-01, -2.817458265443e+00,
+	-1.135477341558e+00,  7.938407298816e+00,  6.922074314520e-01,
+	-1.035306549488e+01, -1.142992047117e+00, -4.240272168066e+00,
+	-2.273036169484e+00, -7.023213833831e-01, -2.078294739554e+01,
+	-1.682922109043e+00,  3.427218701392e-01,  1.859023837738e+00,
+	 9.821959150608e+01,  3.470374939446e+00,  3.015212998027e+00,
+	 2.766598686302e+00,  4.825798459014e+00,  3.957918939460e+00,
+	 3.233504094688e+00, -7.239767441242e+00,  4.276523016489e+00,
+	 2.931824983821e+00,  2.669645857372e-01, -4.452361553933e+00,
+	-4.779862067372e+00, -2.658844328545e+00, -4.227967275861e+00,
+	 4.480723672471e+00,  7.195832776668e-01, -3.051996146791e+00,
+	-5.346237433529e+00, -2.272390005762e+00, -2.369407090090e+00,
+	 5.828892244413e+00,  4.663671824417e+00, -1.402969120339e+00,
+	-3.623867046976e+01, -1.198321946146e+00, -3.449183212854e+00,
+	 8.923842269424e-01, -2.064016879210e-02, -1.873004674726e+00,
+	-8.315160260822e-01,  6.703579013408e+00,  1.055281165474e+00,
+	 9.342946892489e-01, -1.778203751877e+00, -4.422053721042e+00,
+	-5.159253821751e+00, -3.292143368560e+00, -2.552343844660e+00,
+	 1.639389940471e+00,  2.629500276460e+00, -2.536797335050e+00,
+	-6.226323306043e+00, -3.780929602403e+00, -5.379060010957e-01,
+	 3.750277738450e+00,  3.187005775045e+00, -6.070285922930e-01,
+	-1.835753035065e+01, -3.580841026880e+00, -2.434341346827e+00,
+	-5.036848859206e-01,  5.594761745824e-01, -1.298690101214e+00,
+	-1.015503675000e+00,  6.858095159714e+00, -2.884333608863e-01,
+	-8.185938163179e-01, -8.118151978033e-01,  2.946699587343e+00,
+	-3.546148341208e+00, -2.208488723481e+00, -4.732801646161e+00,
+	 5.169930158098e-01, -1.203608631096e+00, -2.348871074856e+00,
+	-3.668400173658e+00, -4.703701697788e+00, -1.615027943979e+00,
+	 3.911737512984e+00,  5.308777594883e+00, -5.611144369651e-01,
+	-1.735427217697e+01, -5.292774084780e+00, -4.175255724829e+00,
+	 1.301301039819e+00,  2.873097176222e+00,  3.390613764552e-01,
+	 1.914982132685e-01,  7.515026392630e+00, -2.571977408589e-01,
+	 6.134406739680e-01,  4.298464435759e-01,  6.125226003522e+00,
+	-1.747552032831e+00,  5.999536336859e+00, -1.485240321581e+00,
+	 2.878166004868e+00,  6.184546668867e-01, -2.999511866818e-01,
+	-2.775017412670e+00,  6.358503366212e+00, -1.192430452262e+01,
+	 1.305191602080e+00,  2.528696028619e+00, -1.461896057301e+00,
+	-1.676345773738e+01, -2.932848967644e+00, -2.004258413994e+00,
+	 9.243478191755e+01, -1.176026535132e+01,  1.358244315756e-01,
+	 1.922411765947e+00,  2.619439411635e-01,  1.200368596232e+00,
+	 8.175100648609e-03,  1.172889267798e+01,  1.576985794401e+00,
+	-2.339857766248e-01, -1.958838045730e+00, -4.433495513999e+00,
+	-2.042071667166e+00, -5.024674488049e+00, -1.910848175947e+00,
+	-7.714344754110e-01,  4.026522121836e+00, -5.159253821751e+00,
+	-3.798019435484e-01, -1.252866663523e+00,  4.191960109920e-01,
+	-1.770001316586e+00,  5.262491555474e+00, -2.670532264024e+00,
+	-1.473039643827e+01, -1.556112555510e+01,  1.968441873893e+00,
+	-6.852767854379e-01, -1.096611175365e+00, -1.921536633195e+00,
+	-1.387544175728e+00, -1.044597404652e+01, -1.204202359331e+00,
+	-6.408915895272e+00, -1.662599489702e+00, -2.987189924986e+00,
+	-2.003550519916e+00, -4.105549062524e+00, -4.731308905270e+00,
+	-1.398642048157e-02,  9.603787116111e-01, -3.293908636271e+00,
+	-3.077435936246e+00, -3.319274027117e+00, -1.154801614962e+00,
+	-6.478289948338e-02,  2.679127684595e+00, -1.083252126533e+00,
+	-1.761002533043e+01,  4.342318919497e+00, -5.461624410772e-01,
+	 4.382269223286e+00, -1.113575604606e+00,  2.614615759291e+00,
+	-1.113726751284e+00,  9.355764391920e+00, -2.157008537356e+00,
+	 2.652319949112e-01, -2.536797335050e+00, -4.534521658718e+00,
+	-1.302373383824e+00, -4.870875296598e+00,  5.172500727818e+00,
+	-9.951241911026e-01, -1.484446144539e+00, -2.059814455931e+00,
+	-2.183652474307e+00, -2.276400718738e+00, -1.367359361817e+00,
+	-8.597379993843e-02,  3.144999304244e+00, -6.222813356798e-01,
+	-1.888968834032e+01,  3.230429487931e+00,  2.863560846756e+00,
+	 3.566848312537e+00,  2.873097176222e+00,  2.223763996573e+00,
+	 1.727656652568e+00,  1.204590183564e+01, -4.914832430175e-01,
+	 8.290716070726e-01,  1.191916249158e+00, -1.699205803310e+00,
+	-3.441768233689e-01, -5.300941841616e+00,  7.132948819558e+00,
+	-2.303620264107e-01,  9.347771452562e-01, -8.507229338521e-01,
+	-4.199563822339e+00, -4.408844372209e+00,  8.542775590209e+00,
+	 9.889986917676e+00,  6.592615705799e-01, -9.391775317018e+00,
+	-1.985823507029e+01,  2.310785139207e+00,  1.017027964604e+02,
+	 1.726845253088e+00,  3.815096866028e+00,  2.227047516773e+00,
+	 1.780892716323e+00,  1.937316936543e+00, -8.413959821550e+00,
+	 1.268434943283e+00, -5.448488874442e+00, -3.346504759611e+00,
+	-4.262693413594e+00, -1.395018355619e+00, -6.658124915945e+00,
+	 8.353369742732e-01, -1.559066702295e+00, -3.026129191361e+00,
+	-4.779862067372e+00, -8.463871436685e-02, -5.367991489997e+00,
+	 1.637433315043e+00, -1.213912204195e+00,  2.834483922745e-01,
+	-4.197126666942e+00,  2.445496216654e+00, -3.543624885691e+01,
+	 8.596065312587e-01, -2.088462288343e+00, -1.162782778495e+00,
+	-6.108946848553e-01, -2.083447986722e-01,  7.794731202832e+00,
+	 5.906337922250e-01, -2.887436182623e+00, -3.804934109543e+00,
+	-4.433495513999e+00, -1.386657796946e+00, -6.054541608477e+00,
+	-2.130686870214e+00,  9.672803486650e-02, -1.484446144539e+00,
+	-1.901016383406e+00, -1.830141397350e+00, -3.966875133960e+00,
+	-3.246826373966e-01,  3.170094086437e-01,  1.560103408002e+00,
+	-2.051323545871e+00, -3.589715520263e-01, -1.741343395461e+01,
+	-5.480636670649e-01,  2.157309568944e+00, -1.077615858023e+00,
+	-1.958013294144e-01,  1.082854675591e+00,  8.129106728840e+00,
+	-2.054243881816e+00,  2.028722332829e+00, -2.348871074856e+00,
+	-2.661628305516e+00,  1.216733034440e-01, -4.148582240389e+00,
+	-2.905504501743e+00,  1.321445445491e+00,  5.449336095195e+00,
+	-5.101307646314e+00, -1.749311050860e+00, -4.090708814997e+00,
+	 1.009816006726e-01,  1.026057205460e+00,  1.818529234691e+00,
+	-9.833693428724e-01,  1.025589378621e+00, -1.577146963971e+01,
+	 1.958825048787e+00,  2.863560846756e+00,  1.301301039819e+00,
+	 7.523583977178e-01,  6.636919693627e-01,  7.969979784510e+00,
+	 1.685547656676e+00,  1.620757515090e+00,  2.471774491118e-01,
+	-1.007180511893e+00,  1.717329660648e-01, -3.250725426137e+00,
+	 1.252943229780e+00,  1.396560743047e+00,  8.878029250864e+00,
+	-1.413148855904e+00, -8.175456302712e-01, -2.905716965306e+00,
+	 1.160476605362e+00,  1.887729392864e+00,  1.014709932633e+01,
+	-1.436616697598e+00,  8.607179336733e+00, -2.969341464189e+01,
+	 9.505495735115e+01, -1.069005025805e+01,  7.318037589393e+00,
+	-9.377746354727e+00,  3.492491654036e+00,  5.119857452701e+00,
+	 1.328184057653e+01,  5.422451484902e+00,  5.760912464081e+00,
+	 8.607179336733e+00,  2.786433422247e+00, -4.993383036552e+00,
+	 2.093205223347e+00,  3.179031156918e+00,  3.967757426157e+00,
+	-2.932848967644e+00,  2.676029407895e+00, -7.366581755986e+00,
+	-1.483039790023e+00,  3.266755196989e+00,  1.430732204785e+00,
+	-3.144905682561e+00, -1.397583410209e+00, -4.232996855601e+00,
+	-1.360046201300e+01,  8.697969762798e+00,  5.572690529472e+00,
+	-1.477531242987e+01,  1.674442526061e+00, -2.883507708059e-01,
+	 1.313791984167e+01,  5.253510921143e+00,  4.225686987885e+00,
+	-1.985823507029e+01,  2.196864864521e-01, -2.752131659222e+00,
+	 1.173906954842e+00, -2.768990801558e+00,  3.574412544294e+00,
+	-3.796295917225e+00, -1.303981381195e+01, -8.689360397115e+00,
+	-3.003794026140e+00, -2.995157365797e+00,  9.635617303076e-01,
+	-3.842372777174e+00, -7.042524271406e+00, -7.622281008237e+00,
+	-1.246585631575e+01,  3.172391086813e+00,  6.049670909548e+00,
+	 5.194870527249e+00, -3.375776337465e+00, -3.050183393459e+00,
+	 1.203682255248e+01, -4.532123253494e-01,  4.638619375456e+00,
+	 3.427218701392e-01, -4.737815471167e+00, -5.298103627098e+00,
+	 2.833151261579e-01, -2.806772497137e+00,  4.240561051655e+00,
+	-3.789224026054e+00, -7.395046382972e+00, -6.526068911173e+00,
+	-6.787946198354e+00, -6.461984370919e+00, -9.337869758298e+00,
+	-6.798110169058e+00, -8.672472286849e+00, -1.082038661554e+01,
+	-1.577146963971e+01,  3.230429487931e+00, -4.175255724829e+00,
+	 4.870831977946e+00, -2.615177265849e+00, -3.363540848300e+00,
+	-1.273599228229e+01, -3.159505913850e+00, -5.496898625692e+00,
+	 4.705232533044e-01, -3.906907367151e+00, -5.304662936465e+00,
+	-3.047689591838e+00, -5.511706462672e+00, -6.034433774569e+00,
+	-6.458748112774e+00, -6.507284340056e+00, -7.221397104460e+00,
+	-7.427056300412e+00, -6.575829631605e+00, -1.188936352316e+01,
+	-7.475078119413e+00, -7.265582980223e+00, -9.417930088631e+00,
+	 9.876456812015e+01,  7.186962222119e+00, -7.531441074160e+00,
+	 3.324055776318e+00,  4.909188564705e+00,  1.367630178786e+01,
+	 3.324055776318e+00,  3.325173908952e+00,  1.025589378621e+00,
+	 6.915876876354e-01,  8.389963324371e+00,  1.197611596008e+00,
+	 1.537288826910e+00,  4.686679421839e+00, -5.292774084780e+00,
+	 1.150992026923e+00, -4.869376815950e+00,  6.915876876354e-01,
+	 1.369583519417e+00,  2.788911106807e+00, -5.334855240480e+00,
+	 4.935111399241e-01, -6.403934677445e+00,  1.108837371529e+01,
+	-7.531441074160e+00,  5.087420698690e+00, -1.329658859453e+01,
+	 1.537288826910e+00, -9.289028439852e-01,  1.528332153163e+01,
+	 4.909188564705e+00,  4.962414278088e+00, -1.888968834032e+01,
+	 1.369583519417e+00, -3.810993393584e+00,  6.064014729740e-01,
+	-3.814401433261e+00,  1.922411765947e+00, -3.410687068000e+00,
+	-5.727554489443e+00, -6.533192547079e+00,  1.150992026923e+00,
+	-3.781255896646e+00,  4.935111399241e-01, -3.499464928966e+00,
+	-1.245122148057e+01, -9.795986009264e+00,  8.350945013180e+00,
+	-1.329658859453e+01,  4.969935523010e+00,  8.838926299961e+00,
+	-3.814401433261e+00, -4.442735442430e+00, -5.554027882823e+00,
+	-9.289028439852e-01,  4.825798459014e+00,  3.806369942815e+00,
+	-3.781255896646e+00, -7.034368675500e+00,  2.436977552096e+00,
+	-4.442735442430e+00,  3.815096866028e+00, -3.820102520079e+00,
+	-7.033410586955e+00, -9.339638657485e+00, -5.727554489443e+00,
+	-7.033410586955e+00, -1.245122148057e+01, -6.358618853284e+00,
+	-7.534254263843e+00, -8.672472286849e+00,  1.025589378621e+00,
+	-1.888968834032e+01, -5.292774084780e+00,  3.806369942815e+00,
+	-3.410687068000e+00, -3.820102520079e+00,  8.389963324371e+00,
+	-3.810993393584e+00, -5.334855240480e+00, -1.386209407304e+00,
+	-3.499464928966e+00, -6.268679193732e+00, -4.869376815950e+00,
+	-7.034368675500e+00, -6.403934677445e+00, -6.268679193732e+00,
+	-6.358618853284e+00, -7.936794656978e+00, -6.533192547079e+00,
+	-9.339638657485e+00, -9.795986009264e+00, -7.936794656978e+00,
+	-8.672472286849e+00, -1.078158270166e+01,  9.866846183067e+01,
+	 7.020622315125e+00, -1.200204628982e+01, -7.462086587433e+00,
+	 3.473358105703e+00,  1.413276130267e+01,  2.836545365296e+00,
+	-8.175456302712e-01,  1.455288447581e+00,  1.882415022401e+00,
+	 4.708114569212e+00,  8.237339231789e-01,  3.052664247082e+00,
+	 6.358503366212e+00,  1.001012164120e+00, -2.875164802643e+00,
+	 2.914760062705e+00,  1.123942412490e+00, -1.299453121381e+00,
+	-4.772120843622e+00,  7.687474184356e-01, -6.872364324784e+00,
+	 5.279814519166e+00,  4.981788127554e+00, -1.096961967365e+01,
+	 1.838393288341e+00,  6.659350941825e+00, -1.311200218983e+01,
+	 1.261198349478e+00,  1.123693803017e+01,  4.091907345714e+00,
+	-4.199563822339e+00,  2.256917174712e+00, -2.158847452393e+01,
+	 2.005509099976e+00, -4.701498066259e+00,  2.996086680657e+00,
+	-4.033039103607e+00, -5.386554332896e+00, -5.446412219730e+00,
+	 6.253261181329e-01, -6.284733820849e+00, -1.017282612133e+00,
+	-3.195637320996e+00, -8.709380485627e+00, -8.565954662100e+00,
+	 3.662371906904e+00,  3.138542869433e-01, -1.123852794783e+01,
+	-2.065603792014e-01,  1.035291238444e+00,  4.462265434849e+00,
+	 2.754969555675e+00,  6.290326627743e+00,  1.390819755889e+00,
+	-1.142992047117e+00, -3.082620429656e+00, -3.894449256185e+00,
+	 1.761706826520e+00, -6.473646125492e+00,  2.177039435268e+00,
+	-6.598060784486e+00, -1.148563216579e+01, -8.746458503959e+00,
+	-5.775897341950e+00, -7.812126645647e+00, -9.226553962378e+00,
+	-7.153225536754e+00, -6.358618853284e+00, -6.798110169058e+00,
+	-9.833693428724e-01, -6.222813356798e-01, -1.735427217697e+01,
+	-3.106713406855e+00,  2.345641452191e+00,  4.339529153064e+00,
+	-2.225683045697e+00, -1.181689608179e+01, -4.338299165747e+00,
+	-3.708886399897e+00, -4.236013802273e+00,  1.425802571867e+00,
+	-3.066860590088e+00, -3.766983086450e+00, -7.186374008370e+00,
+	-5.595969195406e+00, -4.498964447094e+00, -6.849281041372e+00,
+	-4.537220624508e+00, -7.333543992606e+00, -8.492762726010e+00,
+	-7.368673938686e+00, -6.507284340056e+00, -8.154484891569e+00,
+	 1.027398406169e+02,  5.105290795136e+00,  6.256703588025e+00,
+	 1.553497773043e+01,  5.851345473560e+00,  2.772592109608e+00,
+	-3.589715520263e-01,  5.012432830290e-01, -2.400155132297e+00,
+	 5.591878380032e+00,  3.944318498646e+00,  1.456835912736e+00,
+	-3.580841026880e+00,  3.033581165885e-01,  5.382380267126e+00,
+	 3.620786177255e+00,  3.466674258585e+00,  2.729409832148e+00,
+	-3.309819845396e+00, -4.054854472275e-01, -3.604350182078e+00,
+	 9.540219358805e+00,  9.597857089532e+00,  5.248529057164e+00,
+	-3.230954098932e+01,  3.122192814028e+00, -4.252364233704e-01,
+	-5.297355703432e+00,  6.538915679134e+00,  3.090711690084e+00,
+	-1.761002533043e+01,  1.065902122993e+00, -2.268571295538e+00,
+	 2.715103187041e+00, -1.596199793905e+00, -6.852767854379e-01,
+	-7.376802657608e+00, -7.534231667437e+00, -8.503146417492e+00,
+	 6.889578795694e-01, -1.966365972395e+00, -2.973185056749e+00,
+	-7.297492607302e+00, -6.107134651104e+00, -7.906071484181e+00,
+	 6.442216870324e+00,  3.844652598198e+00,  2.285141576036e+00,
+	-1.410073884227e+01, -3.104067776564e+00, -3.312437917730e+00,
+	 8.919070783472e+00,  9.921424615324e-01, -2.064016879210e-02,
+	-5.406379421492e-01, -5.177633541737e+00, -6.136786920084e+00,
+	 5.739832940490e-01, -2.207789382568e+00, -2.088462288343e+00,
+	-2.514072324466e+00, -8.649381218050e+00, -8.442029225694e+00,
+	-3.846811263871e+00, -3.444091491449e+00, -2.604466249750e+00,
+	-9.226553962378e+00, -1.245122148057e+01, -9.337869758298e+00,
+	 1.818529234691e+00,  3.144999304244e+00, -5.611144369651e-01,
+	-1.516687251732e+01, -1.782358778089e+00, -1.051231285301e+00,
+	 4.445580631797e+00, -2.675382762403e+00, -2.782068047439e+00,
+	-2.373284715575e+00, -4.035453191726e+00, -4.673532379350e+00,
+	-3.613154156367e+00, -7.656472312125e+00, -4.097909925188e+00,
+	-7.688467149045e+00, -8.709380485627e+00, -8.096313054729e+00,
+	-7.889141118361e+00, -6.834192645476e+00, -5.838502223296e+00,
+	-7.043492627925e+00, -7.042524271406e+00, -6.759646591125e+00,
+	 9.472986961586e+01, -8.617100239577e+00,  4.157778776832e+00,
+	 1.515807479432e+01,  4.266228303961e+00, -1.749311050860e+00,
+	 1.125026306443e+00,  9.264816652456e-01,  2.139107897563e+00,
+	 1.322885379964e+00,  2.927674572077e+00, -4.703701697788e+00,
+	 3.419865282762e-01, -2.421092816485e+00,  1.123382800455e+00,
+	 1.013261080393e+00,  1.508312842266e+00,  6.341081502003e+00,
+	-2.345113472698e-01, -5.590329449613e+00,  5.848106058619e+00,
+	 5.851345473560e+00,  9.268116694607e+00, -1.183304436912e+00,
+	-1.221029955188e+01, -1.461128114527e+01,  2.189875166806e+00,
+	 1.380487633063e+01,  2.686559002880e+00, -2.183652474307e+00,
+	 8.218535512191e-01, -1.870964526614e+01,  1.144794431507e+00,
+	-4.324789098534e+00, -2.339857766248e-01, -3.382738058823e+00,
+	-7.067304336916e+00, -7.354590356675e+00, -3.320010418410e-01,
+	-2.798104359033e+00, -2.051918278685e+00, -4.369649749909e+00,
+	-8.649381218050e+00, -7.617857162435e+00,  4.836447461486e+00,
+	 3.393355614214e+00,  4.275172888550e+00,  1.509690807520e+00,
+	-1.807862096117e+01,  4.920799540570e+00,  1.342642077732e+00,
+	-9.900970877507e+00,  2.669645857372e-01, -4.401385147200e+00,
+	-5.359658964852e+00,  1.213873959232e+00,  1.160665176664e-01,
+	-4.299479662328e+00, -5.448488874442e+00, -4.404450157996e+00,
+	-6.288040678272e+00, -6.017673154983e+00, -6.479503335927e+00,
+	-8.417369966035e+00, -3.444091491449e+00, -7.812126645647e+00,
+	-7.033410586955e+00, -6.461984370919e+00,  1.026057205460e+00,
+	-8.597379993843e-02,  5.308777594883e+00,  2.166518531248e-01,
+	-1.772148135538e+01,  5.682943307355e+00, -2.373314797010e+00,
+	 7.595055124937e+00,  8.885832494799e-01, -5.753465871563e+00,
+	-2.531962724334e+00, -3.352197020544e+00, -3.777336276928e+00,
+	-7.342122503549e+00, -1.433053659009e+00, -5.520248494528e+00,
+	-1.148563216579e+01, -7.153856720932e+00, -5.704666298488e+00,
+	-7.002796935801e+00, -3.456265130000e+00, -6.935441441047e+00,
+	-7.395046382972e+00, -5.736269002802e+00,  1.028730003366e+02,
+	 2.523572268464e+00,  1.380487633063e+01,  4.365016616731e+00,
+	-1.830141397350e+00,  2.069499853586e+00, -6.222952963445e-02,
+	 2.691558853325e+00,  3.102568921365e+00,  6.460187774569e-01,
+	-3.780929602403e+00,  5.984784451369e-01, -4.060872510365e+00,
+	 2.072072528618e+00,  3.598566356990e+00,  9.779043988224e-02,
+	-3.783015785345e+00,  3.069145866814e-01,  3.953003306613e+00,
+	 4.934647502956e+00,  6.538915679134e+00,  7.338598223257e+00,
+	-4.246873562198e-01,  6.065370204487e+00, -3.191897391655e+01,
+	 4.910371536422e+00, -5.212362886627e+00,  3.185412846199e+00,
+	-3.077435936246e+00,  1.811359527949e+00, -1.782249160683e+01,
+	 1.481474730499e+00, -4.942174896818e+00, -6.408915895272e+00,
+	-3.624537397210e+00, -5.198151386951e+00, -8.528145525572e+00,
+	 5.157818673528e-01, -4.393480557732e+00, -3.731881441943e+00,
+	-3.490526700244e+00, -7.534231667437e+00, -1.008696088605e+01,
+	 3.179496450517e+00, -2.724975798147e-01,  2.285008684803e+00,
+	-6.623816763928e-02,  5.324696750840e-01, -1.785741159658e+01,
+	 2.900775880867e+00,  9.550415950134e+00, -1.778203751877e+00,
+	-2.561686886301e+00, -3.969164669566e+00, -3.797429310574e+00,
+	 2.598718034329e+00, -3.217985067747e+00, -2.887436182623e+00,
+	-5.798544476761e+00, -7.067304336916e+00, -9.948184353734e+00,
+	-4.330844233499e+00, -6.479503335927e+00, -3.846811263871e+00,
+	-5.775897341950e+00, -5.727554489443e+00, -6.787946198354e+00,
+	 1.009816006726e-01, -1.367359361817e+00,  3.911737512984e+00,
+	-1.195359061504e+00,  1.351338164399e+00, -1.609492043731e+01,
+	 1.103961864310e-01,  7.672480561843e+00, -4.024068644862e-01,
+	-3.491328526191e+00, -2.925966214969e+00, -1.801614127779e+00,
+	-6.441181678029e-01, -3.881796594818e+00, -1.825286897668e+00,
+	-7.137383601767e+00, -5.386554332896e+00, -6.790029484350e+00,
+	-3.002472086703e+00, -4.707676646464e+00, -3.583326707102e+00,
+	-8.510243837528e+00, -1.303981381195e+01, -1.017404823574e+01,
+	 9.645187011145e+01, -1.200894313004e+01,  1.385279655634e+01,
+	 1.887729392864e+00,  3.381035142867e+00,  5.453315589581e-01,
+	 3.618552637972e+00, -1.125058937662e+01,  1.317289517217e+00,
+	 2.528696028619e+00, -2.497536897801e+00, -2.096137113553e+00,
+	 1.051582537081e+00,  1.611588167261e+00, -1.390592210966e+00,
+	-1.636068969221e+00,  4.506886272349e-01, -3.167986426739e+00,
+	 4.400439543013e+00,  3.942845800978e+00,  6.773275636975e-01,
+	-7.848880696999e+00,  1.067529385234e+00,  5.141362124411e-01,
+	-1.149379246006e+01,  7.212473530872e+00,  1.039773108504e+01,
+	 9.889986917676e+00,  8.495879428693e-02, -2.301633129172e+00,
+	 2.176865652904e+00, -1.698465874147e+01,  1.879421398968e+00,
+	-1.836290956335e+01, -4.707676646464e+00, -4.054354957953e+00,
+	-3.802109614301e-01, -4.118520727573e+00, -2.422870916489e+00,
+	-3.122642508226e+00, -6.834192645476e+00, -5.374326968317e+00,
+	 3.113726507635e+00, -1.055105268277e+00,  2.967502268886e+00,
+	 3.041613548867e-01, -2.682093844821e+00, -3.514546276947e+00,
+	-1.041791013693e+01,  2.568940779971e+00,  1.194165228981e+01,
+	-7.023213833831e-01, -3.070522677661e+00, -6.233402098510e+00,
+	 2.465329951839e+00,  4.018754001348e+00,  1.396541830474e+00,
+	 2.904878235750e+00, -7.002796935801e+00, -6.618484122596e+00,
+	-9.948184353734e+00, -6.017673154983e+00, -8.442029225694e+00,
+	-8.746458503959e+00, -9.339638657485e+00, -6.526068911173e+00,
+	-4.090708814997e+00, -2.276400718738e+00, -1.615027943979e+00,
+	-5.720215332299e+00, -3.838214998904e+00, -3.406546463371e+00,
+	-1.732201712213e+01,  3.790957392383e+00, -1.319430480890e+01,
+	-6.496642146973e+00, -5.414316859672e+00, -3.862410953153e+00,
+	-3.639802435673e+00,  5.020346227853e+00, -2.111362245076e+00,
+	-4.791239452346e-01, -7.333543992606e+00, -6.194243921487e+00,
+	-6.723903431767e+00, -3.202198302064e+00, -6.509297316739e+00,
+	-9.621412295266e+00, -6.575829631605e+00, -4.700763575425e+00,
+	 9.472986961586e+01,  1.163250472437e+01,  1.026057205460e+00,
+	 1.123382800455e+00, -2.373314797010e+00,  3.052739500993e+00,
+	-1.221029955188e+01,  1.145973465451e+00,  5.308777594883e+00,
+	-3.320010418410e-01, -3.777336276928e+00,  1.125026306443e+00,
+	 8.218535512191e-01,  1.508312842266e+00,  8.885832494799e-01,
+	-2.051918278685e+00, -1.433053659009e+00,  6.130800956538e+00,
+	 5.105290795136e+00, -2.426244342009e-01,  3.393355614214e+00,
+	 1.322885379964e+00, -9.900970877507e+00,  1.170347912756e+01,
+	-8.617100239577e+00,  1.139822559534e+01, -8.597379993843e-02,
+	 1.013261080393e+00,  7.595055124937e+00,  2.602784094762e+00,
+	-1.807862096117e+01,  8.175100648609e-03, -1.772148135538e+01,
+	-6.479503335927e+00, -5.704666298488e+00,  3.419865282762e-01,
+	-5.359658964852e+00, -2.345113472698e-01, -2.531962724334e+00,
+	-3.444091491449e+00, -3.456265130000e+00,  5.399160989020e+00,
+	-1.183304436912e+00,  3.854178165127e+00,  1.509690807520e+00,
+	-4.324789098534e+00, -4.299479662328e+00,  7.855724348795e+00,
+	-1.461128114527e+01, -7.239767441242e+00,  2.166518531248e-01,
+	-2.798104359033e+00, -7.342122503549e+00,  3.721822544441e+00,
+	 4.920799540570e+00,  1.937316936543e+00,  5.682943307355e+00,
+	-8.417369966035e+00, -7.002796935801e+00, -7.067304336916e+00,
+	-6.288040678272e+00, -8.649381218050e+00, -1.148563216579e+01,
+	-7.033410586955e+00, -7.395046382972e+00, -1.749311050860e+00,
+	-2.183652474307e+00, -4.703701697788e+00, -4.401385147200e+00,
+	-3.382738058823e+00, -4.404450157996e+00,  9.264816652456e-01,
+	-1.870964526614e+01,  6.341081502003e+00, -5.753465871563e+00,
+	-4.369649749909e+00, -5.520248494528e+00, -2.421092816485e+00,
+	 1.213873959232e+00, -5.590329449613e+00, -3.352197020544e+00,
+	-7.812126645647e+00, -6.935441441047e+00, -7.354590356675e+00,
+	-6.017673154983e+00, -7.617857162435e+00, -7.153856720932e+00,
+	-6.461984370919e+00, -5.736269002802e+00,  9.213653555158e+01,
+	 7.969979784510e+00, -1.624024783257e+01, -7.894357475659e-02,
+	 3.587693382515e+00,  1.038041091126e+01,  2.136487764326e+00,
+	-2.571977408589e-01, -1.514655589180e+01,  2.139716096727e+00,
+	 1.699545123050e-02, -2.345152774570e+00,  3.370991107910e-01,
+	-8.529239837004e-01, -7.372084845887e-01,  5.092808644586e-02,
+	 5.109253424275e+00,  1.291796501772e+00,  3.357280593681e+00,
+	-3.838702456029e+00,  3.357905241379e+00, -1.876281433685e+00,
+	 4.110489866789e+00,  1.971893025908e+00, -1.240197707428e+01,
+	 1.204590183564e+01,  7.179343504372e+00,  2.474312357149e+00,
+	 1.830820307250e+00, -1.004187954766e+01, -3.100571294301e-02,
+	 8.119638109618e+00, -1.609492043731e+01, -1.955882182498e+01,
+	-1.830795891540e+00, -1.727083074403e-01, -2.029318493937e+00,
+	-4.569239637934e+00, -1.051231285301e+00, -1.749310225963e+00,
+	 6.161962224305e+00, -1.523629515259e+00,  8.273777261529e-01,
+	-2.057180131659e+00, -4.504859032840e+00, -7.057934112183e+00,
+	 3.513668774140e+00, -7.747762643662e-01, -1.268143958737e+01,
+	 8.616272062245e+00, -1.145824542711e+00,  1.934531324629e-01,
+	 4.813011069853e+00, -1.491969648685e+00,  1.445291230623e+00,
+	-1.951760420809e+00,  5.682943307355e+00,  2.904878235750e+00,
+	-5.798544476761e+00, -4.404450157996e+00, -2.514072324466e+00,
+	-6.598060784486e+00, -3.820102520079e+00, -3.789224026054e+00,
+	-5.101307646314e+00, -2.059814455931e+00, -3.668400173658e+00,
+	-6.120579894729e-01, -3.647307715090e+00, -1.530715715401e+00,
+	-4.330044494768e+00, -2.777953483681e+00, -1.695430235178e+01,
+	-1.083104463240e+01,  2.988120556764e+00, -2.453760706000e+00,
+	-3.042327186389e+00, -3.907958631133e+00, -2.707398102478e+00,
+	-2.126996365332e+00,  4.339529153064e+00,  2.574727399912e+00,
+	-6.034279734737e+00, -3.406546463371e+00, -4.208463205027e+00,
+	-3.260778869354e+00, -3.363540848300e+00, -2.546638573012e+00,
+	 1.017027964604e+02,  8.129106728840e+00,  3.479598641330e+00,
+	 1.396560743047e+00,  3.170094086437e-01,  7.523583977178e-01,
+	 3.015212998027e+00,  7.794731202832e+00,  2.042384101878e+00,
+	 1.321445445491e+00,  9.672803486650e-02, -1.958013294144e-01,
+	 2.285396484093e+00, -6.108946848553e-01,  1.741819384095e+00,
+	 1.014709932633e+01,  1.818529234691e+00,  1.717329660648e-01,
+	 2.445496216654e+00,  1.216733034440e-01, -8.463871436685e-02,
+	 1.160476605362e+00,  1.009816006726e-01,  6.636919693627e-01,
+	-1.176026535132e+01,  1.082854675591e+00,  2.169936748497e+00,
+	 1.620757515090e+00, -1.213912204195e+00,  2.863560846756e+00,
+	 3.589747706759e+00, -8.413959821550e+00,  1.258798490474e+01,
+	 2.028722332829e+00, -1.559066702295e+00,  2.157309568944e+00,
+	 2.436584065765e+00,  1.780892716323e+00,  2.277526143913e+00,
+	 8.878029250864e+00,  1.560103408002e+00,  2.471774491118e-01,
+	 2.834483922745e-01, -1.386657796946e+00, -1.395018355619e+00,
+	 1.252943229780e+00, -3.246826373966e-01,  1.301301039819e+00,
+	-1.257370718421e+01, -2.083447986722e-01,  2.012813830950e+00,
+	 1.685547656676e+00,  1.637433315043e+00,  1.958825048787e+00,
+	 1.445291230623e+00,  1.937316936543e+00,  1.396541830474e+00,
+	-2.887436182623e+00, -5.448488874442e+00, -2.088462288343e+00,
+	 2.177039435268e+00,  3.815096866028e+00,  4.240561051655e+00,
+	 5.449336095195e+00, -1.484446144539e+00, -2.348871074856e+00,
+	-3.026129191361e+00, -3.804934109543e+00, -3.346504759611e+00,
+	-2.905504501743e+00, -2.130686870214e+00, -1.077615858023e+00,
+	-1.386473226855e+01, -1.162782778495e+00,  1.709723512905e+00,
+	-2.054243881816e+00,  8.353369742732e-01, -5.480636670649e-01,
+	 1.018935344832e+00,  2.227047516773e+00,  1.619280123897e+00,
+	 5.906337922250e-01,  1.268434943283e+00,  8.596065312587e-01,
+	 7.880721262169e-01,  1.726845253088e+00,  1.908460539134e+00,
+	 9.278539280947e+01,  8.405012374180e-01,  1.141590726853e+01,
+	-6.425326534270e-01,  1.758326144612e+00, -2.884333608863e-01,
+	-1.483566270793e+01,  2.058401480479e+00,  1.077796497590e+01,
+	 8.807311070374e+00,  7.365669004754e-01, -1.493992392610e+00,
+	 4.016475882967e-01, -3.746196596630e-01,  7.303495620369e+00,
+	 3.620786177255e+00,  1.347104620718e+00, -6.736333090493e-01,
+	 2.419060466050e+00,  6.528888148068e-01,  4.421542495743e+00,
+	 2.072072528618e+00,  7.393128167836e+00,  9.355764391920e+00,
+	-1.113906708122e+01, -1.560256694684e-01, -4.519468385002e+00,
+	 8.821771107067e-01,  4.191960109920e-01, -1.673735807736e+00,
+	-1.785741159658e+01, -1.853897438606e+01, -3.320966481405e+00,
+	-1.139783705659e+01, -7.218108880326e-01,  8.864833415614e+00,
+	-3.312437917730e+00, -1.326291246903e+00, -7.941333429609e-01,
+	 1.658950675181e+00,  2.357004646701e+00, -1.434264082578e+00,
+	-3.328976638183e+00, -4.008933027451e-01,  1.416742656010e+00,
+	-8.708702396588e-02,  5.828892244413e+00, -7.065293465216e+00,
+	-1.573887625141e+01, -1.295866938924e+00, -1.485642957200e+00,
+	-1.049541374956e+00,  1.637433315043e+00, -1.491969648685e+00,
+	 4.920799540570e+00,  4.018754001348e+00, -3.217985067747e+00,
+	-4.299479662328e+00, -2.207789382568e+00, -6.473646125492e+00,
+	-4.442735442430e+00, -2.806772497137e+00,  1.321445445491e+00,
+	-9.951241911026e-01, -1.203608631096e+00, -5.738447820655e+00,
+	-5.504786348968e+00, -7.057934112183e+00, -7.623302751877e-02,
+	-8.764506148640e-01,  2.820725206637e+00,  9.090638552113e+00,
+	-2.149125395976e+01,  3.800883574870e-02, -2.191632277969e+00,
+	-1.858416284147e+00, -1.679905024308e+00, -4.210399384737e+00,
+	 4.462265434849e+00,  2.735392557554e+00, -1.371630235095e+00,
+	-3.514546276947e+00, -2.810046656598e+00, -3.882329085277e+00,
+	-3.050183393459e+00, -2.028026724099e+00,  9.835583459969e+01,
+	 1.819684527024e+00, -1.796657275996e+00,  7.332794443735e+00,
+	 3.273675383866e+00,  6.983596632957e-02,  1.915727932382e+00,
+	-7.623302751877e-02, -2.290046014199e+00,  7.736240594672e+00,
+	 3.517500545617e+00,  8.664816344825e+00,  2.032442919958e+00,
+	-3.451302164383e+00,  4.445580631797e+00,  2.557678059119e+00,
+	-1.349970109104e+00,  2.741216104640e+00,  1.942035111048e+00,
+	 2.914347521061e+00,  1.103961864310e-01,  1.061763072627e+00,
+	 2.382632629644e+00,  1.552700795700e+00, -1.083438350932e+01,
+	 9.187825916397e-01,  9.091988927309e-01, -4.914832430175e-01,
+	 2.115403018659e+00,  2.824122585137e+00,  1.637282693123e+00,
+	 2.435144885289e-01,  3.013022099523e-01,  1.103964626815e-01,
+	 1.713590223900e+00, -8.392910900020e+00,  1.086704431938e+01,
+	-2.548408267874e+00,  4.381494580787e+00,  2.168740291493e+00,
+	-4.052264477968e+00,  4.487654448981e-01, -3.348585249309e-02,
+	 1.408096203701e+00, -3.770402423486e-01,  6.134406739680e-01,
+	 9.082357548086e-01,  8.278274107761e-01, -1.235829584516e+01,
+	 2.183456166343e+00, -1.485642957200e+00,  1.685547656676e+00,
+	 4.813011069853e+00,  3.721822544441e+00,  2.465329951839e+00,
+	 2.598718034329e+00,  1.160665176664e-01,  5.739832940490e-01,
+	 1.761706826520e+00,  2.436977552096e+00,  2.833151261579e-01,
+	-2.905504501743e+00,  5.172500727818e+00,  5.169930158098e-01,
+	-2.576970659118e+00,  8.429278307196e-01, -2.442229848891e-01,
+	 1.386873238215e+00, -1.280039341631e+00, -8.236576663444e-02,
+	 1.406800506110e+00,  4.059500730135e-01, -1.276036805861e+01,
+	 2.916649469034e+00, -2.350726516785e+00,  7.238317266126e-01,
+	 3.991446696014e+00,  3.512837651510e+00,  2.185227736102e+00,
+	 1.124628046224e-01, -5.887966196285e+00, -1.395355716380e+00,
+	 3.870260047783e+00,  5.510653782647e+00,  3.321916614923e+00,
+	 9.274903098977e+01,  2.259172468563e+00,  2.898209759739e+00,
+	 6.184546668867e-01, -3.095239320961e+00, -2.757195225164e+00,
+	-1.594801584324e+01, -1.274971040765e+01,  5.869048258890e-01,
+	 7.026949447723e-01, -2.509662021919e+00, -2.908995640068e+00,
+	 1.321372680238e+01,  1.106142156362e+01,  3.701107506882e+00,
+	 2.822352104994e+00,  1.414393533018e+00, -5.677761772974e-02,
+	 4.070223633294e+00,  3.492461983959e+00, -1.583198579187e-01,
+	-2.303620264107e-01,  8.643816426594e+00, -1.460894852541e+00,
+	-1.579056035613e+01, -2.644618580543e+00,  1.282483886717e+00,
+	-9.010289531177e-01, -3.881796594818e+00, -2.107380789316e+00,
+	 9.824378689400e-01, -1.801697508096e+01, -7.011503139073e-01,
+	-2.103304812199e+01, -7.656472312125e+00, -3.352106445628e+00,
+	 1.028996681257e+00,  7.756203532263e+00,  1.107359958167e+00,
+	-7.832123648192e+00, -2.782476175734e+00, -1.858416284147e+00,
+	 2.939312025270e+00,  1.375543002819e-01,  1.962703249421e+00,
+	 7.938407298816e+00,  4.480661864288e+00, -2.737960496632e+00,
+	-1.235829584516e+01, -1.295866938924e+00,  2.012813830950e+00,
+	 1.934531324629e-01, -7.342122503549e+00, -6.233402098510e+00,
+	-3.797429310574e+00,  1.213873959232e+00, -6.136786920084e+00,
+	-3.894449256185e+00, -7.034368675500e+00, -5.298103627098e+00,
+	-4.148582240389e+00, -4.870875296598e+00, -4.732801646161e+00,
+	-9.362511260365e-01, -2.743959194151e+00, -3.907958631133e+00,
+	-2.158681597749e+00, -1.534521447602e+00, -2.998594331596e+00,
+	-5.253916633946e+00, -1.054583017588e+01, -6.713153494862e+00,
+	-1.808744366841e+01, -2.509964234417e+00, -3.041364628188e+00,
+	-5.149036479730e+00, -3.766983086450e+00, -4.439221020099e+00,
+	 8.461822412184e-01,  5.020346227853e+00, -4.183611478610e+00,
+	-4.384660366959e-02, -5.511706462672e+00, -4.219257171245e+00,
+	 9.751061653521e+01,  2.973373472682e+00,  3.187005775045e+00,
+	-1.386393553465e+00, -2.981997461892e+00,  2.419060466050e+00,
+	 1.334722732491e+00,  1.318733494951e+00,  3.333428005631e+00,
+	-1.894520575050e+00, -1.998506975319e+00,  4.575982226581e+00,
+	 3.122192814028e+00,  1.006771630237e+01,  2.391819140060e+00,
+	 6.934297291324e+00,  1.842842926719e+00,  6.953438358800e+00,
+	 6.065370204487e+00, -9.047939385522e+00, -6.478289948338e-02,
+	 1.180692471133e+00, -2.188194744040e+00, -2.951705755836e-01,
+	-3.415167569242e+01, -1.387544175728e+00, -1.931723779729e+01,
+	-4.393480557732e+00, -5.043942478076e+00, -1.107489668175e+00,
+	-3.227869660420e+00, -1.740899821978e+00, -5.642415176230e+00,
+	-1.966365972395e+00, -2.662946707408e+00,  1.998923641038e+00,
+	-7.134802820707e-02, -3.302633657468e-01, -9.485128715451e-01,
+	 7.459574286895e+00, -1.139783705659e+01,  4.626406333315e+00,
+	 2.734614520218e+00,  6.703579013408e+00, -2.325746351568e+00,
+	-5.866818187379e-01,  4.480661864288e+00,  8.278274107761e-01,
+	-1.573887625141e+01, -2.083447986722e-01, -1.145824542711e+00,
+	-2.798104359033e+00, -3.070522677661e+00, -3.969164669566e+00,
+	-5.359658964852e+00, -5.177633541737e+00, -3.082620429656e+00,
+	-3.781255896646e+00, -4.737815471167e+00,  1.216733034440e-01,
+	-1.302373383824e+00, -2.208488723481e+00, -6.272583443811e-01,
+	-2.546662985140e+00, -1.727083074403e-01,  2.741216104640e+00,
+	 1.654800292539e+00,  3.377851247095e+00, -2.707724710007e+00,
+	-4.223200701534e+00, -3.963736556695e+00, -3.116501666214e+00,
+	-1.801697508096e+01, -3.396993803252e+00, -7.684814635687e-01,
+	-6.284733820849e+00, -6.029988499579e+00, -3.217070863418e+00,
+	-4.118520727573e+00, -4.357839888469e+00, -1.784468438871e+00,
+	-2.995157365797e+00, -3.351793695112e+00,  9.265781171538e+01,
+	 1.914982132685e-01, -1.026121687826e-01, -1.135477341558e+00,
+	-6.016766285328e-01, -5.206693234587e-01, -1.759874022665e+01,
+	 1.158202353373e-01, -1.532857981946e+01,  6.922074314520e-01,
+	 1.645442417103e+00,  4.031072889344e+00,  7.359884362462e-01,
+	-5.415887533009e-01,  1.946059431946e-01, -4.687836102042e+00,
+	 1.144420990562e+01,  1.072870140559e+01,  4.012808078943e+00,
+	 2.223763996573e+00,  2.081597593152e+00,  1.212892946348e+01,
+	 2.944674078974e+00,  2.138899835333e+00, -1.464638524846e+01,
+	-1.054670361388e+00, -1.195359061504e+00, -2.273036169484e+00,
+	 2.776161185327e-01, -6.272583443811e-01,  2.667203715066e+00,
+	-3.712070198616e-01, -1.516687251732e+01, -2.078294739554e+01,
+	 2.305473049319e+00,  1.785842841723e+00,  2.324308770865e+00,
+	-1.413873420260e+00, -4.827974267738e+00, -5.738447820655e+00,
+	 8.547452986833e-01,  8.665782512095e+00,  2.101138762341e+00,
+	-1.378319765033e+00, -2.325746351568e+00,  7.938407298816e+00,
+	 9.082357548086e-01, -7.065293465216e+00, -1.257370718421e+01,
+	 8.616272062245e+00,  2.166518531248e-01, -7.023213833831e-01,
+	-2.561686886301e+00, -4.401385147200e+00, -5.406379421492e-01,
+	-1.142992047117e+00,  3.806369942815e+00,  3.427218701392e-01,
+	-2.661628305516e+00, -4.534521658718e+00, -3.546148341208e+00,
+	-1.645666919851e+00, -1.737247980996e+00, -6.120579894729e-01,
+	-3.869614355508e+00, -5.858496993319e+00, -3.243619297766e+00,
+	-1.502966327340e+00, -2.758531095175e+00, -1.035306549488e+01,
+	-4.800443070960e+00, -9.362511260365e-01, -1.784818972042e+01,
+	-2.817458265443e+00, -3.106713406855e+00, -1.682922109043e+00,
+	-3.939033477671e+00, -5.720215332299e+00,  2.776917641371e+00,
+	-4.240272168066e+00,  4.870831977946e+00,  1.859023837738e+00,
+	 9.821959150608e+01,  1.055281165474e+00,  1.329883501280e+00,
+	-1.203608631096e+00,  2.629500276460e+00, -1.015503675000e+00,
+	 1.774562871049e+00, -8.315160260822e-01,  1.530384771424e+00,
+	-1.461896057301e+00, -5.611144369651e-01,  5.999536336859e+00,
+	-1.198321946146e+00, -2.208488723481e+00, -2.272390005762e+00,
+	 1.305191602080e+00,  3.911737512984e+00,  7.515026392630e+00,
+	 3.470374939446e+00,  6.858095159714e+00,  1.654428549560e+00,
+	 4.298464435759e-01,  4.663671824417e+00,  2.873097176222e+00,
+	-1.087519161753e+01,  4.276523016489e+00,  2.061253084934e+00,
+	-8.118151978033e-01,  7.195832776668e-01,  5.594761745824e-01,
+	 3.903504901432e+00,  3.233504094688e+00,  3.067456987635e+00,
+	-2.999511866818e-01, -6.070285922930e-01,  6.125226003522e+00,
+	-1.402969120339e+00, -3.292143368560e+00, -2.658844328545e+00,
+	 2.878166004868e+00,  3.750277738450e+00,  3.390613764552e-01,
+	 2.101138762341e+00,  6.703579013408e+00,  1.962703249421e+00,
+	 6.134406739680e-01,  5.828892244413e+00,  1.301301039819e+00,
+	-1.268143958737e+01, -7.239767441242e+00,  1.194165228981e+01,
+	-1.778203751877e+00,  2.669645857372e-01, -2.064016879210e-02,
+	 1.390819755889e+00,  4.825798459014e+00,  4.638619375456e+00,
+	-2.348871074856e+00, -2.536797335050e+00,  2.946699587343e+00,
+	-3.051996146791e+00, -4.422053721042e+00, -4.452361553933e+00,
+	 5.169930158098e-01,  1.639389940471e+00, -1.298690101214e+00,
+	 1.709882678194e+00, -1.873004674726e+00,  1.240395017525e-01,
+	-8.185938163179e-01,  4.480723672471e+00, -5.036848859206e-01,
+	-1.264570441710e+01,  3.957918939460e+00,  1.771529416317e+00,
+	 9.342946892489e-01,  2.931824983821e+00,  8.923842269424e-01,
+	 1.174164861452e+00,  2.766598686302e+00,  2.642660373778e+00,
+	 9.425527881076e+01,  2.388369299110e+00, -3.320966481405e+00,
+	 2.082554746308e-01, -4.808481371397e-01, -1.597058633179e-01,
+	-7.753290987648e-01, -3.298152349902e-01, -2.142159352763e+00,
+	 6.889578795694e-01, -3.080550414266e-01,  1.687976331812e+00,
+	-1.107489668175e+00, -2.988316750226e-01, -1.501427402001e+00,
+	 5.157818673528e-01,  2.630941222738e+00, -1.044597404652e+01,
+	 2.763374819590e+00, -1.884389987614e-01,  7.710727118341e+00,
+	 1.206920851205e+00, -1.154801614962e+00, -1.154084704986e+00,
+	-3.191897391655e+01, -1.425152331147e+01,  5.664638623962e+00,
+	 1.842842926719e+00, -1.617854918273e+00, -2.268249271026e+00,
+	-4.252364233704e-01,  1.194626791439e-01,  2.265350295737e+00,
+	-1.130079104060e+00, -8.220992832505e-01, -2.429527208685e+00,
+	-2.306679629314e-01,  6.528888148068e-01, -8.773768561692e-01,
+	-6.166355187074e-03,  3.750277738450e+00,  8.665782512095e+00,
+	 2.734614520218e+00,  1.375543002819e-01, -3.770402423486e-01,
+	-8.708702396588e-02, -3.246826373966e-01, -7.747762643662e-01,
+	-1.461128114527e+01,  2.568940779971e+00,  9.550415950134e+00,
+	-9.900970877507e+00,  9.921424615324e-01,  6.290326627743e+00,
+	-9.289028439852e-01, -4.532123253494e-01,  2.028722332829e+00,
+	 2.652319949112e-01, -8.118151978033e-01, -4.687836102042e+00,
+	-2.853263034420e+00, -1.876281433685e+00,  2.435144885289e-01,
+	 6.512658752919e-01,  2.765442605035e+00,  9.028803811287e+00,
+	 1.721878827136e+00,  1.495806206700e-01,  5.031384444130e-01,
+	-5.677761772974e-02,  8.245104493751e-02, -1.007191597567e+00,
+	-1.311200218983e+01,  4.189548880299e+00, -1.163019868429e+00,
+	 5.141362124411e-01, -2.176212322976e-01, -2.274835626551e+00,
+	-2.883507708059e-01, -6.752871022338e-03,  9.805012380843e+01,
+	-2.191632277969e+00, -2.671675459565e+00, -1.328491639461e+00,
+	 1.892148962805e+00,  8.399192354944e-01,  1.542832718953e+00,
+	-4.263890114734e+00, -3.613154156367e+00, -2.304977410456e+00,
+	 4.420997494786e+00, -3.116501666214e+00, -1.833095037434e+00,
+	 7.223117961912e-01, -6.441181678029e-01,  3.208338468776e+00,
+	 5.929515168959e-01,  3.118487619975e+00,  3.225811061359e+00,
+	 5.556784678295e-02,  8.312065129088e-01,  7.132948819558e+00,
+	 2.005945896488e+00,  6.913295825353e+00, -1.137718812299e+01,
+	 5.031384444130e-01,  1.236200425223e+00,  6.327704291092e+00,
+	 2.853564764686e+00,  5.246599889640e+00,  1.836172744510e+00,
+	-3.645474573059e+00, -2.708125769281e+00, -2.564286970118e+00,
+	 6.334450731912e+00, -9.461035067327e-02, -1.168805996024e+00,
+	 2.660413334920e+00, -8.773768561692e-01,  2.878166004868e+00,
+	 8.547452986833e-01,  4.626406333315e+00,  2.939312025270e+00,
+	 1.408096203701e+00,  1.416742656010e+00,  1.252943229780e+00,
+	 3.513668774140e+00,  7.855724348795e+00, -1.041791013693e+01,
+	 2.900775880867e+00,  1.342642077732e+00,  8.919070783472e+00,
+	 2.754969555675e+00, -5.554027882823e+00,  1.203682255248e+01,
+	-2.054243881816e+00, -2.157008537356e+00, -8.185938163179e-01,
+	 6.733606045257e+00,  2.482753349211e-01, -1.199224329591e+00,
+	 2.916649469034e+00,  4.012777854196e-01,  3.721522996204e+00,
+	 8.661544541897e-01,  4.753410461849e+00,  2.376676716996e+00,
+	 1.516402736276e+00, -9.408018770319e-01,  7.957551721289e-01,
+	 4.395057575409e+00,  7.421329582258e+00, -1.119770460073e+01,
+	 1.573078646294e+00,  2.098094156850e-02,  3.147559236067e-01,
+	 2.445448251375e+00,  7.684382200426e+00,  3.958633206773e+00,
+	 9.278539280947e+01, -1.113906708122e+01,  7.365669004754e-01,
+	 2.820725206637e+00, -7.218108880326e-01, -1.679905024308e+00,
+	-1.831705872341e+00,  5.012432830290e-01,  1.408741408739e+00,
+	 1.658950675181e+00, -6.425326534270e-01, -8.708702396588e-02,
+	 2.053018965971e+00,  2.069499853586e+00, -9.667636843036e-01,
+	-9.951241911026e-01,  8.807311070374e+00, -8.764506148640e-01,
+	 1.478463607113e+00, -3.328976638183e+00, -2.042071667166e+00,
+	-5.504786348968e+00, -3.217985067747e+00, -1.371630235095e+00,
+	-1.483566270793e+01, -1.573887625141e+01,  4.016475882967e-01,
+	-2.149125395976e+01, -2.207789382568e+00, -2.810046656598e+00,
+	 5.802880078672e+00, -6.736333090493e-01, -2.880723420834e+00,
+	-1.434264082578e+00,  8.821771107067e-01, -1.049541374956e+00,
+	-1.168805996024e+00,  6.528888148068e-01, -2.658844328545e+00,
+	-5.738447820655e+00, -1.139783705659e+01, -1.858416284147e+00,
+	-3.348585249309e-02, -4.008933027451e-01, -1.395018355619e+00,
+	-7.057934112183e+00, -4.299479662328e+00, -3.514546276947e+00,
+	-1.785741159658e+01,  4.920799540570e+00, -3.312437917730e+00,
+	 4.462265434849e+00, -4.442735442430e+00, -3.050183393459e+00,
+	 8.129106728840e+00,  9.355764391920e+00, -2.884333608863e-01,
+	-7.065293465216e+00, -1.673735807736e+00, -1.491969648685e+00,
+	 8.405012374180e-01, -1.560256694684e-01, -1.493992392610e+00,
+	 9.090638552113e+00,  8.864833415614e+00, -4.210399384737e+00,
+	 2.058401480479e+00, -1.295866938924e+00, -3.746196596630e-01,
+	 3.800883574870e-02, -6.473646125492e+00, -3.882329085277e+00,
+	-1.853897438606e+01,  4.018754001348e+00, -1.326291246903e+00,
+	 2.735392557554e+00, -2.806772497137e+00, -2.028026724099e+00,
+	 9.792792542430e+01,  1.764784258659e+00,  4.704092386074e+00,
+	 2.208468171966e-01, -1.370020588042e+00,  2.273467378119e+00,
+	 1.065902122993e+00, -2.072823293804e+00,  1.318232892828e+00,
+	 1.180692471133e+00,  1.206920851205e+00,  2.711511890228e+00,
+	 1.811359527949e+00, -1.135866212704e+00, -1.398642048157e-02,
+	-1.150515194929e+01, -2.484889463177e+00,  2.798436080348e-01,
+	-3.169654876424e+00, -2.003550519916e+00, -8.653044894920e+00,
+	-4.942174896818e+00, -4.277825771633e+00,  2.763374819590e+00,
+	-3.415167569242e+01, -2.530913169521e-01, -1.889453730991e+01,
+	-1.596199793905e+00, -9.866031210242e-01, -8.387401553610e-01,
+	-7.559316642334e-01,  5.751503322452e+00, -1.802310081476e+00,
+	-1.412924525600e+00,  8.821771107067e-01, -9.461035067327e-02,
+	-2.306679629314e-01, -3.292143368560e+00, -4.827974267738e+00,
+	 7.459574286895e+00, -2.782476175734e+00,  4.487654448981e-01,
+	-3.328976638183e+00, -1.386657796946e+00, -4.504859032840e+00,
+	-4.324789098534e+00, -2.682093844821e+00,  5.324696750840e-01,
+	-1.807862096117e+01, -3.104067776564e+00,  1.035291238444e+00,
+	-3.814401433261e+00, -3.375776337465e+00,  1.082854675591e+00,
+	-1.113726751284e+00,  6.858095159714e+00,  2.138899835333e+00,
+	 9.136909585644e+00, -1.004187954766e+01,  1.552700795700e+00,
+	-2.016610530473e-01, -1.774776942331e+00, -7.264649194424e-01,
+	 7.587385098514e+00,  5.608363977668e+00,  3.118487619975e+00,
+	-2.644618580543e+00, -2.885937081098e-01, -6.246579972538e-01,
+	-4.701498066259e+00, -3.828491200870e+00,  1.206701767011e+00,
+	-1.698465874147e+01, -2.502069944112e+00,  2.481957381474e+00,
+	-2.768990801558e+00, -2.021514392061e+00,  8.957516331704e+01,
+	 3.595736760154e-01, -1.504328811926e+01,  2.512771427879e+00,
+	-5.270493401612e-01,  2.729409832148e+00, -6.758884829443e-01,
+	-3.503452300392e+00,  1.318733494951e+00, -2.429527208685e+00,
+	-3.496502067220e+00,  9.779043988224e-02, -3.768706863233e-01,
+	 2.614615759291e+00,  1.764784258659e+00,  1.106760359143e+01,
+	 7.339190997350e-01, -1.802310081476e+00,  5.262491555474e+00,
+	-8.735476814748e-01, -6.623816763928e-02, -1.500274545503e+00,
+	-4.808481371397e-01, -9.485128715451e-01, -1.504328811926e+01,
+	 2.419122824867e-01, -1.410073884227e+01, -1.636065878856e+01,
+	-1.303277129674e+00, -3.503452300392e+00, -2.966081719152e+00,
+	-1.501203579983e+00, -1.802310081476e+00, -1.434264082578e+00,
+	 6.334450731912e+00, -2.429527208685e+00, -1.402969120339e+00,
+	-1.413873420260e+00, -9.485128715451e-01, -7.832123648192e+00,
+	-4.052264477968e+00, -1.434264082578e+00,  2.834483922745e-01,
+	-2.057180131659e+00,  1.509690807520e+00,  3.041613548867e-01,
+	-6.623816763928e-02,  1.509690807520e+00, -1.410073884227e+01,
+	-2.065603792014e-01,  8.838926299961e+00,  5.194870527249e+00,
+	-1.958013294144e-01,  2.614615759291e+00, -1.015503675000e+00,
+	-1.413873420260e+00, -8.735476814748e-01, -2.057180131659e+00,
+	 7.736240594672e+00,  1.106760359143e+01,  3.595736760154e-01,
+	-6.753587189586e-01,  2.419122824867e-01,  9.165566070483e+00,
+	-1.328491639461e+00, -7.832123648192e+00,  2.512771427879e+00,
+	 9.165566070483e+00, -2.065603792014e-01, -3.270869270798e+00,
+	-1.500274545503e+00,  3.041613548867e-01, -1.636065878856e+01,
+	-3.270869270798e+00,  5.194870527249e+00,  1.385998153569e+00,
+	 9.809863073055e+01, -1.728338669924e+00,  2.613368597100e+00,
+	-3.571550258759e+00, -2.782068047439e+00, -4.317054939110e+00,
+	-1.326771975566e+00,  3.377851247095e+00, -2.032638401305e+00,
+	-2.904798893126e+00, -4.024068644862e-01, -1.789765863900e+00,
+	 1.935123261318e+00, -1.774776942331e+00,  1.122972089771e+00,
+	 1.889720134756e+00, -1.035265169900e+00,  1.191916249158e+00,
+	 3.813867157833e+00,  4.353514092073e+00,  3.368861080248e+00,
+	 2.765442605035e+00,  3.721982258708e+00,  2.521206439850e+00,
+	-1.061873030797e+01,  3.047752985594e+00,  4.132541158062e+00,
+	-3.315409063264e+00, -2.686664818293e+00, -4.734214937102e+00,
+	-2.966081719152e+00,  5.751503322452e+00, -2.880723420834e+00,
+	-2.564286970118e+00, -8.220992832505e-01,  6.125226003522e+00,
+	 2.324308770865e+00, -3.302633657468e-01,  1.107359958167e+00,
+	 2.168740291493e+00,  2.357004646701e+00,  2.471774491118e-01,
+	 8.273777261529e-01,  3.854178165127e+00,  2.967502268886e+00,
+	 2.285008684803e+00,  4.275172888550e+00,  2.285141576036e+00,
+	-1.123852794783e+01,  4.969935523010e+00,  6.049670909548e+00,
+	-1.077615858023e+00, -1.113575604606e+00, -1.298690101214e+00,
+	-1.652651858413e+00,  6.434661435840e+00, -1.564320152131e+00,
+	-8.236576663444e-02,  1.550500625506e+00,  8.019975900901e+00,
+	 3.041873824281e+00,  7.928391520504e+00,  3.033025904912e+00,
+	 3.721522996204e+00,  4.628791464403e+00,  2.241036691919e+00,
+	 1.736343164994e+00, -7.097320861696e+00,  1.335345077867e+01,
+	 4.965747295278e+00,  7.199345387488e+00,  3.346680124015e+00,
+	-1.167297866308e+01,  2.763559732723e+00,  3.975850193648e+00,
+	 9.558856130062e+01,  3.602497640164e+00,  8.728167739136e-02,
+	-2.973185056749e+00, -2.134427155471e+00, -8.079756984486e-01,
+	-1.740899821978e+00,  1.687976331812e+00, -1.236528750644e+00,
+	-3.731881441943e+00, -9.810006159352e-01, -1.921536633195e+00,
+	-2.530913169521e-01, -1.072808052753e+01, -4.012142341002e+00,
+	 1.318232892828e+00,  2.679127684595e+00,  6.246025085862e-01,
+	-4.246873562198e-01,  6.884749559513e-02, -1.617854918273e+00,
+	 2.391819140060e+00,  3.276950814974e+00, -5.235432807740e-01,
+	-3.230954098932e+01, -1.476250520358e+01, -2.366789863501e+00,
+	 4.684994356570e+00, -2.686664818293e+00, -3.503452300392e+00,
+	-7.559316642334e-01, -6.736333090493e-01, -2.708125769281e+00,
+	-1.130079104060e+00, -6.070285922930e-01,  1.785842841723e+00,
+	-7.134802820707e-02,  7.756203532263e+00,  4.381494580787e+00,
+	 1.658950675181e+00,  1.560103408002e+00, -1.523629515259e+00,
+	-1.183304436912e+00, -1.055105268277e+00, -2.724975798147e-01,
+	 3.393355614214e+00,  3.844652598198e+00,  3.138542869433e-01,
+	-1.329658859453e+01,  3.172391086813e+00,  2.157309568944e+00,
+	 4.382269223286e+00,  5.594761745824e-01, -5.415887533009e-01,
+	-3.155154912480e+00, -3.838702456029e+00,  1.103964626815e-01,
+	-2.677921010531e-01,  2.521206439850e+00,  1.800367798829e+00,
+	-5.184081626993e-01,  8.030710324664e+00,  6.327704291092e+00,
+	 2.822352104994e+00,  2.948311731521e+00, -4.865346579622e-01,
+	 1.838393288341e+00,  1.172842236345e+00,  1.007304985431e+01,
+	-7.848880696999e+00,  4.724777030396e+00,  7.543354819445e+00,
+	-1.477531242987e+01,  1.428519033495e+00,  9.643003993838e+01,
+	-3.766746276574e+00, -4.097909925188e+00, -4.487563915455e+00,
+	-2.520509178183e+00, -3.396993803252e+00,  3.059219503326e+00,
+	-3.524374107385e+00, -1.825286897668e+00, -9.691804166041e-03,
+	 2.876991281206e+00, -2.885937081098e-01,  4.666152903875e-01,
+	-2.228084886420e-01,  2.922110674780e+00,  9.347771452562e-01,
+	 1.546813244233e+00,  4.267290749018e+00,  1.880999975506e+00,
+	 8.245104493751e-02,  3.695306220970e+00,  2.948311731521e+00,
+	 2.946368918109e+00,  8.422734964478e+00, -1.290376043377e+01,
+	-3.120368999493e+00, -2.366789863501e+00, -3.315409063264e+00,
+	-1.303277129674e+00, -8.387401553610e-01,  5.802880078672e+00,
+	-3.645474573059e+00,  2.265350295737e+00, -2.999511866818e-01,
+	 2.305473049319e+00,  1.998923641038e+00,  1.028996681257e+00,
+	-2.548408267874e+00, -7.941333429609e-01,  8.878029250864e+00,
+	 6.161962224305e+00,  5.399160989020e+00,  3.113726507635e+00,
+	 3.179496450517e+00,  4.836447461486e+00,  6.442216870324e+00,
+	 3.662371906904e+00,  8.350945013180e+00, -1.246585631575e+01,
+	-5.480636670649e-01, -5.461624410772e-01, -5.036848859206e-01,
+	 2.289702072485e-01,  1.114849345277e-01,  7.294880514924e+00,
+	 7.238317266126e-01,  3.195508595240e+00,  2.241036691919e+00,
+	 2.521736977353e+00,  2.388408241585e+00,  1.032036931573e+00,
+	 7.957551721289e-01,  2.068494564446e+00,  1.318156858857e+01,
+	 5.345314793319e+00,  4.328867323995e+00,  2.557303867076e+00,
+	-3.385322917017e-01,  1.395510416804e+00,  1.363256479725e+01,
+	 5.442738728633e+00, -6.798830473095e-02,  5.149375912347e-01,
+	 9.413723065305e+01, -8.338514066157e+00,  3.613540478059e+00,
+	 4.724777030396e+00,  4.188852172306e+00, -2.176212322976e-01,
+	 3.821326467607e+00,  5.644322734034e+00,  2.127040208223e+00,
+	 6.592615705799e-01,  2.545811899239e+00, -6.078625248680e-01,
+	 1.107964915788e+01, -2.502069944112e+00,  2.403756399647e+00,
+	-2.040819721128e+00, -3.583326707102e+00, -5.032639310386e+00,
+	-3.022213996320e+00, -4.357839888469e+00,  6.480601053563e-01,
+	-4.095791269288e+00, -5.838502223296e+00, -7.610477576841e+00,
+	-1.290376043377e+01, -1.476250520358e+01,  4.132541158062e+00,
+	-1.636065878856e+01, -9.866031210242e-01, -2.810046656598e+00,
+	 1.836172744510e+00,  1.194626791439e-01,  3.067456987635e+00,
+	-2.078294739554e+01, -2.662946707408e+00, -3.352106445628e+00,
+	 1.086704431938e+01, -1.326291246903e+00,  2.277526143913e+00,
+	-1.749310225963e+00, -3.456265130000e+00, -5.374326968317e+00,
+	-1.008696088605e+01, -7.617857162435e+00, -7.906071484181e+00,
+	-8.565954662100e+00, -9.795986009264e+00, -7.622281008237e+00,
+	-1.741343395461e+01,  4.342318919497e+00, -2.434341346827e+00,
+	 2.776917641371e+00, -6.688376913594e+00, -4.208463205027e+00,
+	-1.757735704956e+00, -2.596374925752e+00, -3.527029313144e+00,
+	-2.001354624233e+00, -8.028801403943e+00, -5.146789834531e+00,
+	-1.409124404267e+01, -4.183611478610e+00, -3.424324632603e+00,
+	-4.915340817885e+00, -8.492762726010e+00, -6.206309886861e+00,
+	-7.888096785292e+00, -6.509297316739e+00, -5.103736318548e+00,
+	-7.846534379118e+00, -1.188936352316e+01, -6.799221992787e+00,
+	 1.027398406169e+02,  3.333572246767e+00,  3.844652598198e+00,
+	 3.944318498646e+00,  9.921424615324e-01,  4.866839874631e+00,
+	 6.256703588025e+00,  2.994880547066e+00,  3.144999304244e+00,
+	 3.466674258585e+00, -2.675382762403e+00,  1.147623960344e+01,
+	-3.104067776564e+00,  1.200368596232e+00, -1.782358778089e+00,
+	-3.846811263871e+00, -7.889141118361e+00,  3.033581165885e-01,
+	-5.177633541737e+00, -4.054854472275e-01, -4.035453191726e+00,
+	-2.604466249750e+00, -5.838502223296e+00,  8.422734964478e+00,
+	-3.230954098932e+01,  3.047752985594e+00, -1.410073884227e+01,
+	-1.596199793905e+00, -2.207789382568e+00,  5.246599889640e+00,
+	-4.252364233704e-01,  3.233504094688e+00, -1.516687251732e+01,
+	-1.966365972395e+00, -7.656472312125e+00, -8.392910900020e+00,
+	-3.312437917730e+00,  1.780892716323e+00, -1.051231285301e+00,
+	-3.444091491449e+00, -6.834192645476e+00, -7.534231667437e+00,
+	-8.649381218050e+00, -6.107134651104e+00, -8.709380485627e+00,
+	-1.245122148057e+01, -7.042524271406e+00, -3.589715520263e-01,
+	-1.761002533043e+01, -3.580841026880e+00, -5.406379421492e-01,
+	-7.376802657608e+00, -2.514072324466e+00, -2.400155132297e+00,
+	-2.268571295538e+00, -3.309819845396e+00, -2.373284715575e+00,
+	-7.297492607302e+00, -7.688467149045e+00,  5.382380267126e+00,
+	-6.136786920084e+00, -3.604350182078e+00, -4.673532379350e+00,
+	-9.226553962378e+00, -7.043492627925e+00, -8.503146417492e+00,
+	-8.442029225694e+00, -7.906071484181e+00, -8.096313054729e+00,
+	-9.337869758298e+00, -6.759646591125e+00,  9.290816092733e+01,
+	-5.184081626993e-01, -1.205867682214e+01,  1.721878827136e+00,
+	 1.512140931027e+00,  1.220984833694e+00,  5.955798164640e+00,
+	-3.441768233689e-01,  3.603172949362e+00,  1.782635634522e+00,
+	 2.167230955157e+00,  7.587385098514e+00,  2.897914106349e+00,
+	-5.424995482543e+00, -2.925966214969e+00, -3.083666913486e+00,
+	-5.324322134884e-01, -4.223200701534e+00, -1.453703516421e+00,
+	-1.175787178366e+00, -4.035453191726e+00, -4.095791269288e+00,
+	 2.946368918109e+00, -5.235432807740e-01, -1.061873030797e+01,
+	 2.419122824867e-01, -1.889453730991e+01, -2.149125395976e+01,
+	 2.853564764686e+00, -2.268249271026e+00,  3.903504901432e+00,
+	-3.712070198616e-01, -5.642415176230e+00, -2.103304812199e+01,
+	 1.713590223900e+00,  8.864833415614e+00,  2.436584065765e+00,
+	-4.569239637934e+00, -2.531962724334e+00, -3.122642508226e+00,
+	-3.490526700244e+00, -4.369649749909e+00, -7.297492607302e+00,
+	-3.195637320996e+00, -3.499464928966e+00, -3.842372777174e+00,
+	-2.051323545871e+00, -1.083252126533e+00, -1.835753035065e+01,
+	-2.758531095175e+00,  5.549526644872e+00,  2.988120556764e+00,
+	-1.920294231742e+00, -9.797334628981e-01, -6.245022779066e+00,
+	-3.458060319902e+00, -3.597750020641e+00,  1.733752303319e+00,
+	-2.070733228092e+00, -1.054583017588e+01, -4.089386035084e+00,
+	-5.671742031674e+00, -4.236013802273e+00, -5.089782964358e+00,
+	-4.197823403104e+00, -5.414316859672e+00, -8.028801403943e+00,
+	-4.703580551709e+00, -3.906907367151e+00, -4.809065265750e+00,
+	 9.558856130062e+01, -7.134802820707e-02, -7.753290987648e-01,
+	 1.007304985431e+01, -2.724975798147e-01, -3.155154912480e+00,
+	-1.473039643827e+01, -7.559316642334e-01, -1.650357334376e+00,
+	-2.677921010531e-01,  2.208468171966e-01,  4.382269223286e+00,
+	 7.525234379727e-01,  3.069145866814e-01, -1.319885161179e+00,
+	-1.130079104060e+00, -1.894520575050e+00,  4.684994356570e+00,
+	-1.453703516421e+00, -4.054854472275e-01,  6.480601053563e-01,
+	 2.948311731521e+00,  3.276950814974e+00,  2.521206439850e+00,
+	-1.504328811926e+01, -2.530913169521e-01,  4.016475882967e-01,
+	 6.327704291092e+00, -1.617854918273e+00,  5.594761745824e-01,
+	 2.667203715066e+00, -1.740899821978e+00, -7.011503139073e-01,
+	 1.103964626815e-01, -7.218108880326e-01,  2.157309568944e+00,
+	-2.029318493937e+00, -2.345113472698e-01, -2.422870916489e+00,
+	-3.731881441943e+00, -2.051918278685e+00, -2.973185056749e+00,
+	-1.017282612133e+00,  4.935111399241e-01,  9.635617303076e-01,
+	 1.560103408002e+00,  2.679127684595e+00, -6.070285922930e-01,
+	-1.532857981946e+01, -9.810006159352e-01, -7.372084845887e-01,
+	 4.381494580787e+00, -4.012142341002e+00, -2.686664818293e+00,
+	 2.177868858619e+00, -2.134427155471e+00, -1.748883572120e+00,
+	-2.708125769281e+00, -2.509662021919e+00, -2.366789863501e+00,
+	-4.105912990416e+00,  7.687474184356e-01, -1.791906368604e+00,
+	-1.236528750644e+00,  4.506886272349e-01,  8.728167739136e-02,
+	-6.555006191468e-01, -1.397583410209e+00, -8.227616271203e-01,
+	 9.751061653521e+01,  2.734614520218e+00,  3.378962900472e+00,
+	 3.102568921365e+00,  2.149466681851e+00, -1.302373383824e+00,
+	 1.334722732491e+00,  1.654800292539e+00,  1.048607983245e+00,
+	 7.459574286895e+00, -7.714344754110e-01, -2.546662985140e+00,
+	-3.969164669566e+00, -3.217070863418e+00, -1.386393553465e+00,
+	-5.866818187379e-01, -1.894520575050e+00, -4.223200701534e+00,
+	-5.177633541737e+00, -4.357839888469e+00,  3.695306220970e+00,
+	 2.391819140060e+00,  3.721982258708e+00, -9.485128715451e-01,
+	-3.415167569242e+01, -1.573887625141e+01,  1.236200425223e+00,
+	 1.842842926719e+00,  7.195832776668e-01, -6.272583443811e-01,
+	-3.227869660420e+00, -1.801697508096e+01,  3.013022099523e-01,
+	-1.139783705659e+01, -1.559066702295e+00, -1.727083074403e-01,
+	-5.359658964852e+00, -4.118520727573e+00, -4.393480557732e+00,
+	-2.798104359033e+00, -1.966365972395e+00, -6.284733820849e+00,
+	-3.781255896646e+00, -2.995157365797e+00,  3.170094086437e-01,
+	-6.478289948338e-02,  3.187005775045e+00, -2.325746351568e+00,
+	-1.931723779729e+01, -1.145824542711e+00, -1.796657275996e+00,
+	-2.188194744040e+00,  3.333428005631e+00, -2.707724710007e+00,
+	-5.642415176230e+00, -7.684814635687e-01, -2.981997461892e+00,
+	 4.480661864288e+00, -1.998506975319e+00, -3.963736556695e+00,
+	-3.082620429656e+00, -1.784468438871e+00, -5.043942478076e+00,
+	-3.070522677661e+00, -2.662946707408e+00, -6.029988499579e+00,
+	-4.737815471167e+00, -3.351793695112e+00,  9.425527881076e+01,
+	-1.163019868429e+00,  9.550415950134e+00, -2.853263034420e+00,
+	-3.798019435484e-01, -2.306679629314e-01, -1.529788411643e+01,
+	 6.512658752919e-01,  2.082554746308e-01,  2.652319949112e-01,
+	 1.121857935227e+00,  5.984784451369e-01,  5.307627242695e-02,
+	-6.166355187074e-03, -1.386393553465e+00, -1.130079104060e+00,
+	-5.324322134884e-01,  3.033581165885e-01, -3.022213996320e+00,
+	 8.245104493751e-02, -1.617854918273e+00,  2.765442605035e+00,
+	-4.808481371397e-01,  2.763374819590e+00, -1.483566270793e+01,
+	 5.031384444130e-01,  5.664638623962e+00, -8.118151978033e-01,
+	 2.776161185327e-01, -1.107489668175e+00,  9.824378689400e-01,
+	 2.435144885289e-01, -3.320966481405e+00,  2.028722332829e+00,
+	-1.830795891540e+00,  3.419865282762e-01, -3.802109614301e-01,
+	 5.157818673528e-01, -3.320010418410e-01,  6.889578795694e-01,
+	 6.253261181329e-01,  1.150992026923e+00, -3.003794026140e+00,
+	-3.246826373966e-01, -1.154801614962e+00,  3.750277738450e+00,
+	-1.026121687826e-01,  2.630941222738e+00, -1.514655589180e+01,
+	-3.770402423486e-01,  7.710727118341e+00, -8.220992832505e-01,
+	-3.540298019642e-01, -3.080550414266e-01,  1.836798978688e+00,
+	-8.773768561692e-01, -3.095239320961e+00,  2.265350295737e+00,
+	-1.088611273287e+00,  1.001012164120e+00,  6.170253131144e-02,
+	-1.501427402001e+00, -2.497536897801e+00, -2.142159352763e+00,
+	 5.208504137773e-03,  2.676029407895e+00, -1.724600209857e+00,
+	 9.582535609152e+01, -8.297541563950e+00,  6.607416217983e-01,
+	 8.542775590209e+00,  2.739717845743e+00, -2.617622763510e+00,
+	 1.958044531414e+00,  1.206701767011e+00,  1.294236416278e+01,
+	 1.185705429959e+00, -3.002472086703e+00, -7.252267380717e-01,
+	 5.307627242695e-02, -3.217070863418e+00, -1.319885161179e+00,
+	-3.083666913486e+00, -7.889141118361e+00, -5.032639310386e+00,
+	 1.880999975506e+00,  6.884749559513e-02,  3.368861080248e+00,
+	-1.500274545503e+00, -4.277825771633e+00, -1.371630235095e+00,
+	-1.137718812299e+01, -1.425152331147e+01,  2.061253084934e+00,
+	-2.273036169484e+00, -5.043942478076e+00, -2.107380789316e+00,
+	 1.637282693123e+00, -1.853897438606e+01,  1.258798490474e+01,
+	-1.955882182498e+01, -5.704666298488e+00, -4.054354957953e+00,
+	-8.528145525572e+00, -7.354590356675e+00, -8.503146417492e+00,
+	-5.446412219730e+00, -6.533192547079e+00, -8.689360397115e+00,
+	-3.966875133960e+00, -3.319274027117e+00, -5.379060010957e-01,
+	-3.939033477671e+00, -3.060995013950e+00, -6.034279734737e+00,
+	-1.839768658979e+01,  3.974636535102e+00, -1.978085165551e+00,
+	-3.788777598628e+00, -4.197823403104e+00, -5.973023955525e+00,
+	-5.531412309654e+00,  8.461822412184e-01, -1.392857184169e+01,
+	 6.996732306856e-01, -4.537220624508e+00, -8.158413264879e+00,
+	-7.362381991515e+00, -6.723903431767e+00, -7.888096785292e+00,
+	-6.309706036015e+00, -7.427056300412e+00, -1.359534392292e+01,
+	 1.028730003366e+02,  1.633643980228e+00, -1.367359361817e+00,
+	 3.598566356990e+00,  7.672480561843e+00,  2.464543298102e+00,
+	 5.324696750840e-01,  1.172889267798e+01,  1.351338164399e+00,
+	-4.330844233499e+00, -3.002472086703e+00,  5.984784451369e-01,
+	-3.969164669566e+00,  3.069145866814e-01, -2.925966214969e+00,
+	-3.846811263871e+00, -3.583326707102e+00,  4.267290749018e+00,
+	-4.246873562198e-01,  4.353514092073e+00, -6.623816763928e-02,
+	-4.942174896818e+00, -3.217985067747e+00,  6.913295825353e+00,
+	-3.191897391655e+01,  4.276523016489e+00, -1.195359061504e+00,
+	-4.393480557732e+00, -3.881796594818e+00,  2.824122585137e+00,
+	-1.785741159658e+01, -8.413959821550e+00, -1.609492043731e+01,
+	-6.479503335927e+00, -4.707676646464e+00, -5.198151386951e+00,
+	-7.067304336916e+00, -7.534231667437e+00, -5.386554332896e+00,
+	-5.727554489443e+00, -1.303981381195e+01, -1.830141397350e+00,
+	-3.077435936246e+00, -3.780929602403e+00, -2.561686886301e+00,
+	-3.624537397210e+00, -5.798544476761e+00, -6.222952963445e-02,
+	-1.782249160683e+01, -3.783015785345e+00, -3.491328526191e+00,
+	-3.490526700244e+00, -7.137383601767e+00, -4.060872510365e+00,
+	-3.797429310574e+00,  3.953003306613e+00, -1.801614127779e+00,
+	-5.775897341950e+00, -8.510243837528e+00, -8.528145525572e+00,
+	-9.948184353734e+00, -1.008696088605e+01, -6.790029484350e+00,
+	-6.787946198354e+00, -1.017404823574e+01,  9.623288235143e+01,
+	 1.727656652568e+00, -1.139997753142e+01,  1.605009937700e+00,
+	 8.971252047384e-01,  9.136909585644e+00,  2.262909316539e+00,
+	 1.826606628208e+01,  1.351338164399e+00,  1.185705429959e+00,
+	 1.121857935227e+00, -2.546662985140e+00,  7.525234379727e-01,
+	-5.424995482543e+00, -1.782358778089e+00, -2.040819721128e+00,
+	 1.546813244233e+00,  6.246025085862e-01,  3.813867157833e+00,
+	-8.735476814748e-01, -8.653044894920e+00, -5.504786348968e+00,
+	 2.005945896488e+00, -1.154084704986e+00, -1.087519161753e+01,
+	-1.054670361388e+00, -1.931723779729e+01, -9.010289531177e-01,
+	 2.115403018659e+00, -1.673735807736e+00,  3.589747706759e+00,
+	 8.119638109618e+00, -1.772148135538e+01, -1.836290956335e+01,
+	-3.624537397210e+00, -3.382738058823e+00, -7.376802657608e+00,
+	-4.033039103607e+00, -3.410687068000e+00, -3.796295917225e+00,
+	-1.901016383406e+00, -3.293908636271e+00, -6.226323306043e+00,
+	-1.737247980996e+00, -2.694134261887e+00, -3.647307715090e+00,
+	-1.715286422616e+00, -2.986793871441e+00, -1.803013077051e+01,
+	-1.289027284416e+00,  5.549526644872e+00, -3.182261114663e+00,
+	-1.885301049067e+00, -2.743959194151e+00, -3.937935079379e+00,
+	-1.090411611619e+01,  2.345641452191e+00,  1.557584945579e+00,
+	-3.060995013950e+00, -3.838214998904e+00, -6.688376913594e+00,
+	-3.782715174312e+00, -2.615177265849e+00, -3.350310623590e+00,
+	 9.243478191755e+01, -1.113726751284e+00,  1.878729158774e+00,
+	 8.290716070726e-01, -1.770001316586e+00,  3.566848312537e+00,
+	 2.262909316539e+00,  1.172889267798e+01,  1.294236416278e+01,
+	 2.652319949112e-01, -7.714344754110e-01,  4.382269223286e+00,
+	 2.897914106349e+00,  1.200368596232e+00,  2.403756399647e+00,
+	 9.347771452562e-01,  2.679127684595e+00,  1.191916249158e+00,
+	 5.262491555474e+00, -2.003550519916e+00, -2.042071667166e+00,
+	 7.132948819558e+00, -1.154801614962e+00,  2.873097176222e+00,
+	-1.464638524846e+01, -1.387544175728e+00,  1.282483886717e+00,
+	-4.914832430175e-01,  4.191960109920e-01,  2.863560846756e+00,
+	-3.100571294301e-02,  8.175100648609e-03,  1.879421398968e+00,
+	-6.408915895272e+00, -2.339857766248e-01, -6.852767854379e-01,
+	 2.996086680657e+00,  1.922411765947e+00,  3.574412544294e+00,
+	-1.484446144539e+00,  9.603787116111e-01, -2.536797335050e+00,
+	 4.026522121836e+00, -1.662599489702e+00, -1.958838045730e+00,
+	 5.172500727818e+00, -4.731308905270e+00, -1.113575604606e+00,
+	-1.484005674089e+01, -1.096611175365e+00,  2.229989106936e+00,
+	-2.157008537356e+00, -1.910848175947e+00, -5.461624410772e-01,
+	-1.917764053845e+00,  2.619439411635e-01,  2.370602470035e+00,
+	-1.204202359331e+00,  1.576985794401e+00,  1.968441873893e+00,
+	 6.255865808762e-01,  1.358244315756e-01,  1.779269009384e+00,
+	 9.792792542430e+01, -2.016610530473e-01,  2.925649669577e-01,
+	-1.412924525600e+00, -1.770001316586e+00,  9.136909585644e+00,
+	 5.324696750840e-01,  1.206701767011e+00,  2.082554746308e-01,
+	 7.459574286895e+00,  2.208468171966e-01,  7.587385098514e+00,
+	-3.104067776564e+00, -2.502069944112e+00,  2.922110674780e+00,
+	 1.318232892828e+00, -1.035265169900e+00, -1.802310081476e+00,
+	-3.169654876424e+00, -3.328976638183e+00,  8.312065129088e-01,
+	 1.206920851205e+00,  4.663671824417e+00,  2.138899835333e+00,
+	-3.415167569242e+01, -2.644618580543e+00,  9.091988927309e-01,
+	 8.821771107067e-01, -1.213912204195e+00, -1.004187954766e+01,
+	-1.807862096117e+01, -1.698465874147e+01, -4.942174896818e+00,
+	-4.324789098534e+00, -1.596199793905e+00, -4.701498066259e+00,
+	-3.814401433261e+00, -2.768990801558e+00,  9.672803486650e-02,
+	-1.398642048157e-02,  2.629500276460e+00, -4.827974267738e+00,
+	-8.653044894920e+00, -4.504859032840e+00, -2.290046014199e+00,
+	-2.484889463177e+00,  4.704092386074e+00, -7.264649194424e-01,
+	-1.889453730991e+01, -6.246579972538e-01, -2.671675459565e+00,
+	-2.782476175734e+00, -1.370020588042e+00,  5.608363977668e+00,
+	 1.035291238444e+00,  2.481957381474e+00, -4.277825771633e+00,
+	-2.682093844821e+00, -9.866031210242e-01, -3.828491200870e+00,
+	-3.375776337465e+00, -2.021514392061e+00,  9.364261020935e+01,
+	-5.826420729107e-02,  2.925649669577e-01,  8.290716070726e-01,
+	 8.971252047384e-01,  2.464543298102e+00,  1.958044531414e+00,
+	 6.512658752919e-01,  1.048607983245e+00, -2.677921010531e-01,
+	 2.167230955157e+00,  1.147623960344e+01,  1.107964915788e+01,
+	-2.228084886420e-01, -4.012142341002e+00,  1.889720134756e+00,
+	 7.339190997350e-01,  2.798436080348e-01,  1.478463607113e+00,
+	 5.556784678295e-02,  7.710727118341e+00,  4.298464435759e-01,
+	 2.944674078974e+00, -2.951705755836e-01, -1.579056035613e+01,
+	 9.187825916397e-01, -4.519468385002e+00,  1.620757515090e+00,
+	 1.830820307250e+00,  2.602784094762e+00,  2.176865652904e+00,
+	 1.481474730499e+00,  1.144794431507e+00,  2.715103187041e+00,
+	 2.005509099976e+00,  6.064014729740e-01,  1.173906954842e+00,
+	-2.130686870214e+00, -4.731308905270e+00,  1.639389940471e+00,
+	-6.957410990949e-01,  2.372229096380e+00,  4.417972865159e+00,
+	-1.280039341631e+00,  9.062747972680e+00,  1.550500625506e+00,
+	 1.686640984030e+00,  5.809827535218e-01, -1.497169980516e+01,
+	 4.012777854196e-01, -3.199985588940e+00,  3.195508595240e+00,
+	 2.479303162059e+00,  2.259724475421e+00,  2.185800163934e+00,
+	-4.572240886436e+00, -1.374106848530e+00, -5.388236331488e-01,
+	 4.263486161716e+00,  2.388187317455e+00,  3.105321371847e+00,
+	 9.364261020935e+01, -2.016610530473e-01,  1.878729158774e+00,
+	 1.605009937700e+00,  7.672480561843e+00, -2.617622763510e+00,
+	-1.529788411643e+01,  1.654800292539e+00, -1.650357334376e+00,
+	 1.782635634522e+00, -2.675382762403e+00, -6.078625248680e-01,
+	 4.666152903875e-01, -1.072808052753e+01,  1.122972089771e+00,
+	 1.106760359143e+01, -2.484889463177e+00, -8.764506148640e-01,
+	 3.225811061359e+00, -1.884389987614e-01,  1.654428549560e+00,
+	 1.212892946348e+01, -2.188194744040e+00, -1.460894852541e+00,
+	-1.083438350932e+01, -1.560256694684e-01,  2.169936748497e+00,
+	 2.474312357149e+00,  7.595055124937e+00, -2.301633129172e+00,
+	-1.782249160683e+01, -1.870964526614e+01, -2.268571295538e+00,
+	-2.158847452393e+01, -3.810993393584e+00, -2.752131659222e+00,
+	-6.054541608477e+00, -4.105549062524e+00, -2.552343844660e+00,
+	-5.858496993319e+00, -2.986793871441e+00, -2.777953483681e+00,
+	-4.489830288734e+00, -1.913832939540e+00, -9.738491668737e-01,
+	-7.697330341960e+00, -9.797334628981e-01, -3.417695766792e+00,
+	-1.702162525005e+01, -1.534521447602e+00, -2.127545451841e+00,
+	-1.764751940509e+00, -1.181689608179e+01, -2.459597136416e+00,
+	 3.974636535102e+00,  3.790957392383e+00, -2.596374925752e+00,
+	 1.701081515768e+00, -3.159505913850e+00, -1.690305723896e+00,
+	 9.792792542430e+01, -1.113726751284e+00, -1.139997753142e+01,
+	 3.598566356990e+00,  2.739717845743e+00, -2.306679629314e-01,
+	 1.334722732491e+00, -7.559316642334e-01,  3.603172949362e+00,
+	 3.466674258585e+00,  2.545811899239e+00, -2.885937081098e-01,
+	-2.530913169521e-01, -1.774776942331e+00,  1.764784258659e+00,
+	-1.150515194929e+01,  8.807311070374e+00,  3.118487619975e+00,
+	 2.763374819590e+00,  6.858095159714e+00,  2.081597593152e+00,
+	 1.180692471133e+00,  8.643816426594e+00,  1.552700795700e+00,
+	-1.113906708122e+01,  1.082854675591e+00,  7.179343504372e+00,
+	 1.013261080393e+00,  8.495879428693e-02,  1.811359527949e+00,
+	 8.218535512191e-01,  1.065902122993e+00,  2.256917174712e+00,
+	 1.369583519417e+00,  2.196864864521e-01, -1.386657796946e+00,
+	-2.003550519916e+00, -3.292143368560e+00, -5.206693234587e-01,
+	-1.135866212704e+00, -2.345152774570e+00,  4.487654448981e-01,
+	 2.798436080348e-01,  5.751503322452e+00,  6.578391326512e-01,
+	-2.072823293804e+00,  4.934039777925e-01, -9.461035067327e-02,
+	-1.274971040765e+01, -8.387401553610e-01,  4.855767222409e+00,
+	 1.123942412490e+00, -5.803234253964e-01,  2.711511890228e+00,
+	 1.611588167261e+00,  2.273467378119e+00,  3.626068944822e+00,
+	 3.266755196989e+00,  2.021832568728e+00,  9.243478191755e+01,
+	 1.727656652568e+00, -1.367359361817e+00,  8.542775590209e+00,
+	-3.798019435484e-01, -1.302373383824e+00, -1.473039643827e+01,
+	-3.441768233689e-01,  3.144999304244e+00,  6.592615705799e-01,
+	 2.876991281206e+00, -1.921536633195e+00,  1.935123261318e+00,
+	 2.614615759291e+00, -1.398642048157e-02, -9.951241911026e-01,
+	 5.929515168959e-01, -1.044597404652e+01,  3.470374939446e+00,
+	 2.223763996573e+00, -6.478289948338e-02, -2.303620264107e-01,
+	 2.382632629644e+00,  9.355764391920e+00, -1.176026535132e+01,
+	 1.204590183564e+01, -8.597379993843e-02,  9.889986917676e+00,
+	-3.077435936246e+00, -2.183652474307e+00, -1.761002533043e+01,
+	-4.199563822339e+00, -1.888968834032e+01, -1.985823507029e+01,
+	-4.433495513999e+00, -2.987189924986e+00, -5.159253821751e+00,
+	-4.534521658718e+00, -3.293908636271e+00, -2.059814455931e+00,
+	-5.024674488049e+00, -4.105549062524e+00, -2.670532264024e+00,
+	-1.699205803310e+00, -1.083252126533e+00, -8.507229338521e-01,
+	-1.252866663523e+00, -4.870875296598e+00, -1.556112555510e+01,
+	-5.300941841616e+00, -6.222813356798e-01, -9.391775317018e+00,
+	-3.319274027117e+00, -2.276400718738e+00,  4.342318919497e+00,
+	-4.408844372209e+00,  3.230429487931e+00,  2.310785139207e+00,
+	 9.623288235143e+01,  1.633643980228e+00,  6.607416217983e-01,
+	-2.853263034420e+00,  2.149466681851e+00, -3.155154912480e+00,
+	 5.955798164640e+00,  2.994880547066e+00,  2.127040208223e+00,
+	-9.691804166041e-03, -9.810006159352e-01, -1.789765863900e+00,
+	-3.768706863233e-01, -1.135866212704e+00, -9.667636843036e-01,
+	 3.208338468776e+00,  2.630941222738e+00,  7.515026392630e+00,
+	 4.012808078943e+00, -9.047939385522e+00, -1.583198579187e-01,
+	 1.061763072627e+00,  7.393128167836e+00,  6.636919693627e-01,
+	-1.240197707428e+01,  1.139822559534e+01,  1.039773108504e+01,
+	 3.185412846199e+00,  2.686559002880e+00,  3.090711690084e+00,
+	 4.091907345714e+00,  4.962414278088e+00,  4.225686987885e+00,
+	-3.804934109543e+00, -1.662599489702e+00, -4.422053721042e+00,
+	-2.654682888356e+00, -1.032676984279e+00, -1.439488806184e-01,
+	 8.429278307196e-01,  2.372229096380e+00,  6.434661435840e+00,
+	 1.658673176060e+00, -2.624870548749e+00,  2.849397904601e+00,
+	 2.482753349211e-01,  7.541952293392e+00,  1.114849345277e-01,
+	-1.477458972653e+01, -1.753649010648e-01, -4.978174845623e-01,
+	 2.346709136573e+00,  1.972105926837e+00,  1.866096847607e+00,
+	 3.016385531950e+00,  3.357250305437e+00,  2.618502683801e+00,
+	 1.028730003366e+02, -8.297541563950e+00,  9.550415950134e+00,
+	 3.102568921365e+00, -2.724975798147e-01,  1.220984833694e+00,
+	 6.256703588025e+00,  5.644322734034e+00, -1.825286897668e+00,
+	-3.731881441943e+00, -4.024068644862e-01,  9.779043988224e-02,
+	 1.811359527949e+00,  2.069499853586e+00, -6.441181678029e-01,
+	 5.157818673528e-01,  3.911737512984e+00,  1.072870140559e+01,
+	 6.065370204487e+00,  3.492461983959e+00,  1.103961864310e-01,
+	 2.072072528618e+00,  1.009816006726e-01,  1.971893025908e+00,
+	-8.617100239577e+00,  7.212473530872e+00, -5.212362886627e+00,
+	 1.380487633063e+01,  6.538915679134e+00,  1.123693803017e+01,
+	 4.909188564705e+00,  5.253510921143e+00, -2.887436182623e+00,
+	-6.408915895272e+00, -1.778203751877e+00,  6.460187774569e-01,
+	 3.185412846199e+00,  4.365016616731e+00,  2.598718034329e+00,
+	 1.481474730499e+00,  2.285008684803e+00,  1.070751525353e+01,
+	 7.338598223257e+00,  5.494486379864e+00,  2.900775880867e+00,
+	 2.691558853325e+00,  3.179496450517e+00,  2.445507097984e+00,
+	-7.462086587433e+00,  9.295759960709e+00,  4.910371536422e+00,
+	 2.523572268464e+00,  4.934647502956e+00,  2.338510440781e+00,
+	 5.119857452701e+00,  5.365853466937e+00,  9.582535609152e+01,
+	-1.163019868429e+00,  3.378962900472e+00,  1.007304985431e+01,
+	 1.512140931027e+00,  4.866839874631e+00,  3.821326467607e+00,
+	-3.524374107385e+00, -1.236528750644e+00, -2.904798893126e+00,
+	-3.496502067220e+00,  2.711511890228e+00,  2.053018965971e+00,
+	 7.223117961912e-01, -1.501427402001e+00,  1.305191602080e+00,
+	 1.144420990562e+01,  6.953438358800e+00,  4.070223633294e+00,
+	 2.914347521061e+00,  4.421542495743e+00,  1.160476605362e+00,
+	 4.110489866789e+00,  1.170347912756e+01, -1.149379246006e+01,
+	 4.910371536422e+00,  2.189875166806e+00, -5.297355703432e+00,
+	 1.261198349478e+00,  1.528332153163e+01,  1.313791984167e+01,
+	 5.906337922250e-01, -1.204202359331e+00,  9.342946892489e-01,
+	-3.046752274588e+00,  2.346709136573e+00,  6.514720168175e-01,
+	 1.124628046224e-01, -4.572240886436e+00,  4.965747295278e+00,
+	 1.213250787363e+01,  6.666919054489e+00,  2.849564574670e+00,
+	 1.573078646294e+00,  4.614522252283e+00, -3.385322917017e-01,
+	 4.701132815293e+00,  1.145175163353e+01, -1.281697780429e+01,
+	 8.606371226389e+00,  5.647224242487e+00,  6.241802654244e+00,
+	 5.968337421429e+00,  7.809624182921e+00,  5.442495263029e+00,
+	 9.425527881076e+01,  2.734614520218e+00, -7.753290987648e-01,
+	 1.721878827136e+00,  9.921424615324e-01, -2.176212322976e-01,
+	 3.059219503326e+00,  1.687976331812e+00, -2.032638401305e+00,
+	-2.429527208685e+00,  1.206920851205e+00, -8.708702396588e-02,
+	-1.833095037434e+00, -2.988316750226e-01, -2.272390005762e+00,
+	-4.687836102042e+00,  1.842842926719e+00, -5.677761772974e-02,
+	 1.942035111048e+00,  6.528888148068e-01, -8.463871436685e-02,
+	-1.876281433685e+00, -9.900970877507e+00,  5.141362124411e-01,
+	-3.191897391655e+01, -1.461128114527e+01, -4.252364233704e-01,
+	-1.311200218983e+01, -9.289028439852e-01, -2.883507708059e-01,
+	 7.794731202832e+00, -1.044597404652e+01,  1.055281165474e+00,
+	 8.665782512095e+00, -1.154084704986e+00, -7.747762643662e-01,
+	 6.983596632957e-02, -1.884389987614e-01, -1.597058633179e-01,
+	 9.028803811287e+00, -2.268249271026e+00, -1.007191597567e+00,
+	 2.388369299110e+00,  1.375543002819e-01, -3.298152349902e-01,
+	 1.495806206700e-01,  6.290326627743e+00, -2.274835626551e+00,
+	-1.425152331147e+01,  2.568940779971e+00,  1.194626791439e-01,
+	 4.189548880299e+00, -4.532123253494e-01, -6.752871022338e-03,
+	 9.751061653521e+01, -7.134802820707e-02, -1.205867682214e+01,
+	 3.944318498646e+00,  4.188852172306e+00, -3.396993803252e+00,
+	-1.740899821978e+00,  3.377851247095e+00,  1.318733494951e+00,
+	 1.180692471133e+00, -6.425326534270e-01, -3.116501666214e+00,
+	-1.107489668175e+00, -2.208488723481e+00,  1.946059431946e-01,
+	 6.934297291324e+00,  1.414393533018e+00,  2.741216104640e+00,
+	 2.419060466050e+00,  1.216733034440e-01,  3.357905241379e+00,
+	 1.322885379964e+00,  1.067529385234e+00,  6.065370204487e+00,
+	-1.221029955188e+01,  3.122192814028e+00,  6.659350941825e+00,
+	 1.537288826910e+00,  1.674442526061e+00, -2.083447986722e-01,
+	-1.387544175728e+00,  6.703579013408e+00,  2.973373472682e+00,
+	-9.047939385522e+00,  1.038041091126e+01,  8.278274107761e-01,
+	-2.951705755836e-01, -3.302633657468e-01,  8.882315943526e-01,
+	 1.006771630237e+01,  9.166912330762e+00,  4.626406333315e+00,
+	 2.259172468563e+00,  1.998923641038e+00,  4.677240151748e+00,
+	 8.237339231789e-01,  1.074167320036e+00,  6.953438358800e+00,
+	-1.125058937662e+01,  4.575982226581e+00,  7.917203302918e+00,
+	 3.179031156918e+00,  3.372434726074e+00,  9.558856130062e+01,
+	-5.184081626993e-01,  3.844652598198e+00,  4.724777030396e+00,
+	-2.520509178183e+00, -8.079756984486e-01, -1.326771975566e+00,
+	-3.503452300392e+00,  1.318232892828e+00,  1.658950675181e+00,
+	 4.420997494786e+00,  1.687976331812e+00, -1.198321946146e+00,
+	-5.415887533009e-01,  2.391819140060e+00,  2.822352104994e+00,
+	-1.349970109104e+00, -6.736333090493e-01,  2.445496216654e+00,
+	-3.838702456029e+00,  3.393355614214e+00, -7.848880696999e+00,
+	-4.246873562198e-01, -1.183304436912e+00, -3.230954098932e+01,
+	 1.838393288341e+00, -1.329658859453e+01, -1.477531242987e+01,
+	-6.108946848553e-01, -1.921536633195e+00, -8.315160260822e-01,
+	 1.785842841723e+00,  6.246025085862e-01, -1.523629515259e+00,
+	 8.664816344825e+00, -1.072808052753e+01, -1.728338669924e+00,
+	 1.800367798829e+00, -5.235432807740e-01, -4.865346579622e-01,
+	 8.399192354944e-01,  7.756203532263e+00,  3.602497640164e+00,
+	 8.030710324664e+00,  3.138542869433e-01,  7.543354819445e+00,
+	 6.884749559513e-02, -1.055105268277e+00, -1.476250520358e+01,
+	 1.172842236345e+00,  3.172391086813e+00,  1.428519033495e+00,
+	 9.290816092733e+01,  3.333572246767e+00,  3.613540478059e+00,
+	-4.487563915455e+00, -2.134427155471e+00, -4.317054939110e+00,
+	-6.758884829443e-01, -2.072823293804e+00,  1.408741408739e+00,
+	-2.304977410456e+00, -3.080550414266e-01,  5.999536336859e+00,
+	 7.359884362462e-01,  1.006771630237e+01,  3.701107506882e+00,
+	 2.557678059119e+00,  1.347104620718e+00,  1.717329660648e-01,
+	 3.357280593681e+00, -2.426244342009e-01,  6.773275636975e-01,
+	 7.338598223257e+00,  9.268116694607e+00,  5.248529057164e+00,
+	-1.096961967365e+01,  5.087420698690e+00,  5.572690529472e+00,
+	-1.162782778495e+00, -1.096611175365e+00, -1.873004674726e+00,
+	 1.191850873101e+00, -2.624870548749e+00,  4.072427387263e-01,
+	 4.059500730135e-01,  5.809827535218e-01,  7.928391520504e+00,
+	 2.779369698098e+00,  3.456540072900e+00,  7.830792488315e-01,
+	 4.753410461849e+00,  1.927925368708e+00,  2.388408241585e+00,
+	 5.693248167150e+00,  1.141123204030e+01,  1.192331627159e+01,
+	 6.666919054489e+00,  8.510962617547e+00,  4.089626870161e+00,
+	-1.224326435289e+01,  3.431508301960e+00,  3.957574189466e+00,
+	 1.027398406169e+02, -8.338514066157e+00, -4.097909925188e+00,
+	-2.973185056749e+00, -2.782068047439e+00,  2.729409832148e+00,
+	 1.065902122993e+00,  5.012432830290e-01, -3.613154156367e+00,
+	 6.889578795694e-01, -5.611144369651e-01,  4.031072889344e+00,
+	 3.122192814028e+00,  1.106142156362e+01,  4.445580631797e+00,
+	 3.620786177255e+00,  1.818529234691e+00,  1.291796501772e+00,
+	 5.105290795136e+00,  3.942845800978e+00,  6.538915679134e+00,
+	 5.851345473560e+00,  9.597857089532e+00,  4.981788127554e+00,
+	-7.531441074160e+00,  8.697969762798e+00, -2.088462288343e+00,
+	-6.852767854379e-01, -2.064016879210e-02,  1.456835912736e+00,
+	 3.090711690084e+00,  2.772592109608e+00,  5.739832940490e-01,
+	 2.715103187041e+00,  2.285141576036e+00,  2.926653816433e+00,
+	 5.248529057164e+00,  1.329704366766e+01,  8.919070783472e+00,
+	 5.591878380032e+00,  6.442216870324e+00,  3.073541557360e+00,
+	 7.020622315125e+00,  6.097907247659e+00, -5.297355703432e+00,
+	 1.553497773043e+01,  9.540219358805e+00,  1.230881342598e+01,
+	-9.377746354727e+00,  7.065855978652e+00,  9.413723065305e+01,
+	-3.766746276574e+00,  8.728167739136e-02, -3.571550258759e+00,
+	-5.270493401612e-01,  2.273467378119e+00, -1.831705872341e+00,
+	-4.263890114734e+00, -2.142159352763e+00, -1.461896057301e+00,
+	 1.645442417103e+00,  4.575982226581e+00,  1.321372680238e+01,
+	-3.451302164383e+00,  7.303495620369e+00,  1.014709932633e+01,
+	 5.109253424275e+00,  6.130800956538e+00,  4.400439543013e+00,
+	 4.934647502956e+00,  5.848106058619e+00,  9.540219358805e+00,
+	 5.279814519166e+00,  1.108837371529e+01, -1.360046201300e+01,
+	 8.596065312587e-01,  1.968441873893e+00,  8.923842269424e-01,
+	 1.271906854840e+00,  1.866096847607e+00, -2.370334911737e+00,
+	-1.395355716380e+00, -5.388236331488e-01,  3.346680124015e+00,
+	 3.607110079859e+00,  4.089626870161e+00,  1.282342896223e+01,
+	 3.147559236067e-01,  6.044297742142e+00,  1.363256479725e+01,
+	 3.787611753904e+00,  5.938872879610e+00,  4.111966611895e+00,
+	 6.241802654244e+00,  7.278046669974e+00,  2.952584789772e+00,
+	 5.433695619918e+00,  2.348732533831e+01, -1.095648314267e+00,
+	 9.643003993838e+01,  3.602497640164e+00,  2.613368597100e+00,
+	 2.512771427879e+00, -1.370020588042e+00, -1.679905024308e+00,
+	 1.542832718953e+00, -3.298152349902e-01,  1.530384771424e+00,
+	 6.922074314520e-01, -1.998506975319e+00, -2.908995640068e+00,
+	 2.032442919958e+00, -3.746196596630e-01,  1.741819384095e+00,
+	 5.092808644586e-02, -1.433053659009e+00, -3.167986426739e+00,
+	 3.953003306613e+00, -5.590329449613e+00, -3.604350182078e+00,
+	-6.872364324784e+00, -6.403934677445e+00, -4.232996855601e+00,
+	-3.543624885691e+01, -1.556112555510e+01, -3.449183212854e+00,
+	-1.784818972042e+01, -3.937935079379e+00, -2.707398102478e+00,
+	-2.884468624642e+00, -2.127545451841e+00, -4.370949407864e+00,
+	-2.140306424411e+01, -4.089386035084e+00, -4.344792921163e+00,
+	-2.233640792970e+00, -3.041364628188e+00, -3.951236775656e+00,
+	-4.112944929572e+00, -7.186374008370e+00, -4.270796231530e+00,
+	-1.392857184169e+01, -2.111362245076e+00, -3.424324632603e+00,
+	-3.208098722000e+00, -6.034433774569e+00, -3.801824532655e+00,
+	 9.558856130062e+01, -1.728338669924e+00, -1.504328811926e+01,
+	 2.208468171966e-01, -7.218108880326e-01,  8.399192354944e-01,
+	-7.753290987648e-01, -8.315160260822e-01, -1.532857981946e+01,
+	-1.894520575050e+00, -2.509662021919e+00,  8.664816344825e+00,
+	 4.016475882967e-01, -6.108946848553e-01, -7.372084845887e-01,
+	-2.051918278685e+00,  4.506886272349e-01,  3.069145866814e-01,
+	-2.345113472698e-01, -4.054854472275e-01,  7.687474184356e-01,
+	 4.935111399241e-01, -1.397583410209e+00,  2.445496216654e+00,
+	-1.473039643827e+01, -1.198321946146e+00,  2.667203715066e+00,
+	 7.525234379727e-01, -2.029318493937e+00, -1.349970109104e+00,
+	-1.650357334376e+00, -1.326771975566e+00,  2.177868858619e+00,
+	-1.453703516421e+00, -4.105912990416e+00,  4.420997494786e+00,
+	-7.011503139073e-01, -2.520509178183e+00, -1.748883572120e+00,
+	-1.017282612133e+00, -6.555006191468e-01, -1.319885161179e+00,
+	-2.422870916489e+00,  6.480601053563e-01, -1.791906368604e+00,
+	 9.635617303076e-01, -8.227616271203e-01,  9.809863073055e+01,
+	 3.595736760154e-01,  4.704092386074e+00,  2.820725206637e+00,
+	 1.892148962805e+00, -1.597058633179e-01,  1.774562871049e+00,
+	 1.158202353373e-01,  3.333428005631e+00,  7.026949447723e-01,
+	 3.517500545617e+00, -1.493992392610e+00,  2.285396484093e+00,
+	-8.529239837004e-01,  8.885832494799e-01, -1.636068969221e+00,
+	-3.783015785345e+00,  6.341081502003e+00, -3.309819845396e+00,
+	-4.772120843622e+00, -5.334855240480e+00, -3.144905682561e+00,
+	-4.197126666942e+00, -2.670532264024e+00, -3.623867046976e+01,
+	-3.243619297766e+00, -1.803013077051e+01, -1.695430235178e+01,
+	-4.564092393008e+00, -9.738491668737e-01, -5.225276657993e+00,
+	-4.740873293535e+00, -6.245022779066e+00, -1.816473444000e+01,
+	-2.853509113382e+00, -2.998594331596e+00, -4.370949407864e+00,
+	-6.137967782999e+00, -4.338299165747e+00, -3.993708883587e+00,
+	-1.978085165551e+00, -1.319430480890e+01, -3.527029313144e+00,
+	-2.905663794295e+00, -5.496898625692e+00, -3.313817106892e+00,
+	 8.957516331704e+01,  1.764784258659e+00,  7.365669004754e-01,
+	-1.328491639461e+00, -4.808481371397e-01, -1.015503675000e+00,
+	-1.759874022665e+01,  1.318733494951e+00,  5.869048258890e-01,
+	 7.736240594672e+00,  7.365669004754e-01, -1.958013294144e-01,
+	 3.370991107910e-01,  1.508312842266e+00, -1.390592210966e+00,
+	 9.779043988224e-02,  1.508312842266e+00,  2.729409832148e+00,
+	-1.299453121381e+00,  2.788911106807e+00,  1.430732204785e+00,
+	 2.834483922745e-01,  5.262491555474e+00, -1.402969120339e+00,
+	-1.759874022665e+01, -3.768706863233e-01,  3.370991107910e-01,
+	-4.052264477968e+00,  7.339190997350e-01, -2.966081719152e+00,
+	 2.203458007608e-01, -6.758884829443e-01, -1.562366168442e-01,
+	 6.334450731912e+00,  5.869048258890e-01, -1.303277129674e+00,
+	-1.562366168442e-01, -1.299453121381e+00, -3.123380445759e+00,
+	-3.496502067220e+00, -1.390592210966e+00, -5.270493401612e-01,
+	-3.123380445759e+00,  1.430732204785e+00,  1.706579902624e-01,
+	 9.792792542430e+01, -1.113906708122e+01, -2.671675459565e+00,
+	 2.082554746308e-01,  2.629500276460e+00, -5.206693234587e-01,
+	 1.334722732491e+00, -1.274971040765e+01, -2.290046014199e+00,
+	 8.807311070374e+00,  9.672803486650e-02, -2.345152774570e+00,
+	 8.218535512191e-01,  1.611588167261e+00,  3.598566356990e+00,
+	 1.013261080393e+00,  3.466674258585e+00,  1.123942412490e+00,
+	 1.369583519417e+00,  3.266755196989e+00, -1.213912204195e+00,
+	-1.770001316586e+00,  4.663671824417e+00,  2.081597593152e+00,
+	-1.139997753142e+01,  7.179343504372e+00,  9.091988927309e-01,
+	 2.925649669577e-01, -1.035265169900e+00,  6.578391326512e-01,
+	 3.603172949362e+00,  4.855767222409e+00,  8.312065129088e-01,
+	 8.643816426594e+00,  2.922110674780e+00,  4.934039777925e-01,
+	 2.256917174712e+00,  3.626068944822e+00,  2.739717845743e+00,
+	 8.495879428693e-02,  2.545811899239e+00, -5.803234253964e-01,
+	 2.196864864521e-01,  2.021832568728e+00,  9.278539280947e+01,
+	-2.191632277969e+00, -3.320966481405e+00, -1.203608631096e+00,
+	-6.016766285328e-01,  2.419060466050e+00, -1.594801584324e+01,
+	-7.623302751877e-02,  1.077796497590e+01,  1.321445445491e+00,
+	 1.699545123050e-02,  1.125026306443e+00,  1.051582537081e+00,
+	 2.072072528618e+00,  1.123382800455e+00,  3.620786177255e+00,
+	 2.914760062705e+00,  6.915876876354e-01, -1.483039790023e+00,
+	 1.637433315043e+00,  4.191960109920e-01,  5.828892244413e+00,
+	 1.758326144612e+00,  7.393128167836e+00, -1.624024783257e+01,
+	-1.485642957200e+00, -4.519468385002e+00,  2.357004646701e+00,
+	 1.729966530416e+00,  1.347104620718e+00,  3.267828806549e+00,
+	 1.416742656010e+00,  1.141590726853e+01, -7.941333429609e-01,
+	 8.645112766494e-01,  1.455288447581e+00,  7.168638144989e-01,
+	 4.421542495743e+00,  3.381035142867e+00,  7.303495620369e+00,
+	 3.518308208680e+00,  2.786433422247e+00, -4.243970352945e-02,
+	 9.805012380843e+01,  2.388369299110e+00,  1.329883501280e+00,
+	-1.135477341558e+00, -2.981997461892e+00, -2.757195225164e+00,
+	 1.915727932382e+00,  2.058401480479e+00,  2.042384101878e+00,
+	 2.139716096727e+00, -3.777336276928e+00, -2.096137113553e+00,
+	-4.060872510365e+00, -2.421092816485e+00,  5.382380267126e+00,
+	-2.875164802643e+00, -4.869376815950e+00, -7.366581755986e+00,
+	-5.367991489997e+00, -1.252866663523e+00, -2.369407090090e+00,
+	-4.800443070960e+00, -1.885301049067e+00, -3.042327186389e+00,
+	-3.619480238401e+01, -1.702162525005e+01, -2.853509113382e+00,
+	-3.914941677540e+00, -2.070733228092e+00, -3.618845571383e+00,
+	-4.998804847380e+00, -1.808744366841e+01, -2.233640792970e+00,
+	-1.796606200955e+01, -3.066860590088e+00, -6.042866779721e+00,
+	-5.531412309654e+00, -3.639802435673e+00, -1.409124404267e+01,
+	-4.141063210467e+00, -3.047689591838e+00, -5.327642310577e+00,
+	 9.425527881076e+01,  1.055281165474e+00, -1.026121687826e-01,
+	-1.386393553465e+00, -3.095239320961e+00,  6.983596632957e-02,
+	-1.483566270793e+01,  7.794731202832e+00, -1.514655589180e+01,
+	-3.320010418410e-01, -2.497536897801e+00,  5.984784451369e-01,
+	 3.419865282762e-01,  3.033581165885e-01,  1.001012164120e+00,
+	 1.150992026923e+00,  2.676029407895e+00, -8.463871436685e-02,
+	-3.798019435484e-01, -2.272390005762e+00,  2.776161185327e-01,
+	 1.121857935227e+00, -1.830795891540e+00,  1.942035111048e+00,
+	-1.529788411643e+01, -2.032638401305e+00, -3.540298019642e-01,
+	-5.324322134884e-01, -1.088611273287e+00, -1.833095037434e+00,
+	 9.824378689400e-01,  3.059219503326e+00,  1.836798978688e+00,
+	 6.253261181329e-01,  5.208504137773e-03,  5.307627242695e-02,
+	-3.802109614301e-01, -3.022213996320e+00,  6.170253131144e-02,
+	-3.003794026140e+00, -1.724600209857e+00,  9.821959150608e+01,
+	 1.914982132685e-01,  3.187005775045e+00,  6.184546668867e-01,
+	 3.273675383866e+00, -2.884333608863e-01,  3.015212998027e+00,
+	-2.571977408589e-01,  5.308777594883e+00,  2.528696028619e+00,
+	-3.780929602403e+00, -4.703701697788e+00, -3.580841026880e+00,
+	 6.358503366212e+00, -5.292774084780e+00, -2.932848967644e+00,
+	-4.779862067372e+00, -5.159253821751e+00, -5.346237433529e+00,
+	-3.546148341208e+00, -6.226323306043e+00, -3.668400173658e+00,
+	-4.227967275861e+00, -2.552343844660e+00, -3.623867046976e+01,
+	-1.747552032831e+00, -1.835753035065e+01, -2.775017412670e+00,
+	-2.369407090090e+00, -4.732801646161e+00, -3.449183212854e+00,
+	-1.485240321581e+00, -1.735427217697e+01, -1.676345773738e+01,
+	-5.379060010957e-01, -1.615027943979e+00, -2.434341346827e+00,
+	-1.192430452262e+01, -4.175255724829e+00, -2.004258413994e+00,
+	 9.265781171538e+01,  2.973373472682e+00,  2.898209759739e+00,
+	 7.332794443735e+00,  1.758326144612e+00,  7.523583977178e-01,
+	 2.136487764326e+00,  1.145973465451e+00,  1.317289517217e+00,
+	 6.460187774569e-01,  2.927674572077e+00,  1.456835912736e+00,
+	 3.052664247082e+00,  4.686679421839e+00,  3.967757426157e+00,
+	-3.026129191361e+00,  4.026522121836e+00, -3.051996146791e+00,
+	 6.818137073657e-02, -2.654682888356e+00, -1.214529288135e+00,
+	-2.576970659118e+00, -6.957410990949e-01, -1.652651858413e+00,
+	-1.519985714196e+01,  1.191850873101e+00,  2.719488440316e+00,
+	 6.733606045257e+00,  2.021752152485e+00,  2.289702072485e-01,
+	 1.514050621450e+00, -6.145094317617e-01,  2.046817637996e+00,
+	-3.046752274588e+00, -6.429579141658e-01,  1.271906854840e+00,
+	-1.403807678794e+00,  3.003809127256e+00,  2.337977449684e+00,
+	 9.751061653521e+01,  2.259172468563e+00, -1.796657275996e+00,
+	-6.425326534270e-01,  3.170094086437e-01,  1.038041091126e+01,
+	-1.221029955188e+01, -1.125058937662e+01,  3.102568921365e+00,
+	 1.322885379964e+00,  3.944318498646e+00,  8.237339231789e-01,
+	 1.537288826910e+00,  3.179031156918e+00, -1.559066702295e+00,
+	-7.714344754110e-01,  7.195832776668e-01,  1.946059431946e-01,
+	 2.149466681851e+00,  3.357905241379e+00,  3.013022099523e-01,
+	 1.048607983245e+00,  3.721982258708e+00,  8.882315943526e-01,
+	-1.205867682214e+01,  4.677240151748e+00,  1.236200425223e+00,
+	 1.414393533018e+00,  3.695306220970e+00,  9.166912330762e+00,
+	 6.659350941825e+00,  7.917203302918e+00,  3.378962900472e+00,
+	 1.067529385234e+00,  4.188852172306e+00,  1.074167320036e+00,
+	 1.674442526061e+00,  3.372434726074e+00,  9.274903098977e+01,
+	 1.819684527024e+00,  1.141590726853e+01,  1.396560743047e+00,
+	 3.587693382515e+00,  3.052739500993e+00,  3.618552637972e+00,
+	 2.691558853325e+00,  2.139107897563e+00,  5.591878380032e+00,
+	 4.708114569212e+00,  1.197611596008e+00,  2.093205223347e+00,
+	 8.353369742732e-01, -1.910848175947e+00,  4.480723672471e+00,
+	 2.021752152485e+00,  7.541952293392e+00,  3.736196427945e+00,
+	-2.350726516785e+00, -3.199985588940e+00,  4.628791464403e+00,
+	 3.445683261855e+00,  1.927925368708e+00, -1.437509557119e+01,
+	-9.408018770319e-01,  1.100672615238e+01,  2.068494564446e+00,
+	 2.991334631446e+00,  2.872874512198e+00,  3.005278579183e+00,
+	 4.614522252283e+00,  4.059405706693e+00,  6.044297742142e+00,
+	 8.269544203279e+00,  2.677993416960e+00,  4.158921298313e+00,
+	 9.835583459969e+01,  8.405012374180e-01,  3.479598641330e+00,
+	-7.894357475659e-02, -2.373314797010e+00,  5.453315589581e-01,
+	-6.222952963445e-02,  9.264816652456e-01, -2.400155132297e+00,
+	 1.882415022401e+00,  8.389963324371e+00, -4.993383036552e+00,
+	-6.658124915945e+00, -5.024674488049e+00, -4.227967275861e+00,
+	-3.869614355508e+00, -1.715286422616e+00, -4.330044494768e+00,
+	-5.290379121478e+00, -4.489830288734e+00, -4.564092393008e+00,
+	-3.275619006210e+00, -1.920294231742e+00, -5.606828428998e+00,
+	-3.619480238401e+01, -2.158681597749e+00, -2.884468624642e+00,
+	-2.113933007862e+00, -2.225683045697e+00, -4.225560845873e+00,
+	-1.839768658979e+01, -1.732201712213e+01, -1.757735704956e+00,
+	-1.678778152128e+01, -1.273599228229e+01, -4.698931478856e+00,
+	 9.278539280947e+01,  8.129106728840e+00, -1.624024783257e+01,
+	 1.123382800455e+00,  3.381035142867e+00,  2.069499853586e+00,
+	 1.125026306443e+00,  5.012432830290e-01,  1.455288447581e+00,
+	 6.915876876354e-01,  2.786433422247e+00, -1.395018355619e+00,
+	-2.042071667166e+00, -2.658844328545e+00, -6.016766285328e-01,
+	-9.667636843036e-01,  1.699545123050e-02, -3.348585249309e-02,
+	 1.478463607113e+00, -2.880723420834e+00,  1.729966530416e+00,
+	 1.408741408739e+00,  8.645112766494e-01, -1.168805996024e+00,
+	-1.594801584324e+01,  5.802880078672e+00,  3.267828806549e+00,
+	 2.914760062705e+00,  3.518308208680e+00,  2.053018965971e+00,
+	 1.051582537081e+00, -1.831705872341e+00,  7.168638144989e-01,
+	-1.483039790023e+00, -4.243970352945e-02,  1.017027964604e+02,
+	 7.969979784510e+00,  1.026057205460e+00,  1.887729392864e+00,
+	-1.830141397350e+00, -1.749311050860e+00, -3.589715520263e-01,
+	-8.175456302712e-01,  1.025589378621e+00,  8.607179336733e+00,
+	-4.262693413594e+00, -4.433495513999e+00, -4.779862067372e+00,
+	-2.661628305516e+00, -1.901016383406e+00, -5.101307646314e+00,
+	-6.658124915945e+00, -6.054541608477e+00, -4.197126666942e+00,
+	-1.007180511893e+00, -2.051323545871e+00, -1.413148855904e+00,
+	-5.367991489997e+00, -4.148582240389e+00, -3.543624885691e+01,
+	-3.250725426137e+00, -9.833693428724e-01, -1.436616697598e+00,
+	-3.966875133960e+00, -4.090708814997e+00, -1.741343395461e+01,
+	-2.905716965306e+00, -1.577146963971e+01, -2.969341464189e+01,
+	 9.213653555158e+01,  1.163250472437e+01,  1.385279655634e+01,
+	 4.365016616731e+00,  4.266228303961e+00,  2.772592109608e+00,
+	 2.836545365296e+00,  3.325173908952e+00,  5.760912464081e+00,
+	-3.346504759611e+00, -1.958838045730e+00, -4.452361553933e+00,
+	-1.214529288135e+00, -1.439488806184e-01,  1.204362151995e+00,
+	-2.442229848891e-01,  4.417972865159e+00, -1.564320152131e+00,
+	 1.020501379310e+00,  4.072427387263e-01,  4.247314768144e+00,
+	-1.199224329591e+00,  3.736196427945e+00,  7.294880514924e+00,
+	-1.615534578423e+01,  2.014153207221e+00,  2.918967159751e+00,
+	 6.514720168175e-01,  5.304757044775e-01, -2.370334911737e+00,
+	 1.660417012359e-01, -9.637049213501e-01,  2.116156648272e+00,
+	 9.472986961586e+01, -1.200894313004e+01,  1.380487633063e+01,
+	 1.515807479432e+01,  5.851345473560e+00,  1.413276130267e+01,
+	 3.324055776318e+00,  5.422451484902e+00, -5.448488874442e+00,
+	-2.339857766248e-01,  2.669645857372e-01,  2.927674572077e+00,
+	 2.686559002880e+00,  4.266228303961e+00,  1.160665176664e-01,
+	 1.144794431507e+00,  4.275172888550e+00,  1.577704537606e+00,
+	 9.268116694607e+00,  4.822876651696e+00,  1.342642077732e+00,
+	 2.139107897563e+00,  4.836447461486e+00,  1.257848023690e+01,
+	-1.200204628982e+01,  9.428492537503e+00,  2.189875166806e+00,
+	 4.157778776832e+00,  5.848106058619e+00,  3.237900089911e+00,
+	 3.492491654036e+00,  5.643164485555e+00,  9.645187011145e+01,
+	 2.523572268464e+00,  4.157778776832e+00,  1.553497773043e+01,
+	 3.473358105703e+00,  1.367630178786e+01,  1.328184057653e+01,
+	 1.268434943283e+00,  1.576985794401e+00,  2.931824983821e+00,
+	-6.429579141658e-01,  1.972105926837e+00,  5.304757044775e-01,
+	-5.887966196285e+00, -1.374106848530e+00,  7.199345387488e+00,
+	 2.729363586295e+00,  8.510962617547e+00,  2.269074240177e+00,
+	 2.098094156850e-02,  4.059405706693e+00,  1.395510416804e+00,
+	 1.484689417767e+01,  6.803783661084e+00, -1.268392407684e+01,
+	 5.647224242487e+00,  7.362412567751e+00,  7.278046669974e+00,
+	 6.855703623591e+00,  6.144011332534e+00,  5.804960117660e+00,
+	 1.028730003366e+02, -8.617100239577e+00,  6.256703588025e+00,
+	-7.462086587433e+00,  4.909188564705e+00,  5.119857452701e+00,
+	-8.413959821550e+00,  1.172889267798e+01,  4.276523016489e+00,
+	 1.072870140559e+01,  1.633643980228e+00,  1.971893025908e+00,
+	 2.824122585137e+00,  2.464543298102e+00,  4.353514092073e+00,
+	 1.070751525353e+01,  1.220984833694e+00,  2.445507097984e+00,
+	 6.913295825353e+00,  3.492461983959e+00,  4.267290749018e+00,
+	 5.494486379864e+00,  1.123693803017e+01,  2.338510440781e+00,
+	-8.297541563950e+00,  7.212473530872e+00,  5.644322734034e+00,
+	 9.295759960709e+00,  5.253510921143e+00,  5.365853466937e+00,
+	 9.472986961586e+01,  5.105290795136e+00, -1.200204628982e+01,
+	 3.324055776318e+00,  3.492491654036e+00,  1.937316936543e+00,
+	 8.175100648609e-03, -7.239767441242e+00,  1.145973465451e+00,
+	 1.139822559534e+01,  1.163250472437e+01,  3.721822544441e+00,
+	 2.602784094762e+00,  3.854178165127e+00,  1.577704537606e+00,
+	-2.426244342009e-01,  1.257848023690e+01,  7.855724348795e+00,
+	 3.052739500993e+00,  5.399160989020e+00,  4.822876651696e+00,
+	 1.413276130267e+01,  3.237900089911e+00,  1.170347912756e+01,
+	-1.200894313004e+01,  6.130800956538e+00,  9.428492537503e+00,
+	 5.422451484902e+00,  5.643164485555e+00,  1.027398406169e+02,
+	 7.020622315125e+00, -7.531441074160e+00, -9.377746354727e+00,
+	 1.780892716323e+00,  1.200368596232e+00,  3.233504094688e+00,
+	 4.031072889344e+00,  2.994880547066e+00,  1.291796501772e+00,
+	-8.392910900020e+00,  1.147623960344e+01,  3.047752985594e+00,
+	 2.926653816433e+00,  3.333572246767e+00,  3.073541557360e+00,
+	 5.246599889640e+00,  1.106142156362e+01,  8.422734964478e+00,
+	 1.329704366766e+01,  4.981788127554e+00,  1.230881342598e+01,
+	 4.866839874631e+00,  3.942845800978e+00, -8.338514066157e+00,
+	 6.097907247659e+00,  8.697969762798e+00,  7.065855978652e+00,
+	 9.866846183067e+01,  7.186962222119e+00,  7.318037589393e+00,
+	 2.227047516773e+00,  2.619439411635e-01,  3.957918939460e+00,
+	-6.145094317617e-01, -1.753649010648e-01,  2.014153207221e+00,
+	 3.512837651510e+00,  2.259724475421e+00, -7.097320861696e+00,
+	 4.677339742782e+00,  1.141123204030e+01,  3.817434601725e+00,
+	 7.421329582258e+00,  2.872874512198e+00,  4.328867323995e+00,
+	 5.714342860534e+00,  2.466072236085e+01,  1.390060862748e+01,
+	 1.145175163353e+01,  6.803783661084e+00,  5.938872879610e+00,
+	-9.872296499075e+00,  5.826660099257e+00,  5.836499973667e+00,
+	 9.876456812015e+01, -1.069005025805e+01,  3.815096866028e+00,
+	 1.922411765947e+00,  4.825798459014e+00,  4.686679421839e+00,
+	 4.962414278088e+00,  3.325173908952e+00,  2.436977552096e+00,
+	 6.064014729740e-01,  4.969935523010e+00,  6.980515913471e+00,
+	 5.087420698690e+00,  3.534026484252e+00, -5.554027882823e+00,
+	 1.197611596008e+00,  8.350945013180e+00,  3.534026484252e+00,
+	 7.186962222119e+00,  1.656124109206e+01,  1.528332153163e+01,
+	 1.367630178786e+01,  1.108837371529e+01,  1.656124109206e+01,
+	-1.069005025805e+01,  6.945113644340e+00,  9.505495735115e+01,
+	 1.726845253088e+00,  1.358244315756e-01,  2.766598686302e+00,
+	 3.003809127256e+00,  3.357250305437e+00, -9.637049213501e-01,
+	 5.510653782647e+00,  2.388187317455e+00,  2.763559732723e+00,
+	 5.593924666738e+00,  3.431508301960e+00,  3.304753521488e+00,
+	 7.684382200426e+00,  2.677993416960e+00, -6.798830473095e-02,
+	 6.189716297832e+00,  5.826660099257e+00,  1.463302254983e+01,
+	 7.809624182921e+00,  6.144011332534e+00,  2.348732533831e+01,
+	 8.956758412540e+00,  2.119065301237e+01, -2.010284433084e-01,
+	 1.017027964604e+02, -1.176026535132e+01,  3.015212998027e+00,
+	-1.257370718421e+01,  3.589747706759e+00,  1.445291230623e+00,
+	 3.479598641330e+00,  2.169936748497e+00,  2.285396484093e+00,
+	-1.386473226855e+01,  2.436584065765e+00,  1.018935344832e+00,
+	 2.042384101878e+00,  2.012813830950e+00,  1.741819384095e+00,
+	 1.709723512905e+00,  2.177039435268e+00,  7.880721262169e-01,
+	 1.258798490474e+01,  1.396541830474e+00,  2.277526143913e+00,
+	 1.619280123897e+00,  4.240561051655e+00,  1.908460539134e+00,
+	 9.243478191755e+01,  3.470374939446e+00, -1.464638524846e+01,
+	 2.262909316539e+00, -3.100571294301e-02,  2.382632629644e+00,
+	 1.878729158774e+00,  1.935123261318e+00, -1.484005674089e+01,
+	 2.897914106349e+00, -1.917764053845e+00,  5.929515168959e-01,
+	 1.282483886717e+00,  2.876991281206e+00,  2.229989106936e+00,
+	 2.996086680657e+00,  6.255865808762e-01,  1.294236416278e+01,
+	 1.879421398968e+00,  2.403756399647e+00,  2.370602470035e+00,
+	 3.574412544294e+00,  1.779269009384e+00,  9.821959150608e+01,
+	 2.101138762341e+00, -1.087519161753e+01, -1.268143958737e+01,
+	 3.273675383866e+00,  1.654428549560e+00,  1.774562871049e+00,
+	 1.709882678194e+00,  3.903504901432e+00, -1.264570441710e+01,
+	 1.329883501280e+00,  1.962703249421e+00,  1.530384771424e+00,
+	 1.240395017525e-01,  1.390819755889e+00,  1.174164861452e+00,
+	 2.061253084934e+00,  1.194165228981e+01,  3.067456987635e+00,
+	 1.771529416317e+00,  4.638619375456e+00,  2.642660373778e+00,
+	 9.265781171538e+01,  4.012808078943e+00,  2.136487764326e+00,
+	 9.082357548086e-01,  2.944674078974e+00,  2.324308770865e+00,
+	-1.519985714196e+01,  7.359884362462e-01,  1.514050621450e+00,
+	 8.547452986833e-01,  2.898209759739e+00,  2.305473049319e+00,
+	 2.719488440316e+00,  3.052664247082e+00, -1.403807678794e+00,
+	 1.144420990562e+01,  1.317289517217e+00,  1.645442417103e+00,
+	 2.046817637996e+00,  3.967757426157e+00,  2.337977449684e+00,
+	 9.623288235143e+01, -1.240197707428e+01,  2.115403018659e+00,
+	 8.971252047384e-01,  3.813867157833e+00,  1.658673176060e+00,
+	 5.955798164640e+00, -1.477458972653e+01,  2.005945896488e+00,
+	-1.583198579187e-01,  1.546813244233e+00,  2.849397904601e+00,
+	 4.091907345714e+00,  3.016385531950e+00,  6.607416217983e-01,
+	 1.039773108504e+01,  2.127040208223e+00, -4.978174845623e-01,
+	 4.225686987885e+00,  2.618502683801e+00,  9.213653555158e+01,
+	 4.813011069853e+00,  1.830820307250e+00,  8.273777261529e-01,
+	 1.020501379310e+00,  3.357280593681e+00, -1.615534578423e+01,
+	 3.513668774140e+00,  3.587693382515e+00,  6.161962224305e+00,
+	 4.247314768144e+00,  2.836545365296e+00,  1.660417012359e-01,
+	 4.110489866789e+00,  1.385279655634e+01,  5.109253424275e+00,
+	 2.918967159751e+00,  5.760912464081e+00,  2.116156648272e+00,
+	 9.835583459969e+01, -1.083438350932e+01,  3.517500545617e+00,
+	 1.406800506110e+00,  1.713590223900e+00,  3.991446696014e+00,
+	 1.915727932382e+00, -1.235829584516e+01,  2.032442919958e+00,
+	-1.276036805861e+01,  1.761706826520e+00,  3.870260047783e+00,
+	 1.637282693123e+00,  2.465329951839e+00,  1.086704431938e+01,
+	 2.185227736102e+00,  2.833151261579e-01,  3.321916614923e+00,
+	 9.364261020935e+01,  1.122972089771e+00,  1.686640984030e+00,
+	 2.167230955157e+00,  2.479303162059e+00,  3.225811061359e+00,
+	-1.579056035613e+01,  4.666152903875e-01, -1.497169980516e+01,
+	 2.005509099976e+00,  4.263486161716e+00,  1.958044531414e+00,
+	 2.176865652904e+00,  1.107964915788e+01,  2.185800163934e+00,
+	 1.173906954842e+00,  3.105321371847e+00,  9.809863073055e+01,
+	 3.041873824281e+00, -1.061873030797e+01,  1.736343164994e+00,
+	 1.892148962805e+00,  1.107359958167e+00,  2.613368597100e+00,
+	 3.033025904912e+00, -1.123852794783e+01, -1.167297866308e+01,
+	 3.368861080248e+00,  2.967502268886e+00,  4.132541158062e+00,
+	 1.335345077867e+01,  6.049670909548e+00,  3.975850193648e+00,
+	 9.543613125367e+01,  2.779369698098e+00,  3.531623574367e+00,
+	 8.661544541897e-01,  3.445683261855e+00,  2.521736977353e+00,
+	 3.531623574367e+00,  4.677339742782e+00,  3.149849484259e+00,
+	 1.213250787363e+01,  2.729363586295e+00,  3.607110079859e+00,
+	 3.149849484259e+00,  5.593924666738e+00,  4.003048096286e+00,
+	 9.290816092733e+01,  5.693248167150e+00,  2.853564764686e+00,
+	 3.701107506882e+00,  2.946368918109e+00,  7.830792488315e-01,
+	-1.096961967365e+01, -1.224326435289e+01,  1.512140931027e+00,
+	 6.773275636975e-01,  3.613540478059e+00,  1.192331627159e+01,
+	 5.572690529472e+00,  3.957574189466e+00,  9.303690897467e+01,
+	 4.395057575409e+00,  2.991334631446e+00,  5.345314793319e+00,
+	 6.879487540206e+00,  5.714342860534e+00,  3.193681447306e+00,
+	 4.701132815293e+00,  1.484689417767e+01,  3.787611753904e+00,
+	 7.414298793425e+00,  6.189716297832e+00,  5.385231714680e+00,
+	 9.805012380843e+01,  2.939312025270e+00,  1.542832718953e+00,
+	 2.376676716996e+00,  2.754969555675e+00,  2.445448251375e+00,
+	-1.137718812299e+01, -1.041791013693e+01,  1.836172744510e+00,
+	-1.119770460073e+01,  1.203682255248e+01,  3.958633206773e+00,
+	 9.274903098977e+01,  1.028996681257e+00, -1.437509557119e+01,
+	 4.708114569212e+00,  8.269544203279e+00,  4.070223633294e+00,
+	 3.618552637972e+00,  1.321372680238e+01,  3.005278579183e+00,
+	 2.093205223347e+00,  4.158921298313e+00,  9.643003993838e+01,
+	 1.032036931573e+00,  3.662371906904e+00,  5.442738728633e+00,
+	 1.880999975506e+00,  3.113726507635e+00, -1.290376043377e+01,
+	 2.557303867076e+00, -1.246585631575e+01,  5.149375912347e-01,
+	 9.303690897467e+01,  3.817434601725e+00,  7.414298793425e+00,
+	 2.849564574670e+00,  2.269074240177e+00,  1.282342896223e+01,
+	 3.193681447306e+00,  3.304753521488e+00,  5.385231714680e+00,
+	 9.866846183067e+01, -9.872296499075e+00,  1.261198349478e+00,
+	 3.473358105703e+00,  5.279814519166e+00,  1.390060862748e+01,
+	 7.318037589393e+00,  5.836499973667e+00,  9.514104457343e+01,
+	 5.968337421429e+00,  6.855703623591e+00,  5.433695619918e+00,
+	 1.733597616587e+01,  8.956758412540e+00,  7.042088243779e+00,
+	 9.582535609152e+01, -1.149379246006e+01,  3.821326467607e+00,
+	-1.281697780429e+01,  1.313791984167e+01,  5.442495263029e+00,
+	 9.645187011145e+01,  4.400439543013e+00, -1.268392407684e+01,
+	 1.328184057653e+01,  5.804960117660e+00,  9.413723065305e+01,
+	 4.111966611895e+00, -1.360046201300e+01, -1.095648314267e+00,
+	 9.514104457343e+01,  1.463302254983e+01,  7.042088243779e+00,
+	 9.505495735115e+01, -2.010284433084e-01,  1.198364253182e+02,
+};
+
+#endif
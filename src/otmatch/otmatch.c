@@ -30,6 +30,7 @@
  *
  */
 
+
 /*
  * Implementation for the Overlapping Template Matching Test.
  */
@@ -39,122 +40,345 @@
 #include <errno.h>
 #include <string.h>
 #include <stddef.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
-#include <hamming8.h>
+#include <cdefs.h>
+#include <bits.h>
+#include <igamc.h>
 #include <otmatch.h>
 
 /*
- * Private context for the test.
+ * Private context for the test. The stream is matched in 64-bit words,
+ * the bits of an incomplete word are kept until the next update.
  */
 struct otmatch_ctx {
-	unsigned int	nbits;		/* number of bits processed */
-	unsigned int	m;
-	uint8_t	*	B;
-	unsigned int	K;
-	unsigned int	M;
-	unsigned int	N;
-	unsigned int	v[5];
-	double		alpha;		/* significance level fo H0 */
+	unsigned int	nbits;	/* number of bits processed */
+	unsigned int	nbmax;	/* number of bits tested, N * M */
+	unsigned int	m;	/* length of the template */
+	unsigned int	K;	/* number of degrees of freedom */
+	unsigned int	M;	/* length of each block */
+	unsigned int	N;	/* number of blocks */
+	unsigned int	pos;	/* position of the next word */
+	unsigned int	bend;	/* position of the end of the block */
+	unsigned int	cnt;	/* matches in the current block */
+	uint64_t	prev;	/* the last matched word */
+	uint64_t	acc;	/* bits of the next word, from msb */
+	unsigned int	nacc;	/* number of bits in acc */
+	uint64_t	f[OTMATCH_MAX_TMPL_M];	/* complement masks of B */
+	unsigned int	v[OTMATCH_MAX_K + 1];	/* blocks by matches */
+	double		pi[OTMATCH_MAX_K + 1];	/* probabilities of v */
+	double		alpha;	/* significance level fo H0 */
+};
+
+/*
+ * Constant precomputed values of Pi(i) for chi-square 0..5, for m = 9 and
+ * M = 1032.
+ */
+static const double pi[6] = {
+	0.364091,	/* Pi#0 */
+	0.185659,	/* Pi#1 */
+	0.139381,	/* Pi#2 */
+	0.100571,	/* Pi#3 */
+	0.070432,	/* Pi#4 */
+	0.139865,	/* Pi#5 */
 };
 
-#define	__DECONST(type, var)	((type)(uintptr_t)(const void *)(var))
+/*
+ * Probability of u matches in a block, the NIST approximation.
+ */
+static double
+otmatch_pr(unsigned int u, double eta)
+{
+	double sum;
+	unsigned int l;
+
+	if (u == 0)
+		return (exp(-eta));
+
+	for (l = 1, sum = 0.0; l <= u; l++)
+		sum += exp(-eta - u * log(2.0) + l * log(eta) - lgamma(l + 1) +
+		    lgamma(u) - lgamma(l) - lgamma(u - l + 1));
+
+	return (sum);
+}
+
+/*
+ * Probabilities of 0..K-1 and K or more matches of B in a block of M bits,
+ * by a walk of the matching automaton of B over the bits of the block. The
+ * NIST values only hold for the template of all ones, the walk takes the
+ * overlaps of any other template into account.
+ */
+static void
+otmatch_pi(const uint8_t *B, unsigned int m, unsigned int K, unsigned int M,
+    double *pi)
+{
+	double P[2][OTMATCH_MAX_TMPL_M + 1][OTMATCH_MAX_K + 1];
+	unsigned int next[OTMATCH_MAX_TMPL_M + 1][2];
+	unsigned int fail[OTMATCH_MAX_TMPL_M];
+	unsigned int b, i, j, k, s, t, u;
+
+#define	OTMATCH_B(i)	((B[(i) >> 3] >> (7 - ((i) & 0x07))) & 0x01)
+
+	/* The longest proper prefix of B which is a suffix of B[0..i] */
+	fail[0] = 0;
+	for (i = 1, k = 0; i < m; i++) {
+		while (k > 0 && OTMATCH_B(i) != OTMATCH_B(k))
+			k = fail[k - 1];
+		if (OTMATCH_B(i) == OTMATCH_B(k))
+			k++;
+		fail[i] = k;
+	}
+	/* The state is the number of bits of B matched so far */
+	for (s = 0; s <= m; s++) {
+		for (b = 0; b < 2; b++) {
+			if (s < m && OTMATCH_B(s) == b)
+				next[s][b] = s + 1;
+			else
+				next[s][b] = (s == 0) ? 0 : next[fail[s - 1]][b];
+		}
+	}
+
+#undef	OTMATCH_B
+
+	memset(P[0], 0, sizeof(P[0]));
+	P[0][0][0] = 1.0;
+	for (i = 0, j = 0; i < M; i++, j ^= 1) {
+		memset(P[j ^ 1], 0, sizeof(P[0]));
+		for (s = 0; s <= m; s++) {
+			for (u = 0; u <= K; u++) {
+				if (P[j][s][u] == 0.0)
+					continue;
+				for (b = 0; b < 2; b++) {
+					t = next[s][b];
+					k = min(u + (t == m), K);
+					P[j ^ 1][t][k] += P[j][s][u] / 2.0;
+				}
+			}
+		}
+	}
+	for (u = 0; u <= K; u++)
+		for (s = 0, pi[u] = 0.0; s <= m; s++)
+			pi[u] += P[j][s][u];
+}
 
 int
 otmatch_init(struct tras_ctx *ctx, void *params)
 {
 	struct otmatch_params *p = params;
 	struct otmatch_ctx *c;
-	size_t size;
+	double eta, sum;
+	unsigned int d, i;
+	int error, ones;
 
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	/*
-	 * TODO: verify multiple parameters.
-	 */
+	if (p->B == NULL)
+		return (EINVAL);
+	if (p->m < OTMATCH_MIN_TMPL_M || p->m > OTMATCH_MAX_TMPL_M)
+		return (EINVAL);
+	if (p->K < OTMATCH_MIN_K || p->K > OTMATCH_MAX_K)
+		return (EINVAL);
+	if (p->M < OTMATCH_MIN_SUBS_M || p->M < p->m)
+		return (EINVAL);
+	if (p->N < OTMATCH_MIN_N)
+		return (EINVAL);
 
-	c = malloc(sizeof(struct otmatch_ctx) + (p->m + 7) / 8);
-	if (c == NULL)
-		return (ENOMEM);
+	error = tras_init_context(ctx, &otmatch_algo,
+	    sizeof(struct otmatch_ctx), TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
 
-	c->B = __DECONST(uint8_t *, (c + 1));
-	memcpy(c->B, p->B, (p->m + 7) / 8);
+	/* The bit d positions back is compared with the bit m-1-d of B */
+	for (d = 0, ones = 1; d < p->m; d++) {
+		i = p->m - 1 - d;
+		if ((p->B[i >> 3] & (0x80 >> (i & 0x07))) == 0) {
+			c->f[d] = ~0ULL;
+			ones = 0;
+		}
+	}
+
+	if (!ones) {
+		otmatch_pi(p->B, p->m, p->K, p->M, c->pi);
+	} else if (p->m == 9 && p->M == 1032) {
+		memcpy(c->pi, pi, sizeof(pi));
+	} else {
+		eta = (double)(p->M - p->m + 1) / ldexp(1.0, p->m) / 2.0;
+		for (i = 0, sum = 0.0; i < p->K; i++) {
+			c->pi[i] = otmatch_pr(i, eta);
+			sum += c->pi[i];
+		}
+		c->pi[p->K] = 1.0 - sum;
+	}
 
-	memset(c->v, 0, sizeof(c->v));
 	c->m = p->m;
 	c->K = p->K;
 	c->M = p->M;
 	c->N = p->N;
-	c->nbits = 0;
+	c->nbmax = p->N * p->M;
+	c->bend = p->M;
 	c->alpha = p->alpha;
 
-	ctx->context = c;
-	ctx->algo = &otmatch_algo;
-	ctx->state = TRAS_STATE_INIT;
-
 	return (0);
 }
 
+/*
+ * Get k bits from the bit offset i of p, aligned to msb.
+ */
+static inline uint64_t
+otmatch_bits(const uint8_t *p, unsigned int i, unsigned int k)
+{
+	unsigned int o, n, j;
+	uint64_t x;
+
+	p += i >> 3;
+	o = i & 0x07;
+	n = (o + k + 7) >> 3;
+
+	if (n >= 8) {
+		memcpy(&x, p, sizeof(x));
+		x = be64toh(x);
+	} else {
+		for (j = 0, x = 0; j < 8; j++)
+			x = (x << 8) | ((j < n) ? p[j] : 0);
+	}
+	x <<= o;
+	if (n > 8)
+		x |= p[8] >> (8 - o);
+
+	return ((k < 64) ? x & ~(~0ULL >> k) : x);
+}
+
+/*
+ * Mask of bits lo..hi-1 of a word, from msb.
+ */
+static inline uint64_t
+otmatch_range(unsigned int lo, unsigned int hi)
+{
+
+	if (lo >= hi)
+		return (0);
+
+	return ((~0ULL >> lo) & ((hi < 64) ? ~(~0ULL >> hi) : ~0ULL));
+}
+
+/*
+ * Match k bits of the word x. A bit of the shift-and mask is set where an
+ * occurrence of B ends, the bits before x are taken from the last word.
+ * Only the occurrences which start and end in one block are counted.
+ */
+static inline void
+otmatch_word(struct otmatch_ctx *c, uint64_t x, unsigned int k)
+{
+	unsigned int d, j, lo, hi, first;
+	uint64_t e, y, prev;
+
+	/* y is x moved one bit at a time into the following positions */
+	prev = c->prev;
+	e = x ^ c->f[0];
+	for (d = 1, y = x; d < c->m; d++) {
+		y = (y >> 1) | (prev << 63);
+		prev >>= 1;
+		e &= y ^ c->f[d];
+	}
+
+	/* The word is inside the counted part of the block */
+	first = c->bend - c->M + c->m - 1;
+	if (k == 64 && c->pos >= first && c->pos + k < c->bend) {
+		c->cnt += bitcount_64(e);
+		c->prev = x;
+		c->pos += k;
+		return;
+	}
+
+	for (j = 0; j < k; j = hi) {
+		hi = min(k, c->bend - c->pos);
+		first = c->bend - c->M + c->m - 1;
+		lo = (first > c->pos + j) ? min(first - c->pos, hi) : j;
+		c->cnt += bitcount_64(e & otmatch_range(lo, hi));
+		if (c->pos + hi == c->bend) {
+			c->v[min(c->cnt, c->K)]++;
+			c->cnt = 0;
+			c->bend += c->M;
+		}
+	}
+	c->prev = x;
+	c->pos += k;
+}
+
 int
 otmatch_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct otmatch_ctx *c;
+	const uint8_t *p;
+	unsigned int i, k, n;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	/*
-	 * TODO: implementation.
-	 */
+	c = ctx->context;
+	p = (const uint8_t *)data;
+
+	n = min(nbits, c->nbmax - c->pos - c->nacc);
+	c->nbits += nbits;
+
+	/* Complete the word left from the previous update */
+	i = 0;
+	if (c->nacc > 0 && n > 0) {
+		k = min(64 - c->nacc, n);
+		c->acc |= otmatch_bits(p, 0, k) >> c->nacc;
+		c->nacc += k;
+		i = k;
+		if (c->nacc == 64) {
+			otmatch_word(c, c->acc, 64);
+			c->acc = 0;
+			c->nacc = 0;
+		}
+	}
+	for (; i + 64 <= n; i += 64)
+		otmatch_word(c, otmatch_bits(p, i, 64), 64);
+	if (i < n) {
+		c->acc = otmatch_bits(p, i, n - i);
+		c->nacc = n - i;
+	}
 
-	return (ENOSYS);
+	return (0);
 }
 
-/*
- * Constant precomputed values of Pi(i) for chi-square 0..5.
- */
-static const double pi[6] = {
-	0.364091,	/* Pi#0 */
-	0.185659,	/* Pi#1 */
-	0.139381,	/* Pi#2 */
-	0.100571,	/* Pi#3 */
-	0.070432,	/* Pi#4 */
-	0.139865,	/* Pi#4 */
-};
-
 int
 otmatch_final(struct tras_ctx *ctx)
 {
 	struct otmatch_ctx *c;
-	double lambda, ni;
-	double pvalue;
+	double chi2, e, pvalue;
+	unsigned int i;
 
 	TRAS_CHECK_FINAL(ctx);
 
-	if (ctx == NULL)
-		return (EINVAL);
-	if (ctx->state != TRAS_STATE_INIT)
-		return (ENXIO);
-
 	c = ctx->context;
 
-	lambda = ((double)(c->M - c->m + 1)) / pow(2.0, (double)c->m);
-	ni = lambda / 2.0;
+	if (c->pos + c->nacc < c->nbmax)
+		return (EALREADY);
+	if (c->nacc > 0)
+		otmatch_word(c, c->acc, c->nacc);
 
-	/* todo: implementation */
-	pvalue = 0.0;
+	for (i = 0, chi2 = 0.0; i <= c->K; i++) {
+		e = (double)c->N * c->pi[i];
+		chi2 += ((double)c->v[i] - e) * ((double)c->v[i] - e) / e;
+	}
+	pvalue = igamc((double)c->K / 2.0, chi2 / 2.0);
 
 	if (pvalue < c->alpha)
 		ctx->result.status = TRAS_TEST_FAILED;
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
 
-	ctx->result.discard = c->nbits % c->N;
+	ctx->result.discard = c->nbits - c->nbmax;
+	ctx->result.stats1 = chi2;
 	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0.0;
 
-	ctx->state = TRAS_STATE_FINAL;
+	tras_fini_context(ctx, 0);
 
 	return (0);
 }
@@ -37,29 +37,26 @@
  * Overlapping Template Matching Test definitions params.
  */
 struct otmatch_params {
-	unsigned int	m;
-	const uint8_t *	B;
-	unsigned int	K;
-	unsigned int	M;
-	unsigned int	N;
-	double		alpha;
+	unsigned int	m;	/* length in bits of the template */
+	const uint8_t *	B;	/* the m-bits template, from msb */
+	unsigned int	K;	/* number of degrees of freedom */
+	unsigned int	M;	/* length in bits of each block */
+	unsigned int	N;	/* number of blocks */
+	double		alpha;	/* the significance level for H0 */
 };
 
-#define	OTMATCH_MIN_TMPL_M	0
-#define	OTMATCH_MAX_TMPL_M	0
+#define	OTMATCH_MIN_TMPL_M	2
+#define	OTMATCH_MAX_TMPL_M	32
 
 #define	OTMATCH_MIN_K		5
 #define	OTMATCH_MAX_K		5
 
-#define	OTMATCH_MIN_SUBS_M	0
+#define	OTMATCH_MIN_SUBS_M	64
 #define	OTMATCH_MAX_SUBS_M	0
 
 #define	OTMATCH_MIN_N		100
 #define	OTMATCH_MAX_N		0
 
-#define	OTMATCH_MIN_NBITS	1000000
-#define	OTMATCH_MAX_NBITS	0
-
 TRAS_DECLARE_ALGO(otmatch);
 
 #endif
@@ -0,0 +1,363 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *
+ * The Overlapping Sums Test.
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <endian.h>
+#include <limits.h>
+#include <math.h>
+
+#include <tras.h>
+#include <cdefs.h>
+#include <uniform.h>
+#include <kstest.h>
+#include <ovlpsum.h>
+#include <ovlpsum_ks.h>
+
+/*
+ * The samples are taken OVLPSUM_LANES at a time with their uniforms
+ * interleaved, so the sliding sums of all of them advance together.
+ */
+#define	OVLPSUM_LANES		8
+#define	OVLPSUM_GROUP		(OVLPSUM_LANES * OVLPSUM_WORDS)
+
+/*
+ * The overlapping sums test context.
+ */
+struct ovlpsum_ctx {
+	uint64_t	nbits;	/* number of bits processed */
+	uint64_t	nword;	/* number of words used */
+	unsigned int	nsample;/* number of samples tested */
+	unsigned int	N;	/* number of samples to test */
+	double		alpha;	/* significance level for H0 */
+	double *	pvalue;	/* KS p-values of the samples */
+	double		u[OVLPSUM_GROUP];	/* uniforms by word and lane */
+	double		v[OVLPSUM_M * OVLPSUM_LANES];	/* transformed */
+};
+
+int
+ovlpsum_init(struct tras_ctx *ctx, void *params)
+{
+	struct ovlpsum_ctx *c;
+	struct ovlpsum_params *p = params;
+	size_t size;
+	int error;
+
+	TRAS_CHECK_INIT(ctx);
+	TRAS_CHECK_PARA(p, p->alpha);
+
+	if (p->N < OVLPSUM_MIN_SAMPLES || p->N > OVLPSUM_MAX_SAMPLES)
+		return (EINVAL);
+
+	size = sizeof(struct ovlpsum_ctx) + p->N * sizeof(double);
+
+	error = tras_init_context(ctx, &ovlpsum_algo, size, TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+
+	c = ctx->context;
+	c->pvalue = (double *)(c + 1);
+	c->N = p->N;
+	c->alpha = p->alpha;
+
+	return (0);
+}
+
+/*
+ * Convert n words to the uniforms of one lane.
+ */
+static inline void
+ovlpsum_load(double *u, const uint32_t *p, unsigned int n)
+{
+	uint32_t w;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		memcpy(&w, p + i, sizeof(w));
+		u[i * OVLPSUM_LANES] = uniform_u32_to_double(be32toh(w));
+	}
+}
+
+/*
+ * The sums S_j of OVLPSUM_M uniforms from U_j on overlap in all but one,
+ * they are made independent by a linear transform. The first and the last
+ * give the normal ((S_0 + S_{M-1}) / 2 - M / 2) / sqrt((M + 1) / 24), the
+ * steps of the window S_j - S_{j-1} = U_{j+M-1} - U_{j-1} are independent
+ * of each other and uncorrelated with it. A step is the difference of two
+ * uniforms, triangular and not normal as Diehard takes it, so each one is
+ * turned into a uniform with its own distribution function.
+ */
+static void
+ovlpsum_transform(struct ovlpsum_ctx *c)
+{
+	double s[OVLPSUM_LANES], s0[OVLPSUM_LANES], t, a, z;
+	const double *u, *b;
+	double *v;
+	unsigned int j, l;
+
+	u = c->u;
+	v = c->v;
+	for (l = 0; l < OVLPSUM_LANES; l++)
+		s[l] = 0.0;
+	for (j = 0; j < OVLPSUM_M; j++, u += OVLPSUM_LANES)
+		for (l = 0; l < OVLPSUM_LANES; l++)
+			s[l] += u[l];
+	for (l = 0; l < OVLPSUM_LANES; l++)
+		s0[l] = s[l];
+
+	/* Slide the window, adding the word at u and removing the one at b */
+	for (j = 1, b = c->u; j < OVLPSUM_M; j++, u += OVLPSUM_LANES,
+	    b += OVLPSUM_LANES) {
+		v += OVLPSUM_LANES;
+		for (l = 0; l < OVLPSUM_LANES; l++) {
+			t = u[l] - b[l];
+			s[l] += t;
+			a = 1.0 - fabs(t);
+			a = 0.5 * a * a;
+			v[l] = t < 0.0 ? a : 1.0 - a;
+		}
+	}
+
+	for (l = 0; l < OVLPSUM_LANES; l++) {
+		z = (0.5 * (s0[l] + s[l]) - 0.5 * OVLPSUM_M) /
+		    sqrt((OVLPSUM_M + 1) / 24.0);
+		c->v[l] = 0.5 * erfc(-z * M_SQRT1_2);
+	}
+}
+
+/*
+ * The Kolmogorov-Smirnov statistic of n uniforms sorted ascending.
+ */
+static double
+ovlpsum_ks_stat(const double *x, unsigned int n)
+{
+	double d;
+	unsigned int i;
+
+	for (i = 0, d = 0.0; i < n; i++) {
+		d = max(d, (i + 1.0) / n - x[i]);
+		d = max(d, x[i] - (double)i / n);
+	}
+	return (d);
+}
+
+/*
+ * Sort the transformed uniforms of one lane, with a counting sort on
+ * the leading digit and an insertion pass for the few left out of order.
+ */
+static void
+ovlpsum_sort(double *x, const double *v)
+{
+	unsigned int cnt[OVLPSUM_M + 1], i, j, b;
+	double y;
+
+	memset(cnt, 0, sizeof(cnt));
+	for (i = 0; i < OVLPSUM_M; i++) {
+		b = (unsigned int)(v[i * OVLPSUM_LANES] * OVLPSUM_M);
+		cnt[min(b, OVLPSUM_M - 1) + 1]++;
+	}
+	for (b = 1; b < OVLPSUM_M; b++)
+		cnt[b] += cnt[b - 1];
+	for (i = 0; i < OVLPSUM_M; i++) {
+		b = (unsigned int)(v[i * OVLPSUM_LANES] * OVLPSUM_M);
+		x[cnt[min(b, OVLPSUM_M - 1)]++] = v[i * OVLPSUM_LANES];
+	}
+
+	for (i = 1; i < OVLPSUM_M; i++) {
+		y = x[i];
+		for (j = i; j > 0 && x[j - 1] > y; j--)
+			x[j] = x[j - 1];
+		x[j] = y;
+	}
+}
+
+/*
+ * P(D >= d) for the KS statistic of OVLPSUM_M uniforms, a cubic through
+ * four points of the exact table on the same polynomial piece. Past the
+ * table the tail of Marsaglia, Tsang and Wang is within 2e-7.
+ */
+static double
+ovlpsum_ks_pvalue(double d)
+{
+	const double *a;
+	unsigned int i, k;
+	double x, t;
+
+	x = d * OVLPSUM_M;
+	if (x <= 0.5)
+		return (1.0);
+	if (x >= OVLPSUM_KS_TAIL)
+		return (2.0 * exp(-(2.000071 + 0.331 / sqrt(OVLPSUM_M) +
+		    1.409 / OVLPSUM_M) * x * d));
+
+	t = (2.0 * x - 1.0) * OVLPSUM_KS_STEPS;
+	k = (unsigned int)(2.0 * x - 1.0) * OVLPSUM_KS_STEPS;
+	i = (unsigned int)t;
+	i = i > k ? i - 1 : k;
+	i = min(i, k + OVLPSUM_KS_STEPS - 3);
+	t -= i;
+	a = ovlpsum_ks + i;
+
+	return ((a[3] * t * (t - 1.0) * (t - 2.0) -
+	    a[0] * (t - 1.0) * (t - 2.0) * (t - 3.0)) / 6.0 +
+	    (a[1] * t * (t - 2.0) * (t - 3.0) -
+	    a[2] * t * (t - 1.0) * (t - 3.0)) / 2.0);
+}
+
+/*
+ * Test the nl samples of the group with the KS test.
+ */
+static void
+ovlpsum_group(struct ovlpsum_ctx *c, unsigned int nl)
+{
+	double x[OVLPSUM_M];
+	unsigned int l;
+
+	ovlpsum_transform(c);
+	for (l = 0; l < nl; l++) {
+		ovlpsum_sort(x, c->v + l);
+		c->pvalue[c->nsample++] =
+		    ovlpsum_ks_pvalue(ovlpsum_ks_stat(x, OVLPSUM_M));
+	}
+}
+
+int
+ovlpsum_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+	struct ovlpsum_ctx *c;
+	const uint32_t *p;
+	unsigned int i, n, o, r, nl;
+
+	TRAS_CHECK_UPDATE(ctx, data, nbits);
+
+	if (nbits & 0x1f)
+		return (EINVAL);
+
+	c = ctx->context;
+	p = (const uint32_t *)data;
+
+	c->nbits += nbits;
+	n = min(nbits >> 5, (uint64_t)c->N * OVLPSUM_WORDS - c->nword);
+
+	for (i = 0; i < n; i += r) {
+		/* The offset in the group of samples in progress */
+		o = c->nword - (uint64_t)c->nsample * OVLPSUM_WORDS;
+		r = min(n - i, OVLPSUM_WORDS - o % OVLPSUM_WORDS);
+		ovlpsum_load(c->u + (o % OVLPSUM_WORDS) * OVLPSUM_LANES +
+		    o / OVLPSUM_WORDS, p + i, r);
+		c->nword += r;
+
+		nl = min(c->N - c->nsample, OVLPSUM_LANES);
+		if (o + r == nl * OVLPSUM_WORDS)
+			ovlpsum_group(c, nl);
+	}
+
+	return (0);
+}
+
+static int
+ovlpsum_cmp(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return ((x > y) - (x < y));
+}
+
+int
+ovlpsum_final(struct tras_ctx *ctx)
+{
+	struct ovlpsum_ctx *c;
+	double d, pvalue;
+
+	TRAS_CHECK_FINAL(ctx);
+
+	c = ctx->context;
+	if (c->nsample < c->N)
+		return (EALREADY);
+
+	/* The KS test of the p-values of the samples */
+	qsort(c->pvalue, c->N, sizeof(double), ovlpsum_cmp);
+	d = ovlpsum_ks_stat(c->pvalue, c->N);
+	pvalue = kstest_pvalue(d, c->N);
+
+	if (pvalue < c->alpha)
+		ctx->result.status = TRAS_TEST_FAILED;
+	else
+		ctx->result.status = TRAS_TEST_PASSED;
+
+	ctx->result.discard = min(c->nbits - 32 * c->nword, UINT_MAX);
+	ctx->result.stats1 = d;
+	ctx->result.pvalue1 = pvalue;
+
+	tras_fini_context(ctx, 0);
+
+	return (0);
+}
+
+int
+ovlpsum_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
+{
+
+	return (tras_do_test(ctx, data, nbits));
+}
+
+int
+ovlpsum_restart(struct tras_ctx *ctx, void *params)
+{
+
+	return (tras_do_restart(ctx, params));
+}
+
+int
+ovlpsum_free(struct tras_ctx *ctx)
+{
+
+	return (tras_do_free(ctx));
+}
+
+const struct tras_algo ovlpsum_algo = {
+	.name =		"ovlpsum",
+	.desc =		"The Overlapping Sums Test",
+	.id =		0,
+	.version =	{ 0, 1, 1 },
+	.init =		ovlpsum_init,
+	.update =	ovlpsum_update,
+	.test =		ovlpsum_test,
+	.final =	ovlpsum_final,
+	.restart =	ovlpsum_restart,
+	.free =		ovlpsum_free,
+};
@@ -0,0 +1,152 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#ifndef __OVLPSUM_KS_H__
+#define	__OVLPSUM_KS_H__
+
+/*
+ * The exact distribution of the Kolmogorov-Smirnov statistic D for a sample
+ * of OVLPSUM_M uniforms, computed with the method of Marsaglia, Tsang and
+ * Wang. P(D >= d) is a polynomial in nd between multiples of 1/2, the table
+ * keeps it at OVLPSUM_KS_STEPS steps in each of them for nd from 1/2 to
+ * OVLPSUM_KS_TAIL, rounded to 13 digits. D is never below 1/2n.
+ */
+#define	OVLPSUM_KS_STEPS	8
+#define	OVLPSUM_KS_TAIL		19.5
+#define	OVLPSUM_KS_SIZE		(38 * OVLPSUM_KS_STEPS + 1)
+
+static const double ovlpsum_ks[OVLPSUM_KS_SIZE] = {
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	1.000000000000e+00, 1.000000000000e+00, 1.000000000000e+00,
+	9.999999999999e-01, 9.999999999993e-01, 9.999999999958e-01,
+	9.999999999783e-01, 9.999999999025e-01, 9.999999996147e-01,
+	9.999999986383e-01, 9.999999956470e-01, 9.999999872840e-01,
+	9.999999657528e-01, 9.999999142903e-01, 9.999997992781e-01,
+	9.999995574054e-01, 9.999990760702e-01, 9.999981651570e-01,
+	9.999965185082e-01, 9.999936638510e-01, 9.999889005835e-01,
+	9.999812255799e-01, 9.999692479033e-01, 9.999510949686e-01,
+	9.999243182601e-01, 9.998857978057e-01, 9.998316512663e-01,
+	9.997571535282e-01, 9.996566709512e-01, 9.995236142152e-01,
+	9.993504127721e-01, 9.991285127567e-01, 9.988483990701e-01,
+	9.984996414269e-01, 9.980709633961e-01, 9.975503328951e-01,
+	9.969250723746e-01, 9.961819871172e-01, 9.953075107174e-01,
+	9.942878663784e-01, 9.931092250818e-01, 9.917578530052e-01,
+	9.902202619368e-01, 9.884833543698e-01, 9.865345597403e-01,
+	9.843619597994e-01, 9.819544016739e-01, 9.793015976893e-01,
+	9.763942114595e-01, 9.732239300677e-01, 9.697835223656e-01,
+	9.660668834827e-01, 9.620690655471e-01, 9.577862943325e-01,
+	9.532159710636e-01, 9.483566580365e-01, 9.432080498701e-01,
+	9.377709387661e-01, 9.320471743350e-01, 9.260396170726e-01,
+	9.197520865475e-01, 9.131893053672e-01, 9.063568398670e-01,
+	8.992610383496e-01, 8.919089675794e-01, 8.843083481409e-01,
+	8.764674891884e-01, 8.683952230754e-01, 8.601008403579e-01,
+	8.515940257342e-01, 8.428847956274e-01, 8.339834383468e-01,
+	8.249004578635e-01, 8.156465213085e-01, 8.062324096278e-01,
+	7.966689712749e-01, 7.869670789433e-01, 7.771375893120e-01,
+	7.671913057664e-01, 7.571389440414e-01, 7.469911007354e-01,
+	7.367582246436e-01, 7.264505908648e-01, 7.160782776396e-01,
+	7.056511458753e-01, 6.951788213004e-01, 6.846706791646e-01,
+	6.741358313459e-01, 6.635831156511e-01, 6.530210870545e-01,
+	6.424580106858e-01, 6.319018564302e-01, 6.213602950185e-01,
+	6.108406954947e-01, 6.003501239528e-01, 5.898953434440e-01,
+	5.794828149594e-01, 5.691186993950e-01, 5.588088604110e-01,
+	5.485588680936e-01, 5.383740033309e-01, 5.282592628102e-01,
+	5.182193645481e-01, 5.082587538636e-01, 4.983816097183e-01,
+	4.885918513561e-01, 4.788931451908e-01, 4.692889118950e-01,
+	4.597823336478e-01, 4.503763615021e-01, 4.410737228348e-01,
+	4.318769288474e-01, 4.227882820843e-01, 4.138098839389e-01,
+	4.049436421227e-01, 3.961912780692e-01, 3.875543342527e-01,
+	3.790341814012e-01, 3.706320255863e-01, 3.623489151785e-01,
+	3.541857476545e-01, 3.461432762517e-01, 3.382221164605e-01,
+	3.304227523509e-01, 3.227455427283e-01, 3.151907271149e-01,
+	3.077584315549e-01, 3.004486742408e-01, 2.932613709600e-01,
+	2.861963403628e-01, 2.792533090496e-01, 2.724319164821e-01,
+	2.657317197177e-01, 2.591521979711e-01, 2.526927570064e-01,
+	2.463527333624e-01, 2.401313984157e-01, 2.340279622860e-01,
+	2.280415775861e-01, 2.221713430235e-01, 2.164163068549e-01,
+	2.107754702006e-01, 2.052477902219e-01, 1.998321831654e-01,
+	1.945275272807e-01, 1.893326656134e-01, 1.842464086801e-01,
+	1.792675370278e-01, 1.743948036841e-01, 1.696269365003e-01,
+	1.649626403932e-01, 1.604005994887e-01, 1.559394791712e-01,
+	1.515779280432e-01, 1.473145797975e-01, 1.431480550064e-01,
+	1.390769628313e-01, 1.350999026552e-01, 1.312154656417e-01,
+	1.274222362236e-01, 1.237187935238e-01, 1.201037127104e-01,
+	1.165755662905e-01, 1.131329253432e-01, 1.097743606958e-01,
+	1.064984440438e-01, 1.033037490182e-01, 1.001888522024e-01,
+	9.715233409867e-02, 9.419278004822e-02, 9.130878110551e-02,
+	8.849893486874e-02, 8.576184626809e-02, 8.309612831332e-02,
+	8.050040280211e-02, 7.797330099055e-02, 7.551346422716e-02,
+	7.311954455164e-02, 7.079020525960e-02, 6.852412143440e-02,
+	6.631998044732e-02, 6.417648242690e-02, 6.209234069877e-02,
+	6.006628219668e-02, 5.809704784587e-02, 5.618339291955e-02,
+	5.432408736952e-02, 5.251791613163e-02, 5.076367940699e-02,
+	4.906019291977e-02, 4.740628815219e-02, 4.580081255767e-02,
+	4.424262975276e-02, 4.273061968845e-02, 4.126367880186e-02,
+	3.984072014862e-02, 3.846067351688e-02, 3.712248552344e-02,
+	3.582511969274e-02, 3.456755651917e-02, 3.334879351349e-02,
+	3.216784523379e-02, 3.102374330169e-02, 2.991553640426e-02,
+	2.884229028228e-02, 2.780308770531e-02, 2.679702843420e-02,
+	2.582322917150e-02, 2.488082350025e-02, 2.396896181182e-02,
+	2.308681122303e-02, 2.223355548331e-02, 2.140839487219e-02,
+	2.061054608762e-02, 1.983924212565e-02, 1.909373215186e-02,
+	1.837328136497e-02, 1.767717085304e-02, 1.700469744279e-02,
+	1.635517354229e-02, 1.572792697757e-02, 1.512230082338e-02,
+	1.453765322869e-02, 1.397335723705e-02, 1.342880060241e-02,
+	1.290338560057e-02, 1.239652883677e-02, 1.190766104952e-02,
+	1.143622691127e-02, 1.098168482607e-02, 1.054350672446e-02,
+	1.012117785613e-02, 9.714196580374e-03, 9.322074154791e-03,
+	8.944334522402e-03, 8.580514097513e-03, 8.230161550510e-03,
+	7.892837591892e-03, 7.568114755701e-03, 7.255577182647e-03,
+	6.954820403084e-03, 6.665451120071e-03, 6.387086992720e-03,
+	6.119356419992e-03, 5.861898325158e-03, 5.614361941063e-03,
+	5.376406596381e-03, 5.147701503018e-03, 4.927925544788e-03,
+	4.716767067530e-03, 4.513923670784e-03, 4.319102001159e-03,
+	4.132017547513e-03, 3.952394438055e-03, 3.779965239458e-03,
+	3.614470758128e-03, 3.455659843662e-03, 3.303289194631e-03,
+	3.157123166729e-03, 3.016933583397e-03, 2.882499548956e-03,
+	2.753607264341e-03, 2.630049845464e-03, 2.511627144295e-03,
+	2.398145572654e-03, 2.289417928810e-03, 2.185263226898e-03,
+	2.085506529163e-03, 1.989978781116e-03, 1.898516649562e-03,
+	1.810962363566e-03, 1.727163558343e-03, 1.646973122103e-03,
+	1.570249045834e-03, 1.496854276061e-03, 1.426656570550e-03,
+	1.359528356958e-03, 1.295346594459e-03, 1.233992638277e-03,
+	1.175352107170e-03, 1.119314753822e-03, 1.065774338127e-03,
+	1.014628503362e-03, 9.657786552064e-04, 9.191298436012e-04,
+	8.745906474280e-04, 8.320730619448e-04,
+};
+
+#endif
@@ -36,11 +36,11 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
-#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
+#include <uniform.h>
 #include <plot.h>
 
 /*
@@ -51,21 +51,39 @@ struct point {
 	double	y;
 };
 
+typedef double plot_distance_t(struct point *, struct point *);
+
+/*
+ * The parking lot is divided into PLOT_GRID x PLOT_GRID cells of side 1,
+ * the crash distance. Cars are linked in lists of the cells they park in,
+ * list entries are car indexes plus one, zero ends a list.
+ */
+#define	PLOT_SIDE		100.0
+#define	PLOT_GRID		100
+
 /*
  * The context structure for the parking lot test.
  */
 struct plot_ctx {
 	unsigned int	nbits;	/* number of bits processed */
 	struct point *	cars;	/* list of cars parked */
+	uint16_t *	head;	/* first car of each cell list */
+	uint16_t *	next;	/* next car of cell, row and column lists */
+	plot_distance_t *dist;	/* distance function */
 	unsigned int	ncars;	/* number of cars parked */
 	unsigned int	tries;	/* number of park attempts */
-	unsigned int	nslot;	/* size of table for cars */
 	unsigned int	bumps;	/* number of collisions */
+	unsigned int	nbuf;	/* number of bytes in buf */
 	uint8_t		buf[8];	/* to store incomplete point */
+	uint32_t	tie;	/* low bits of the last point, for the p-value */
 	int		idist;	/* distance function index */
 	double		alpha;	/* significance level ??? */
 };
 
+static plot_distance_t plot_distance_axis_max;
+static plot_distance_t plot_distance_axis_min;
+static plot_distance_t plot_distance_euclidean;
+
 /*
  * Initialize the parking lot test, non-parameters test.
  */
@@ -75,40 +93,42 @@ plot_init(struct tras_ctx *ctx, void *params)
 	struct plot_params *p = params;
 	struct plot_ctx *c;
 	size_t size;
+	int error;
 
 	TRAS_CHECK_INIT(ctx);
 	TRAS_CHECK_PARA(p, p->alpha);
 
-	if (p->idist != PARKING_LOT_IDIST_COORD_MAX)
+	if (p->idist != PARKING_LOT_IDIST_EUCLIDEAN &&
+	    p->idist != PARKING_LOT_IDIST_COORD_MIN &&
+	    p->idist != PARKING_LOT_IDIST_COORD_MAX)
 		return (EINVAL);
 
 	/*
-	 * Notice: only maximum coordinates as distance function.
+	 * No more cars than attempts can park, so the cars list is sized
+	 * for all of them and never reallocated.
 	 */
+	size = sizeof(struct plot_ctx) +
+	    PARKING_LOT_MAX_CARS * sizeof(struct point) +
+	    PLOT_GRID * PLOT_GRID * sizeof(uint16_t) +
+	    2 * PARKING_LOT_MAX_CARS * sizeof(uint16_t);
 
-	/*
-	 * Only 3523 points park successfully in average. Half of slots
-	 * should be enough. If not, the udpate method will resize and
-	 * reallocate the cars positions list.
-	 */
-	c = malloc(sizeof(struct plot_ctx));
-	if (c == NULL)
-		return (ENOMEM);
-	c->cars = malloc(PARKING_LOT_MAX_CARS / 2 * sizeof(struct point));
-	if (c->cars == NULL) {
-		free(c);
-		return (ENOMEM);
-	}
-	c->nbits = 0;
-	c->ncars = 0;
-	c->tries = 0;
-	c->nslot = 100 * PARKING_LOT_MAX_CARS / 2;
+	error = tras_init_context(ctx, &plot_algo, size, TRAS_F_ZERO);
+	if (error != 0)
+		return (error);
+
+	c = ctx->context;
+	c->cars = (struct point *)(c + 1);
+	c->head = (uint16_t *)(c->cars + PARKING_LOT_MAX_CARS);
+	c->next = c->head + PLOT_GRID * PLOT_GRID;
 	c->idist = p->idist;
 	c->alpha = p->alpha;
 
-	ctx->context = c;
-	ctx->algo = &plot_algo;
-	ctx->state = TRAS_STATE_INIT;
+	if (p->idist == PARKING_LOT_IDIST_EUCLIDEAN)
+		c->dist = plot_distance_euclidean;
+	else if (p->idist == PARKING_LOT_IDIST_COORD_MIN)
+		c->dist = plot_distance_axis_min;
+	else
+		c->dist = plot_distance_axis_max;
 
 	return (0);
 }
@@ -160,133 +180,224 @@ plot_distance_euclidean(struct point *p1, struct point *p2)
 	return (sqrt(dx * dx + dy * dy));
 }
 
-static double
-tras_uint_to_floatU01(uint32_t u32)
+/*
+ * Get the car position from 8 bytes, big endian x and y coordinates.
+ */
+inline static void
+plot_point(struct point *car, const uint8_t *d)
 {
 
-	/* XXX: this is wrong function that need to be corrected
-	 * because since u32 is uniformly distributed the
-	 * return value is not.
-	 */
-	return ((double)u32 / pow(2.0, 32));
+	car->x = uniform_u32_to_double(((uint32_t)d[0] << 24) |
+	    ((uint32_t)d[1] << 16) | ((uint32_t)d[2] << 8) | d[3]) * PLOT_SIDE;
+	car->y = uniform_u32_to_double(((uint32_t)d[4] << 24) |
+	    ((uint32_t)d[5] << 16) | ((uint32_t)d[6] << 8) | d[7]) * PLOT_SIDE;
 }
 
-inline static double
-plot_uint_to_component(uint32_t u32)
+inline static unsigned int
+plot_cell(double v)
 {
 
-	return (tras_uint_to_floatU01(u32) * 100.0);
+	return (min((unsigned int)v, PLOT_GRID - 1));
 }
 
+/*
+ * Check if the car crashes into any car parked in the 3 x 3 cells around.
+ * The maximum coordinate and Euclidean distances are not greater than 1
+ * only for cars in these cells.
+ */
 static int
-plot_reallocate(struct plot_ctx *c)
+plot_crash_cells(struct plot_ctx *c, struct point *car)
 {
-	struct point *list;
-	unsigned int nslot;
-
-	nslot = 3 * c->nslot / 2;
-	nslot = min(nslot, PARKING_LOT_MAX_CARS);
-	if (c->nslot >= nslot)
-		return (ENXIO);
-
-	list = malloc(nslot * sizeof(struct point));
-	if (list == NULL)
-		return (ENOMEM);
-	bcopy(c->cars, list, c->ncars * sizeof(struct point));
-	free(c->cars);
-	c->cars = list;
-	c->nslot = nslot;
-	
+	unsigned int cx, cy, x, y, x1, y1;
+	unsigned int i;
+
+	cx = plot_cell(car->x);
+	cy = plot_cell(car->y);
+	x1 = min(cx + 1, PLOT_GRID - 1);
+	y1 = min(cy + 1, PLOT_GRID - 1);
+
+	for (y = cy > 0 ? cy - 1 : 0; y <= y1; y++) {
+		for (x = cx > 0 ? cx - 1 : 0; x <= x1; x++) {
+			for (i = c->head[y * PLOT_GRID + x]; i != 0;
+			    i = c->next[i - 1]) {
+				if (c->dist(&c->cars[i - 1], car) <= 1.0)
+					return (1);
+			}
+		}
+	}
 	return (0);
 }
 
+/*
+ * Check if the car crashes into any car parked in the 3 columns or 3 rows
+ * around. The minimum coordinate distance is not greater than 1 for any
+ * car in the same band of x or y, so columns and rows are linked instead
+ * of cells: heads of columns start at head[0] and heads of rows at
+ * head[PLOT_GRID].
+ */
 static int
-plot_park_attempt(struct plot_ctx *c, struct point *car)
+plot_crash_bands(struct plot_ctx *c, struct point *car)
 {
+	unsigned int cx, cy, x, y, x1, y1;
 	unsigned int i;
-	double d;
-	int error;
-
-	c->tries++;
-
-	for (i = 0; i < c->ncars; i++) {
-		d = plot_distance_axis_max(&c->cars[i], car);
-		if (d <= 1.0) {
-			c->bumps++;
-			return (0);
+	uint16_t *rnext;
+
+	cx = plot_cell(car->x);
+	cy = plot_cell(car->y);
+	x1 = min(cx + 1, PLOT_GRID - 1);
+	y1 = min(cy + 1, PLOT_GRID - 1);
+	rnext = c->next + PARKING_LOT_MAX_CARS;
+
+	for (x = cx > 0 ? cx - 1 : 0; x <= x1; x++) {
+		for (i = c->head[x]; i != 0; i = c->next[i - 1]) {
+			if (fabs(c->cars[i - 1].x - car->x) <= 1.0)
+				return (1);
 		}
 	}
-	if (c->ncars >= c->nslot) {
-		error = plot_reallocate(c);
-		if (error != 0)
-			return (error);
+	for (y = cy > 0 ? cy - 1 : 0; y <= y1; y++) {
+		for (i = c->head[PLOT_GRID + y]; i != 0; i = rnext[i - 1]) {
+			if (fabs(c->cars[i - 1].y - car->y) <= 1.0)
+				return (1);
+		}
 	}
+	return (0);
+}
 
-	c->cars[c->ncars].x = car->x;
-	c->cars[c->ncars].y = car->y;
-	c->ncars++;
+/*
+ * Try to park the car of the 8 bytes at d. The low bytes of the last
+ * coordinates hardly matter to parking, they break the tie of the p-value.
+ */
+static void
+plot_park_attempt(struct plot_ctx *c, const uint8_t *d)
+{
+	struct point car;
+	unsigned int cx, cy, n;
+	int crash;
 
-	return (0);
+	plot_point(&car, d);
+	if (++c->tries == PARKING_LOT_MIN_CARS)
+		c->tie = ((uint32_t)d[2] << 24) | ((uint32_t)d[3] << 16) |
+		    ((uint32_t)d[6] << 8) | d[7];
+
+	if (c->idist == PARKING_LOT_IDIST_COORD_MIN)
+		crash = plot_crash_bands(c, &car);
+	else
+		crash = plot_crash_cells(c, &car);
+	if (crash) {
+		c->bumps++;
+		return;
+	}
+
+	n = c->ncars++;
+	c->cars[n] = car;
+
+	cx = plot_cell(car.x);
+	cy = plot_cell(car.y);
+	if (c->idist == PARKING_LOT_IDIST_COORD_MIN) {
+		c->next[n] = c->head[cx];
+		c->head[cx] = n + 1;
+		c->next[PARKING_LOT_MAX_CARS + n] = c->head[PLOT_GRID + cy];
+		c->head[PLOT_GRID + cy] = n + 1;
+	} else {
+		c->next[n] = c->head[cy * PLOT_GRID + cx];
+		c->head[cy * PLOT_GRID + cx] = n + 1;
+	}
 }
 
 /*
  * Update state of the parking lot test with subsequent binary sequence.
+ * Each car position takes 64 bits; a position split between updates is
+ * kept in the context until completed. Data after the last attempt is
+ * ignored.
  */
 int
 plot_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
-	static int idx;
 	struct plot_ctx *c;
-	uint32_t *p;
-	struct point car;
-	unsigned int r, n, i;
-	int error;
+	const uint8_t *d;
+	unsigned int n, k;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	if (nbits & 0x3f)
+	if (nbits & 0x07)
 		return (EINVAL);
 
 	c = ctx->context;
-	p = (uint32_t *)data;
-
-	r = c->nbits & 0x3f;
-	if (r > 0) {
-return (EINVAL);
-		/* todo: try to complete the car point */
-		n = nbits >> 6;
-		for (i = 0; i < n; i++) {
-			/* todo: get two 32-bit substring as x, y coord */
-			car.x = 0.0;	/* temp */
-			car.y = 0.0;	/* temp */
-			error = plot_park_attempt(c, &car);
-			if (error != 0) {
-				ctx->state = TRAS_STATE_ERROR;
-				return (error);
-			}
-		}
-	} else {
-		n = nbits >> 6;
-		for (i = 0; i < n; i++) {
-			car.x = plot_uint_to_component(be32toh(*p));
-			p++;
-			car.y = plot_uint_to_component(be32toh(*p));
-			p++;
-			error = plot_park_attempt(c, &car);
-			if (error != 0) {
-				ctx->state = TRAS_STATE_ERROR;
-				return (error);
-			}
-		}
+	d = data;
+	n = nbits / 8;
+	c->nbits += nbits;
+
+	if (c->nbuf > 0) {
+		k = min(n, 8 - c->nbuf);
+		memcpy(c->buf + c->nbuf, d, k);
+		c->nbuf += k;
+		d += k;
+		n -= k;
+		if (c->nbuf < 8)
+			return (0);
+		c->nbuf = 0;
+		if (c->tries < PARKING_LOT_MIN_CARS)
+			plot_park_attempt(c, c->buf);
 	}
 
-	c->nbits += nbits;
+	while (n >= 8 && c->tries < PARKING_LOT_MIN_CARS) {
+		plot_park_attempt(c, d);
+		d += 8;
+		n -= 8;
+	}
+
+	if (n > 0 && n < 8 && c->tries < PARKING_LOT_MIN_CARS) {
+		memcpy(c->buf, d, n);
+		c->nbuf = n;
+	}
 
 	return (0);
 }
 
+/*
+ * Mean and standard deviation of the number of cars parked in 12000
+ * attempts for the maximum coordinate and Euclidean distances. The maximum
+ * coordinate values come from Diehard; the others were measured over 10^5
+ * simulated lots.
+ */
 #define	PLOT_12000_MEAN		3523.0
 #define	PLOT_12000_VAR		21.9
+#define	PLOT_12000_MEAN_EUCLIDEAN	4087.6
+#define	PLOT_12000_VAR_EUCLIDEAN	23.9
+
+/*
+ * With the minimum coordinate distance only about 70 cars park, in a few
+ * values too far from normal. Numbers of lots of PLOT_MIN_CARS0 + i cars
+ * parked in 12000 attempts, over PLOT_MIN_LOTS simulated lots.
+ */
+#define	PLOT_MIN_CARS0		61
+#define	PLOT_MIN_LOTS		2400000.0
+
+static const unsigned int plot_min_lots[] = {
+	1,	68,	950,	8508,	46074,	162217,	374566,	571507,
+	583492,	400168,	182995,	56398,	11371,	1538,	142,	5,
+};
+
+/*
+ * The two-sided p-value of n cars parked with the minimum coordinate
+ * distance. The tie of the lots of n cars is broken by u in [0, 1), so
+ * that the p-value is uniform under H0.
+ */
+static double
+plot_min_pvalue(unsigned int n, double u)
+{
+	double t;
+	unsigned int i, k;
+
+	k = sizeof(plot_min_lots) / sizeof(plot_min_lots[0]);
+	for (i = 0, t = 0.0; i < k && PLOT_MIN_CARS0 + i < n; i++)
+		t += plot_min_lots[i];
+	if (i < k && PLOT_MIN_CARS0 + i == n)
+		t += u * plot_min_lots[i];
+	t /= PLOT_MIN_LOTS;
+
+	return (2.0 * min(t, 1.0 - t));
+}
 
 /*
  * Finalize the parking lot test and determine its result.
@@ -295,7 +406,7 @@ int
 plot_final(struct tras_ctx *ctx)
 {
 	struct plot_ctx *c;
-	double s, pvalue;
+	double s, pvalue, mean, var;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -304,9 +415,21 @@ plot_final(struct tras_ctx *ctx)
 	if (c->tries < PARKING_LOT_MIN_CARS)
 		return (EALREADY);
 
-	s = ((double)c->ncars - PLOT_12000_MEAN) / PLOT_12000_VAR;
-	s = s / sqrt((double)2.0);
-	pvalue =  erfc(fabs(s));
+	if (c->idist == PARKING_LOT_IDIST_COORD_MIN) {
+		pvalue = plot_min_pvalue(c->ncars,
+		    uniform_u32_to_double(c->tie));
+	} else {
+		if (c->idist == PARKING_LOT_IDIST_EUCLIDEAN) {
+			mean = PLOT_12000_MEAN_EUCLIDEAN;
+			var = PLOT_12000_VAR_EUCLIDEAN;
+		} else {
+			mean = PLOT_12000_MEAN;
+			var = PLOT_12000_VAR;
+		}
+		s = ((double)c->ncars - mean) / var;
+		s = s / sqrt((double)2.0);
+		pvalue =  erfc(fabs(s));
+	}
 
 	/* Determine and store results */
 	if (pvalue < c->alpha)
@@ -315,10 +438,11 @@ plot_final(struct tras_ctx *ctx)
 		ctx->result.status = TRAS_TEST_PASSED;
 
 	ctx->result.discard = c->nbits - PARKING_LOT_MIN_NBITS;
+	ctx->result.stats1 = c->ncars;
 	ctx->result.pvalue1 = pvalue;
 	ctx->result.pvalue2 = 0.0;
 
-	ctx->state = TRAS_STATE_FINAL;
+	tras_fini_context(ctx, 0);
 
 	return (0);
 }
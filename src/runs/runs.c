@@ -32,14 +32,18 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <stddef.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
+#include <igamc.h>
 
 #include <hamming8.h>
+#include <bits.h>
 #include <frequency.h>
 #include <runs.h>
 
@@ -50,6 +54,7 @@ struct runs_ctx {
 	unsigned int	runs;		/* statistics ??? */
 	int		flags;		/* flags from parameters */
 	double		alpha;		/* significance level for H0*/
+	double		crit;		/* stats critical value for alpha */
 };
 
 /*
@@ -146,6 +151,7 @@ runs_init(struct tras_ctx *ctx, void *params)
 	c->runs = 1;
 	c->flags = p->flags;
 	c->alpha = p->alpha;
+	c->crit = sqrt(igamci(0.5, p->alpha));
 
 	return (0);
 }
@@ -171,22 +177,45 @@ runs_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 		c->runs++;
 	c->runs += runs_runs_count2(p, nbits);
 
-	n = ((nbits >> 3) + 7) / 8;
-	c->last = *(p + n - 1);
-	n = nbits & 0x07;
-	n = (n != 0) ? n - 1 : 7;
-	c->last = (c->last << n) & 0x80;
+	n = nbits - 1;
+	c->last = (p[n >> 3] << (n & 0x07)) & 0x80;
 
 	c->nbits += nbits;
 
 	return (0);
 }
 
+/*
+ * The result for the ones and runs of nbits, shared by final and batch.
+ */
+static void
+runs_result(struct tras_result *result, unsigned int ones, unsigned int runs,
+    unsigned int nbits, int flags, double crit)
+{
+	double pvalue, stats, pi;
+
+	pi = (double)ones / nbits;
+	pi = pi * (1.0 - pi);
+
+	stats = (double)runs - 2.0 * nbits * pi;
+	stats = abs(stats) / (2.0 * sqrt(2.0 * nbits) * pi);
+
+	pvalue = (flags & TRAS_P_DECIDE) ? NAN : erfc(stats);
+
+	if (stats > crit)
+		result->status = TRAS_TEST_FAILED;
+	else
+		result->status = TRAS_TEST_PASSED;
+
+	result->stats1 = stats;
+	result->pvalue1 = pvalue;
+	result->pvalue2 = 0;
+}
+
 int
 runs_final(struct tras_ctx *ctx)
 {
 	struct runs_ctx *c;
-	double pvalue, stats, pi;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -195,24 +224,74 @@ runs_final(struct tras_ctx *ctx)
 	if (c->nbits < RUNS_MIN_BITS)
 		return (EALREADY);
 
-	pi = (double)c->ones / c->nbits;
-	pi = pi * (1.0 - pi);
+	runs_result(&ctx->result, c->ones, c->runs, c->nbits, c->flags,
+	    c->crit);
 
-	stats = (double)c->runs - 2.0 * c->nbits * pi;
-	stats = abs(stats) / (2.0 * sqrt(2.0 * c->nbits) * pi);
+	tras_fini_context(ctx, 0);
 
-	pvalue = erfc(stats);
+	return (0);
+}
 
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
+/*
+ * Test k sequences of nbits, TRAS_BATCH_LANES at a time word by word. The
+ * runs in a word are the changes of the adjacent bits, x ^ (x >> 1) without
+ * the msb, and one more if it starts other than the last word ended.
+ */
+int
+runs_batch(void *params, const void *data, unsigned int nbits,
+    unsigned int k, struct tras_result *result)
+{
+	struct runs_params *p = params;
+	unsigned int ones[TRAS_BATCH_LANES], runs[TRAS_BATCH_LANES];
+	unsigned int last[TRAS_BATCH_LANES];
+	unsigned int i, l, nl, w, nw, n;
+	const uint8_t *s;
+	uint8_t *t;
+	size_t stride;
+	uint64_t x;
+	double crit;
 
-	ctx->result.stats1 = stats;
-	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0;
+	TRAS_CHECK_PARA(p, p->alpha);
 
-	tras_fini_context(ctx, 0);
+	if (nbits < RUNS_MIN_BITS)
+		return (EALREADY);
+
+	crit = sqrt(igamci(0.5, p->alpha));
+	stride = TRAS_BATCH_STRIDE(nbits);
+	nw = nbits / 64;
+	n = nbits - nw * 64;
+
+	for (i = 0; i < k; i += nl) {
+		nl = min(k - i, TRAS_BATCH_LANES);
+		s = (const uint8_t *)data + i * stride;
+		for (l = 0; l < nl; l++) {
+			ones[l] = 0;
+			runs[l] = 1;
+			last[l] = s[l * stride] >> 7;
+		}
+		for (w = 0; w < nw; w++) {
+			for (l = 0; l < nl; l++) {
+				memcpy(&x, s + l * stride + w * 8, sizeof(x));
+				x = be64toh(x);
+				ones[l] += bitcount_64(x);
+				runs[l] += bitcount_64((x ^ (x >> 1)) &
+				    0x7fffffffffffffffULL);
+				runs[l] += (unsigned int)(x >> 63) ^ last[l];
+				last[l] = (unsigned int)x & 0x01;
+			}
+		}
+		for (l = 0; l < nl; l++) {
+			if (n > 0) {
+				t = (uint8_t *)(s + l * stride + nw * 8);
+				ones[l] += frequency_sum1(t, n);
+				runs[l] += (t[0] >> 7) ^ last[l];
+				runs[l] += runs_runs_count2(t, n);
+			}
+			memset(&result[i + l], 0, sizeof(result[i + l]));
+			runs_result(&result[i + l], ones[l], runs[l], nbits,
+			    p->flags, crit);
+		}
+	}
 
 	return (0);
 }
@@ -249,4 +328,5 @@ const struct tras_algo runs_algo = {
 	.final =	runs_final,
 	.restart =	tras_do_restart,
 	.free =		tras_do_free,
+	.batch =	runs_batch,
 };
@@ -37,7 +37,7 @@
  * Parameters for the Runs Test.
  */
 struct runs_params {
-	int	flags;	/* init flags */
+	int	flags;	/* TRAS_P_* flags */
 	double	alpha;	/* significance level */
 };
 
@@ -58,4 +58,6 @@ struct runs_params {
 
 TRAS_DECLARE_ALGO(runs);
 
+tras_test_batch_t runs_batch;
+
 #endif
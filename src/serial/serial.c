@@ -35,8 +35,10 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include <tras.h>
+#include <igamc.h>
 #include <serial.h>
 
 /*
@@ -60,15 +62,16 @@ serial_alloc_context(struct tras_ctx *ctx, struct serial_params *p)
 {
 	struct serial_ctx *c;
 	unsigned int sm, me;
-
-	ctx->context = NULL;
+	int error;
 
 	sm = 1 << p->m;
 	me = sm + sm / 2 + sm / 4;
 
-	c = malloc(sizeof(struct serial_ctx) + me * sizeof(unsigned int));
-	if (c == NULL)
-		return (ENOMEM);
+	error = tras_init_context(ctx, &serial_algo, sizeof(struct serial_ctx) +
+	    me * sizeof(unsigned int), 0);
+	if (error != 0)
+		return (error);
+	c = ctx->context;
 
 	c->m0 = (unsigned int *)(c + 1);
 	c->m1 = (unsigned int *)(c->m0 + sm);
@@ -80,8 +83,6 @@ serial_alloc_context(struct tras_ctx *ctx, struct serial_params *p)
 	c->alpha = p->alpha;
 	c->nbits = 0;
 
-	ctx->context = c;
-
 	return (0);
 }
 
@@ -119,13 +120,8 @@ serial_init(struct tras_ctx *ctx, void *params)
 	 */
 
 	error = serial_alloc_context(ctx, p);
-	if (error != 0) {
-		ctx->state = TRAS_STATE_NONE;
+	if (error != 0)
 		return (error);
-	}
-
-	ctx->algo = &serial_algo;
-	ctx->state = TRAS_STATE_INIT;
 
 	return (0);
 }
@@ -195,13 +191,8 @@ serial_final(struct tras_ctx *ctx)
 	/* Calculate second test statistics square psi square for m */
 	dpsim2 = psim0 - 2 * psim1 + psim2;
 
-	/* todo: Calculate first p-value for the first statistics */
-	pvalue1 = 0.0;
-
-	/* todo: Calculate second p-value for the second statistics */
-	pvalue2 = 0.0;
-
-	/* Todo: finalize the test. */
+	pvalue1 = igamc(ldexp(1.0, (int)m - 2), dpsim1 / 2.0);
+	pvalue2 = igamc(ldexp(1.0, (int)m - 3), dpsim2 / 2.0);
 
 	/* Determine and store results */
 	if (pvalue1 < c->alpha || pvalue2 < c->alpha)
@@ -210,6 +201,8 @@ serial_final(struct tras_ctx *ctx)
 		ctx->result.status = TRAS_TEST_PASSED;
 
 	ctx->result.discard = n % c->m;
+	ctx->result.stats1 = dpsim1;
+	ctx->result.stats2 = dpsim2;
 	ctx->result.pvalue1 = pvalue1;
 	ctx->result.pvalue2 = pvalue2;
 
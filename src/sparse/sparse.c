@@ -46,8 +46,6 @@
 #include <sparse.h>
 #include <cdefs.h>
 
-#include <stdio.h>
-
 static int
 sparse_verify_params(struct tras_ctx *ctx, struct sparse_params *p)
 {
@@ -66,6 +64,8 @@ sparse_verify_params(struct tras_ctx *ctx, struct sparse_params *p)
 		return (EINVAL);
 	if (p->r == 0 || p->r > 32)
 		return (EINVAL);
+	if (p->sweep == NULL && p->boff + p->b > p->r)
+		return (EINVAL);
 	return (0);
 }
 
@@ -83,6 +83,17 @@ sparse_min_nbits(struct sparse_params *p)
 	return (sparse_max_nbits(p));
 }
 
+/*
+ * Number of letter offsets tested, in the sweep mode all offsets of b-bit
+ * letter in r-bit word.
+ */
+inline static unsigned int
+sparse_noffs(const struct sparse_params *p)
+{
+
+	return ((p->sweep != NULL) ? p->r - p->b + 1 : 1);
+}
+
 static void
 sparse_init_context(struct sparse_ctx *c, void *params)
 {
@@ -90,16 +101,22 @@ sparse_init_context(struct sparse_ctx *c, void *params)
 
 	if (params != NULL)
 		memcpy(p, params, sizeof(struct sparse_params));
-	c->wmap = (uint8_t *)(c + 1);
+	c->wmap = (uint64_t *)(c + 1);
 	c->nbits = 0;
 	c->alpha = p->alpha;
 	c->letters = 0;
 	c->lmax = p->wmax + p->k - 1;
-	c->word = 0;
-	c->sparse = (unsigned int)pow(p->m, p->k);
+	c->noffs = sparse_noffs(p);
+	if (p->sweep != NULL)
+		p->boff = 0;
+	memset(c->word, 0, sizeof(c->word));
+	c->group = 0;
+	c->gbits = 0;
+	c->words = (unsigned int)pow(p->m, p->k);
+	c->sparse = c->words;
 	c->lmask = (1 << p->b) - 1;
 	c->wmask = (1 << (p->k * p->b)) - 1;
-	memset(c->wmap, 0, c->sparse / 8);
+	memset(c->wmap, 0, (size_t)c->noffs * c->words / 8);
 }
 
 int
@@ -116,7 +133,7 @@ sparse_init(struct tras_ctx *ctx, void *params)
 		return (error);
 
 	error = tras_init_context(ctx, &sparse_algo, sizeof(struct sparse_ctx) +
-	    (size_t)pow(p->m, p->k) / 8, TRAS_F_ZERO);
+	    sparse_noffs(p) * (size_t)pow(p->m, p->k) / 8, TRAS_F_ZERO);
 	if (error != 0)
 		return (error);
 
@@ -125,111 +142,219 @@ sparse_init(struct tras_ctx *ctx, void *params)
 	return (0);
 }
 
-static uint32_t lmask[32] = {
-	0x00000000, 0x00000001, 0x00000003, 0x00000007,
-	0x0000000f, 0x0000001f, 0x0000003f, 0x0000007f,
-	0x000000ff, 0x000001ff, 0x000003ff, 0x000007ff,
-	0x00000fff, 0x00001fff, 0x00003fff, 0x00007fff,
-	/* ... */
-};
+/* Add one letter to the word w */
+#define	SPARSE_WORD_SET(c, p, w, l) do {			\
+	(w) = (((w) << (p)->b) | (l)) & (c)->wmask;		\
+} while (0)
 
-static uint32_t hmask[32] = {
-};
+#define	miss(c, cmax)	(((c) < (cmax)) ? (cmax) - (c) : 0)
 
-#define	SPARSE_WORD_LETTER(w, b, o)				\
-	((w) >> (o)) & lmask[(b) & 0x1f] 			\
-	(w) << (32 - (((o) + (b)) & 0x1f))
+/* Number of letters extracted at once before the words map update */
+#define	SPARSE_BATCH		256
 
+/*
+ * Get up to 32 bits from the data starting at bit offset offs. The data is
+ * a stream of bits, the most significant bit of each byte goes first.
+ */
+static uint32_t
+sparse_get_bits(const uint8_t *data, unsigned int offs, unsigned int nbits)
+{
+	const uint8_t *d = data + (offs >> 3);
+	uint64_t reg;
+	unsigned int avail;
+
+	reg = *d++ & lmask8[8 - (offs & 0x07)];
+	avail = 8 - (offs & 0x07);
+	while (avail < nbits) {
+		reg = (reg << 8) | *d++;
+		avail += 8;
+	}
+	return ((uint32_t)(reg >> (avail - nbits)) & lmask32[nbits]);
+}
 
-/* Add one stroke to the word w */
-#define	SPARSE_WORD_SET(c, p, w, s) do {			\
-	(w) = ((w) << (p)->b) & (c)->wmask;			\
-	(w) = (w) | (((s) >> (32 - (p)->b)) & (c)->lmask);	\
-} while (0)
+/*
+ * Extract n r-bit groups from the data starting at bit offset offs, each
+ * group is taken from the stream as a big endian number. The common case
+ * of 32-bit groups on byte boundary is a simple loop over the words.
+ */
+static void
+sparse_extract(const struct sparse_params *p, const uint8_t *data,
+    unsigned int offs, uint32_t *groups, unsigned int n)
+{
+	const uint8_t *d = data + (offs >> 3);
+	uint32_t gm = lmask32[p->r];
+	unsigned int i, r = p->r, avail;
+	uint64_t reg;
+
+	if (r == 32 && (offs & 0x07) == 0) {
+		for (i = 0; i < n; i++, d += 4) {
+			groups[i] = ((uint32_t)d[0] << 24) |
+			    ((uint32_t)d[1] << 16) | ((uint32_t)d[2] << 8) |
+			    (uint32_t)d[3];
+		}
+		return;
+	}
 
-/* Update words map and sparse counter with a word */
-#define SPARSE_WMAP_SET(c, w) do {				\
-	uint32_t mask, wpos;					\
-	mask = 1 << ((w) & 0x07);				\
-	wpos = (w) >> 3;					\
-	if (((c)->wmap[wpos] & mask) == 0) {			\
-		(c)->wmap[wpos] |= mask;			\
-		(c)->sparse--;					\
-	}							\
-} while (0)
+	reg = *d++ & lmask8[8 - (offs & 0x07)];
+	avail = 8 - (offs & 0x07);
+	for (i = 0; i < n; i++) {
+		while (avail < r) {
+			reg = (reg << 8) | *d++;
+			avail += 8;
+		}
+		avail -= r;
+		groups[i] = (uint32_t)(reg >> avail) & gm;
+	}
+}
 
-#define	miss(c, cmax)	(((c) < (cmax)) ? (cmax) - (c) : 0)
+/*
+ * Mark n words in the words map. There is no test if the word is already
+ * there, the missing words are counted once by the final. The map lines
+ * for the next words are prefetched, the words are random by definition.
+ */
+void
+sparse_wmap_update(uint64_t *wmap, const uint32_t *words, unsigned int n)
+{
+	unsigned int i;
 
-/* Simple shift right with window */
-#define	SPARSE_SHRW(s, o, b)	\
-	(((s) >> (o)) & ((1 << b) - 1))
-/* Simple shift left with window */
-#define	SPARSE_SHLW(s, o, b)	\
-	(((s) << (o)) & ((1 << b) - 1))
-
-#define	SPARSE_ROTR32(s, o)	\
-	()
-#define	SPARS_ROTL32(s, o)	\
-	()
-#define	SPARSE_ROTR32W(s, o, b)	\
-	()
-#define	SPARSE_ROTL32W(s, o, b)	\
-	()
+	for (i = 0; i + SPARSE_PREFETCH < n; i++) {
+		prefetchw(&wmap[words[i + SPARSE_PREFETCH] >> 6]);
+		SPARSE_WMAP_SET(wmap, words[i]);
+	}
+	for (; i < n; i++)
+		SPARSE_WMAP_SET(wmap, words[i]);
+}
+
+/*
+ * Count words never seen, the number of zero bits in the words map.
+ */
+unsigned int
+sparse_missing_words(const uint64_t *wmap, unsigned int words)
+{
+	unsigned int i, n = 0;
+
+	for (i = 0; i < words / 64; i++)
+		n += bitcount_64(wmap[i]);
+
+	return (words - n);
+}
+
+/*
+ * Append letters of the groups to the overlapping words of each offset and
+ * mark the words in the map of the offset. The first k - 1 letters of the
+ * test do not complete any word. The offsets are processed one by one, so
+ * only one words map at a time is touched.
+ */
+static void
+sparse_put_groups(struct sparse_ctx *c, const uint32_t *groups,
+    unsigned int n)
+{
+	struct sparse_params *p = &c->params;
+	uint32_t word, words[SPARSE_BATCH];
+	unsigned int i, j, o, w, sh;
+
+	for (w = 0; w < n && c->letters < p->k - 1; w++) {
+		for (o = 0; o < c->noffs; o++) {
+			sh = p->boff + o;
+			SPARSE_WORD_SET(c, p, c->word[o],
+			    (groups[w] >> sh) & c->lmask);
+		}
+		c->letters++;
+	}
+	c->letters += n - w;
+
+	for (o = 0; o < c->noffs; o++) {
+		sh = p->boff + o;
+		word = c->word[o];
+		for (i = w, j = 0; i < n; i++, j++) {
+			SPARSE_WORD_SET(c, p, word, (groups[i] >> sh) & c->lmask);
+			words[j] = word;
+		}
+		c->word[o] = word;
+		sparse_wmap_update(SPARSE_WMAP(c, o), words, j);
+	}
+}
 
 int
 sparse_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct sparse_params *p;
 	struct sparse_ctx *c;
-	uint32_t *strokes, word;
-	unsigned int n, i, k;
+	uint32_t groups[SPARSE_BATCH];
+	unsigned int n, k, offs;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
-	if (nbits & 0x1f)
-		return (EINVAL);
-
 	c = ctx->context;
 	p = &c->params;
 
-	k = miss(c->letters, c->lmax);
-	n = nbits / 32;
-	n = min(k, n);
-	if (n > 0) {
-		strokes = (uint32_t *)data;
-		word = c->word;
-		if (c->letters < p->k) {
-			k = min(n, p->k - c->letters);
-			for (i = 0; i < k; i++)
-				SPARSE_WORD_SET(c, p, word, strokes[i]);
-			c->letters += k;
-			if (c->letters < p->k) {
-				c->word = word;
-				c->nbits += nbits;
-				return (0);
-			}
-			SPARSE_WMAP_SET(c, word);
-			n = n - k;
-			strokes += k;
+	offs = 0;
+	if (c->gbits > 0 && c->letters < c->lmax) {
+		/* Complete the group started in the previous update */
+		n = min(nbits, p->r - c->gbits);
+		c->group = (c->group << n) | sparse_get_bits(data, 0, n);
+		c->gbits += n;
+		if (c->gbits < p->r) {
+			c->nbits += nbits;
+			return (0);
 		}
-		for (i = 0; i < n; i++) {
-			SPARSE_WORD_SET(c, p, word, strokes[i]);
-			SPARSE_WMAP_SET(c, word);
-		}
-		c->word = word;
-		c->letters += n;
+		sparse_put_groups(c, &c->group, 1);
+		c->group = 0;
+		c->gbits = 0;
+		offs = n;
+	}
+
+	n = (nbits - offs) / p->r;
+	n = min(n, miss(c->letters, c->lmax));
+	while (n > 0) {
+		k = min(n, SPARSE_BATCH);
+		sparse_extract(p, data, offs, groups, k);
+		sparse_put_groups(c, groups, k);
+		offs += k * p->r;
+		n -= k;
+	}
+
+	/* Keep bits of not full group for the next update */
+	if (c->letters < c->lmax && offs < nbits) {
+		c->gbits = nbits - offs;
+		c->group = sparse_get_bits(data, offs, c->gbits);
 	}
 	c->nbits += nbits;
 
 	return (0);
 }
 
+/*
+ * Calculate the test result for the number of missing words.
+ */
+static void
+sparse_result(const struct sparse_params *p, unsigned int missing,
+    struct tras_result *r)
+{
+	double pvalue, s;
+
+	s = (double)missing - p->mean;
+	s = fabs(s) / p->var / sqrt((double)2.0);
+	pvalue = erfc(fabs(s));
+
+	if (pvalue < p->alpha)
+		r->status = TRAS_TEST_FAILED;
+	else
+		r->status = TRAS_TEST_PASSED;
+
+	r->stats1 = (double)missing;
+	r->stats2 = s;
+	r->pvalue1 = pvalue;
+	r->pvalue2 = 0;
+}
+
 int
 sparse_final(struct tras_ctx *ctx)
 {
 	struct sparse_ctx *c;
 	struct sparse_params *p;
-	double pvalue, s;
+	struct tras_result *r;
+	unsigned int o;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -239,20 +364,28 @@ sparse_final(struct tras_ctx *ctx)
 	if (c->nbits < sparse_min_nbits(p))
 		return (EALREADY);
 
-	s = (double)c->sparse - p->mean;
-	s = fabs(s) / p->var / sqrt((double)2.0);
-	pvalue = erfc(fabs(s));
-
-	if (pvalue < c->alpha)
-		ctx->result.status = TRAS_TEST_FAILED;
-	else
-		ctx->result.status = TRAS_TEST_PASSED;
+	c->sparse = sparse_missing_words(c->wmap, c->words);
+	sparse_result(p, c->sparse, &ctx->result);
+
+	/*
+	 * In the sweep mode the test result is the one of the offset with
+	 * the lowest p-value, the test fails if any of the offsets fails.
+	 */
+	if (p->sweep != NULL) {
+		p->sweep->n = c->noffs;
+		for (o = 0; o < c->noffs; o++) {
+			r = &p->sweep->result[o];
+			sparse_result(p, sparse_missing_words(SPARSE_WMAP(c, o),
+			    c->words), r);
+			r->discard = c->nbits - sparse_max_nbits(p);
+			if (r->pvalue1 < ctx->result.pvalue1)
+				ctx->result = *r;
+			if (r->status == TRAS_TEST_FAILED)
+				ctx->result.status = TRAS_TEST_FAILED;
+		}
+	}
 
 	ctx->result.discard = c->nbits - sparse_max_nbits(p);
-	ctx->result.stats1 = (double)c->sparse;
-	ctx->result.stats2 = s;
-	ctx->result.pvalue1 = pvalue;
-	ctx->result.pvalue2 = 0;
 
 	tras_fini_context(ctx, 0);
 
@@ -279,6 +412,8 @@ sparse_restart(struct tras_ctx *ctx, void *params)
 		return (ENXIO);
 
 	sparse_init_context(ctx->context, NULL);
+	memset(&ctx->result, 0, sizeof(ctx->result));
+	ctx->state = TRAS_STATE_INIT;
 
 	return (0);
 }
@@ -315,6 +450,7 @@ sparse_set_params(struct sparse_params *sp, const struct sparse_params *spin,
 
 	sp->alpha = p->alpha;
 	sp->boff = p->boff;
+	sp->sweep = p->sweep;
 
 	return (0);
 }
@@ -33,6 +33,9 @@
 #ifndef __SPARSE_H__
 #define	__SPARSE_H__
 
+/* Max number of letter offsets in one rng word */
+#define	SPARSE_MAX_OFFSETS	TRAS_MAX_OFFSETS
+
 /*
  * The structure with all parameters for generic sparse occupancy.
  */
@@ -41,11 +44,12 @@ struct sparse_params {
 	unsigned int	k;	/* number of letters in a word */
 	unsigned int	b;	/* number of bits for a letter */
 	unsigned int	r;	/* number of bits in one rng word */
-	unsigned int	boff;	/* offset of bits in one stroke int */
+	unsigned int	boff;	/* letter offset from lsb of rng word */
 	unsigned int	wmax;	/* max number of words to update */
 	double		mean;	/* mean of missing words */
 	double		var;	/* variance of normal statistics */
 	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* if set, test all letter offsets */
 };
 
 /*
@@ -54,6 +58,7 @@ struct sparse_params {
 struct oxso_params {
 	unsigned int	boff;	/* offset of bits in one stroke int */
 	double		alpha;	/* significance level for H0 */
+	struct tras_sweep *sweep; /* if set, test all letter offsets */
 };
 
 /* The number of possible words, 2 ^ 20 */
@@ -68,16 +73,35 @@ struct oxso_params {
 struct sparse_ctx {
 	unsigned int	nbits;	/* number of bits processed */
 	double		alpha;	/* significance level for H0 */
-	uint8_t *	wmap;	/* bits map for DNA words */
+	uint64_t *	wmap;	/* bits maps for words, one per offset */
 	unsigned int	letters;/* letters in context */
 	unsigned int	lmax;	/* max letters to update */
-	uint32_t	word;	/* last 3 words collected */
-	unsigned int	sparse;	/* number of missing words */
+	unsigned int	noffs;	/* number of letter offsets tested */
+	uint32_t	word[SPARSE_MAX_OFFSETS]; /* last k letters by offset */
+	uint32_t	group;	/* bits of not full r-bit group */
+	unsigned int	gbits;	/* number of bits in the group */
+	unsigned int	words;	/* number of possible words */
+	unsigned int	sparse;	/* number of missing words, set by final */
 	uint32_t	lmask;	/* precalculated mask for letter */
 	uint32_t	wmask;	/* precalculated mask for word */
 	struct sparse_params params; /* backup of params */
 };
 
+/* Mark the word w in the words map */
+#define	SPARSE_WMAP_SET(wmap, w) do {				\
+	(wmap)[(w) >> 6] |= (uint64_t)1 << ((w) & 0x3f);	\
+} while (0)
+
+/* The words map for the offset o */
+#define	SPARSE_WMAP(c, o)	((c)->wmap + (size_t)(o) * ((c)->words / 64))
+
+/* Distance in words for the words map prefetch */
+#define	SPARSE_PREFETCH		16
+
+void sparse_wmap_update(uint64_t *wmap, const uint32_t *words,
+    unsigned int n);
+unsigned int sparse_missing_words(const uint64_t *wmap, unsigned int words);
+
 int sparse_set_params(struct sparse_params *sp,
     const struct sparse_params *spin, struct oxso_params *params);
 int sparse_generic_restart(struct tras_ctx *ctx,
@@ -36,10 +36,12 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <float.h>
 #include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
+#include <uniform.h>
 #include <sphere3d.h>
 
 #define	SPHERE3D_ID_FULL_NUMBERS	0
@@ -50,19 +52,18 @@
 #define	SPHERE3D_COMPONENT_BITS		NBITS(sizeof(double))	
 
 /*
- * Vector representing point in 3D space.
- */
-struct point {
-	double	x;		/* x component */
-	double	y;		/* y component */
-	double	z;		/* z component */
-};
-
-/*
- * The context structure for the 3D spheres test.
+ * The context structure for the 3D spheres test. Points are kept as
+ * a structure of arrays, each component in its own table.
  */
 struct sphere3d_ctx {
-	struct point *	points;	/* points list for update */
+	double *	x;	/* x components of points */
+	double *	y;	/* y components of points */
+	double *	z;	/* z components of points */
+	double *	gx;	/* x components ordered by cell */
+	double *	gy;	/* y components ordered by cell */
+	double *	gz;	/* z components ordered by cell */
+	double *	coords;	/* coordinates as updated, in gx/gy/gz */
+	unsigned int *	cell;	/* cell boundaries in gx/gy/gz */
 	unsigned int	npoint;	/* number of points updated */
 	unsigned int	K;	/* the maximum number of points */
 	unsigned int	nbits;	/* number of bits processed */
@@ -91,7 +92,8 @@ sphere3d_init(struct tras_ctx *ctx, void *params)
 	 * updates until final state. It should not be a problem
 	 * to malloc and keep all incomming data when K is limited.
 	 */
-	size = sizeof(struct sphere3d_ctx) + p->K * sizeof(struct point);
+	size = sizeof(struct sphere3d_ctx) + 6 * p->K * sizeof(double) +
+	    (p->K + 2) * sizeof(unsigned int);
 
 	error = tras_init_context(ctx, &sphere3d_algo, size, TRAS_F_ZERO);
 	if (error != 0)
@@ -99,72 +101,182 @@ sphere3d_init(struct tras_ctx *ctx, void *params)
 
 	c = ctx->context;
 
-	c->points = (struct point *)(c + 1);
+	c->x = (double *)(c + 1);
+	c->y = c->x + p->K;
+	c->z = c->y + p->K;
+	c->gx = c->z + p->K;
+	c->gy = c->gx + p->K;
+	c->gz = c->gy + p->K;
+	c->coords = c->gx;
+	c->cell = (unsigned int *)(c->gz + p->K);
 	c->K = p->K;
 	c->alpha = p->alpha;
 
 	return (0);
 }
 
-static double
-sphere3d_distance_axis_min(struct point *p1, struct point *p2)
+/*
+ * Get the cell column, row or layer of the point component for the cell
+ * list of g x g x g cubes.
+ */
+inline static unsigned int
+sphere3d_cell_index(double v, double scale, unsigned int g)
 {
-	double dx, dy, dz;
+	unsigned int i;
 
-	dx = fabs(p2->x - p1->x);
-	dy = fabs(p2->y - p1->y);
-	dy = fabs(p2->z - p1->z);
-
-	return (min(min(dx, dy), dz));
+	i = (unsigned int)(v * scale);
+	return (min(i, g - 1));
 }
 
-static double
-sphere3d_distance_euclidean_pow2(struct point *p1, struct point *p2)
+inline static unsigned int
+sphere3d_cell(struct sphere3d_ctx *c, unsigned int i, double scale,
+    unsigned int g)
 {
-	double dx, dy, dz;
 
-	dx = (p2->x - p1->x);
-	dy = (p2->y - p1->y);
-	dz = (p2->z - p1->z);
+	return ((sphere3d_cell_index(c->z[i], scale, g) * g +
+	    sphere3d_cell_index(c->y[i], scale, g)) * g +
+	    sphere3d_cell_index(c->x[i], scale, g));
+}
 
-	return (dx * dx + dy * dy + dz * dz);
+/*
+ * Distribute the points into the cell list of g x g x g cubes with
+ * a counting sort. After the call, points of the cube k are
+ * gx/gy/gz[cell[k] .. cell[k+1]).
+ */
+static void
+sphere3d_cells_build(struct sphere3d_ctx *c, unsigned int g)
+{
+	unsigned int *cell;
+	unsigned int i, k, n;
+	double scale;
+
+	cell = c->cell;
+	n = g * g * g;
+	scale = g / SPHERE3D_SIDE;
+
+	memset(cell, 0, (n + 2) * sizeof(unsigned int));
+	for (i = 0; i < c->K; i++)
+		cell[sphere3d_cell(c, i, scale, g) + 2]++;
+	for (k = 2; k < n + 2; k++)
+		cell[k] += cell[k - 1];
+	for (i = 0; i < c->K; i++) {
+		k = cell[sphere3d_cell(c, i, scale, g) + 1]++;
+		c->gx[k] = c->x[i];
+		c->gy[k] = c->y[i];
+		c->gz[k] = c->z[i];
+	}
 }
 
+/*
+ * Get the minimum squared distance between points of the cell [a0, a1)
+ * and points of [b0, b1) following them, and dmin.
+ */
 static double
-sphere3d_distance_min_pow2(struct point *points, unsigned int n)
+sphere3d_cell_pair(const double *x, const double *y, const double *z,
+    unsigned int a0, unsigned int a1, unsigned int b0, unsigned int b1,
+    double dmin)
 {
-	struct point *p1, *p2;
 	unsigned int i, j;
-	double dmin, d;
-
-	dmin = sphere3d_distance_euclidean_pow2(points, points + 1);
-
-	for (i = 0, p1 = points; i < n - 1; i++, p1++) {
-		for (j = i + 1, p2 = p1 + 1; j < n; j++, p2++) {
-			d = sphere3d_distance_euclidean_pow2(p1, p2);
-			if (d < dmin)
-				dmin = d;
+	double dx, dy, dz, d;
+
+	for (i = a0; i < a1; i++) {
+		for (j = max(b0, i + 1); j < b1; j++) {
+			dx = x[j] - x[i];
+			dy = y[j] - y[i];
+			dz = z[j] - z[i];
+			d = dx * dx + dy * dy + dz * dz;
+			dmin = d < dmin ? d : dmin;
 		}
 	}
 	return (dmin);
 }
 
-inline static double
-sphere3d_uint_to_floatU01(uint32_t u32)
+/*
+ * Find the minimum squared distance between the points in the cell list
+ * of g x g x g cubes. Each cube is compared with itself and with the 13
+ * neighbours following it; neighbours in one row are adjacent in the
+ * ordered points, so they are compared as one range. The result is exact
+ * if it is not greater than the squared cube side.
+ */
+static double
+sphere3d_cells_search(struct sphere3d_ctx *c, unsigned int g)
 {
-
-	/* XXX: this is wrong function that need to be corrected
-	 * because since u32 is uniformly distributed the
-	 * return value is not.
-	 */
-	return ((double)u32 / pow(2.0, 32));
+	const unsigned int *cell;
+	unsigned int cx, cy, cz, k, r, a0, a1, lo, hi;
+	int dy;
+	double dmin;
+
+	cell = c->cell;
+	dmin = DBL_MAX;
+
+	for (cz = 0; cz < g; cz++) {
+		for (cy = 0; cy < g; cy++) {
+			for (cx = 0; cx < g; cx++) {
+				k = (cz * g + cy) * g + cx;
+				a0 = cell[k];
+				a1 = cell[k + 1];
+				if (a0 == a1)
+					continue;
+				lo = cx > 0 ? 1 : 0;
+				hi = cx + 1 < g ? 2 : 1;
+
+				/* The cube itself and the next in row. */
+				dmin = sphere3d_cell_pair(c->gx, c->gy, c->gz,
+				    a0, a1, a0, cell[k + hi], dmin);
+
+				/* The next row in the same layer. */
+				if (cy + 1 < g) {
+					r = k + g;
+					dmin = sphere3d_cell_pair(c->gx, c->gy,
+					    c->gz, a0, a1, cell[r - lo],
+					    cell[r + hi], dmin);
+				}
+
+				/* Three rows in the next layer. */
+				if (cz + 1 == g)
+					continue;
+				for (dy = -1; dy <= 1; dy++) {
+					if ((int)cy + dy < 0 ||
+					    (int)cy + dy >= (int)g)
+						continue;
+					r = k + g * g + dy * (int)g;
+					dmin = sphere3d_cell_pair(c->gx, c->gy,
+					    c->gz, a0, a1, cell[r - lo],
+					    cell[r + hi], dmin);
+				}
+			}
+		}
+	}
+	return (dmin);
 }
 
-inline static double
-sphere3d_point_component(uint32_t u32)
+/*
+ * Get the minimum Euclidean distance between the points raised to the
+ * power of 2. The cell list starts with about one point per cube. If
+ * the minimum found is larger than a cube, the cubes are enlarged to
+ * contain it and the search is repeated.
+ */
+static double
+sphere3d_distance_min_pow2(struct sphere3d_ctx *c)
 {
-
-	return ((sphere3d_uint_to_floatU01(u32) * 1000.0));
+	unsigned int g;
+	double dmin, w;
+
+	g = (unsigned int)cbrt((double)c->K);
+	for (;;) {
+		sphere3d_cells_build(c, g);
+		dmin = sphere3d_cells_search(c, g);
+		w = SPHERE3D_SIDE / g;
+		if (g == 1 || dmin <= w * w)
+			break;
+		if (dmin == DBL_MAX)
+			g = (g + 1) / 2;
+		else
+			g = min(g - 1, (unsigned int)(SPHERE3D_SIDE /
+			    sqrt(dmin)));
+		g = max(g, 1);
+	}
+	return (dmin);
 }
 
 /*
@@ -174,10 +286,7 @@ int
 sphere3d_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct sphere3d_ctx *c;
-	struct point *p;
-	unsigned int n, b, k;
-	uint32_t *d;
-	double coord;
+	unsigned int n, b;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -185,34 +294,20 @@ sphere3d_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 		return (EINVAL);
 
 	c = ctx->context;
-	d = (uint32_t *)data;
 
 	/*
-	 * todo: what about endiannes ???
+	 * The coordinates are converted in stream order, x, y and z of
+	 * each point in turn, to the space of gx, gy and gz, which is not
+	 * used until final.
 	 */
 	b = c->nbits / 32;
 	b = min(b, 3 * c->K);
 
-	p = &c->points[b / 3];
 	n = 3 * c->K - b;
 	n = min(n, nbits / 32);
 
-	while (n > 0) {
-		coord = sphere3d_point_component(*d);
-		k = b % 3;
-		if (k == 0)
-			p->x = coord;
-		else if (k == 1)
-			p->y = coord;
-		else {
-			p->z = coord;
-			p++;
-		}
-		b++;
-		d++;
-		n--;
-	}
-	c->npoint = b / 3;
+	uniform_be32_to_double(c->coords + b, data, n, SPHERE3D_SIDE);
+	c->npoint = (b + n) / 3;
 	c->nbits += nbits;
 
 	return (0);
@@ -227,25 +322,34 @@ sphere3d_final(struct tras_ctx *ctx)
 	struct sphere3d_ctx *c;
 	double pvalue, mean;
        	double r1min, r2min, r3min;
+	unsigned int i;
 
 	TRAS_CHECK_FINAL(ctx);
 
 	c = ctx->context;
 
-	if (c->npoint < SPHERE3D_MIN_TRIPLETS)
+	if (c->npoint < c->K)
 		return (EALREADY);
 
+	for (i = 0; i < c->K; i++) {
+		c->x[i] = c->coords[3 * i];
+		c->y[i] = c->coords[3 * i + 1];
+		c->z[i] = c->coords[3 * i + 2];
+	}
+
 	/*
-	 * Cubed min radius is expotential with mean 30. Thus,
+	 * Cubed min radius is expotential with mean 3V / (2 Pi K(K-1)),
+	 * about 30 for 4000 points in the cube of side 1000. Thus,
 	 * the volume of the sphere with dmin radius is very close
 	 * expotentially distributed with mean 120 * Pi / 3. No need
 	 * to calculate volume, using radius.
 	 */
 
-	r2min = sphere3d_distance_min_pow2(c->points, c->K);
+	r2min = sphere3d_distance_min_pow2(c);
 	r1min = sqrt(r2min);
 	r3min = r1min * r2min;
-	mean = 30.0;
+	mean = 3.0 * SPHERE3D_SIDE * SPHERE3D_SIDE * SPHERE3D_SIDE /
+	    (2.0 * M_PI * c->K * (c->K - 1.0));
 	pvalue = 1.0 - exp(-r3min / mean);
 
 	/* Determine and store results */
@@ -254,7 +358,7 @@ sphere3d_final(struct tras_ctx *ctx)
 	else
 		ctx->result.status = TRAS_TEST_PASSED;
 
-	ctx->result.discard = c->nbits - SPHERE3D_MIN_NBITS;
+	ctx->result.discard = c->nbits - 96 * c->K;
 	ctx->result.stats1 = r3min;
 	ctx->result.pvalue1 = pvalue;
 
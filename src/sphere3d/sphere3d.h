@@ -42,12 +42,17 @@ struct sphere3d_params {
 TRAS_DECLARE_ALGO(sphere3d);
 
 #define	SPHERE3D_MIN_NUMBERS	12000
-#define	SPHERE3D_MAX_NUMBERS	12000
+#define	SPHERE3D_MAX_NUMBERS	(3 << 22)
 
 #define	SPHERE3D_MIN_TRIPLETS	(SPHERE3D_MIN_NUMBERS / 3)
 #define	SPHERE3D_MAX_TRIPLETS	(SPHERE3D_MAX_NUMBERS / 3)
 
 #define	SPHERE3D_MIN_NBITS	(32 * SPHERE3D_MIN_NUMBERS)
-#define	SPHERE3D_MAX_NBITS	SPHERE3D_MIN_NBITS
+#define	SPHERE3D_MAX_NBITS	(32 * SPHERE3D_MAX_NUMBERS)
+
+/*
+ * Side of the cube the points are placed in.
+ */
+#define	SPHERE3D_SIDE		1000.0
 
 #endif
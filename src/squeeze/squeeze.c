@@ -36,12 +36,47 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <endian.h>
 #include <math.h>
 
 #include <tras.h>
 #include <cdefs.h>
+#include <igamc.h>
 #include <squeeze.h>
 
+/*
+ * Words are dealt in turn to SQUEEZE_LANES independent squeeze chains,
+ * so the dependent multiplications of different chains overlap.
+ */
+#define	SQUEEZE_LANES		8
+
+/*
+ * The starting value of k and the range of iterations counted.
+ */
+#define	SQUEEZE_K0		2147483647
+#define	SQUEEZE_MIN_ITER	6
+#define	SQUEEZE_MAX_ITER	48
+
+/*
+ * Probabilities of 6 or less, 7, 8, ..., 47 and 48 or more iterations to
+ * squeeze k = 2^31 - 1 to 1. A step makes k uniform on 1..k, so the number
+ * of iterations is 1 + the sum of geometric variables with ratios 1/i,
+ * i = 2..k, which gives the values exactly.
+ */
+static const double squeeze_probs[SQUEEZE_CHI_SQUARE_SLOTS] = {
+	2.1032519090e-05, 5.7792513121e-05, 1.7553783349e-04, 4.6732309591e-04,
+	1.1078273105e-03, 2.3678432149e-03, 4.6094452169e-03, 8.2411665048e-03,
+	1.3627817807e-02, 2.0968501481e-02, 3.0176128758e-02, 4.0801978277e-02,
+	5.2042038688e-02, 6.2838288102e-02, 7.2056379811e-02, 7.8694514986e-02,
+	8.2067555218e-02, 8.1919347120e-02, 7.8440075201e-02, 7.2194108926e-02,
+	6.3986784384e-02, 5.4709301369e-02, 4.5198513605e-02, 3.6136598319e-02,
+	2.8000268738e-02, 2.1055667399e-02, 1.5386517949e-02, 1.0940197996e-02,
+	7.5779580330e-03, 5.1195622632e-03, 3.3772564755e-03, 2.1778643256e-03,
+	1.3743850511e-03, 8.4969760424e-04, 5.1518157579e-04, 3.0665731846e-04,
+	1.7938960624e-04, 1.0323895444e-04, 5.8511581104e-05, 3.2691865249e-05,
+	1.8025309183e-05, 9.8177821070e-06, 1.1209908694e-05,
+};
+
 /*
  * The context structure for the squeeze test.
  */
@@ -49,8 +84,8 @@ struct squeeze_ctx {
 	unsigned int	nint;	/* number of integers processed */
 	unsigned int *	freqt;	/* frequency table for iterations */
 	unsigned int	nfreq;	/* number of slots for chi-square */
-	unsigned int	klast;	/* squeezed value from last update */
-	unsigned int	ilast;	/* the iterations from last update */
+	uint32_t	k[SQUEEZE_LANES];/* squeezed values of chains */
+	unsigned int	iter[SQUEEZE_LANES];/* iterations of chains */
 	unsigned int	nword;	/* the number of words updated */
 	unsigned int	K;	/* max number of integers */
 	unsigned int	nbits;	/* number of bits processed */
@@ -66,6 +101,7 @@ squeeze_init(struct tras_ctx *ctx, void *params)
 	struct squeeze_params *p = params;
 	struct squeeze_ctx *c;
 	size_t size;
+	unsigned int l;
 	int error;
 
 	TRAS_CHECK_INIT(ctx);
@@ -84,22 +120,32 @@ squeeze_init(struct tras_ctx *ctx, void *params)
 
 	c->freqt = (unsigned int *)(c + 1);
 	c->nfreq = SQUEEZE_CHI_SQUARE_SLOTS;
-	c->klast = 2147483647;
+	for (l = 0; l < SQUEEZE_LANES; l++)
+		c->k[l] = SQUEEZE_K0;
 	c->K = p->K;
 	c->alpha = p->alpha;
 
 	return (0);
 }
 
-inline static double
-squeeze_uint_to_floatU01(uint32_t u32)
+/*
+ * Squeeze k with the word u, k becomes (k * u) / 2^32 + 1, uniform on
+ * 1..k. The low 32 bits of the product below 2^32 mod k are rejected to
+ * make it exact; then k is not changed. Return non-zero if u is used.
+ */
+inline static int
+squeeze_step(uint32_t *k, uint32_t u)
 {
+	uint64_t m;
+	uint32_t l;
 
-	/* XXX: this is wrong function that need to be corrected
-	 * because since u32 is uniformly distributed the
-	 * return value is not.
-	 */
-	return ((double)u32 / pow(2.0, 32));
+	m = (uint64_t)*k * u;
+	l = (uint32_t)m;
+	if (l < *k && l < (0 - *k) % *k)
+		return (0);
+	*k = (uint32_t)(m >> 32) + 1;
+
+	return (1);
 }
 
 /*
@@ -109,9 +155,9 @@ int
 squeeze_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 {
 	struct squeeze_ctx *c;
-	unsigned int i, n, j, k;
-	double u;
-	uint32_t *p;
+	unsigned int n, w, l, it;
+	const uint8_t *p;
+	uint32_t u, k;
 
 	TRAS_CHECK_UPDATE(ctx, data, nbits);
 
@@ -119,39 +165,28 @@ squeeze_update(struct tras_ctx *ctx, void *data, unsigned int nbits)
 		return (EINVAL);
 
 	c = ctx->context;
-	p = (uint32_t *)data;	/* TODO: consider endianism */
-
-	/* Restore k and i from last update */
-	k = c->klast;
-	i = c->ilast;
-
-	/* Get maximum number of squeezes and words from data */
+	c->nbits += nbits;
+	p = data;
 	n = nbits / 32;
-	j = min(c->nint, c->K);
-	j = c->K - j;
-
-	while (n > 0 && j > 0) {
-		while (n > 0 && i < 48 && k != 1) {
-			u = squeeze_uint_to_floatU01(*p);
-			k = (unsigned int)ceil(u * k);
-			i++;
-			u++;
-			n--;
-			p++;
-		}
-		if (i >= 48 || k == 1) {
-			i = (i < 6) ? 0 : i - 6;
-			c->freqt[i]++;
+
+	for (w = 0; w < n && c->nint < c->K; w++, p += 4) {
+		memcpy(&u, p, sizeof(u));
+		u = be32toh(u);
+		l = (c->nword + w) % SQUEEZE_LANES;
+		k = c->k[l];
+		if (!squeeze_step(&k, u))
+			continue;
+		it = ++c->iter[l];
+		if (k == 1 || it >= SQUEEZE_MAX_ITER) {
+			it = max(it, SQUEEZE_MIN_ITER);
+			c->freqt[it - SQUEEZE_MIN_ITER]++;
 			c->nint++;
-			k = 2147483647;
-			i = 0;
-			j--;
+			k = SQUEEZE_K0;
+			c->iter[l] = 0;
 		}
+		c->k[l] = k;
 	}
-	c->nword += nbits / 32 - n;
-	c->klast = k;
-	c->ilast = i;
-	c->nbits += nbits;
+	c->nword += w;
 
 	return (0);
 }
@@ -163,7 +198,8 @@ int
 squeeze_final(struct tras_ctx *ctx)
 {
 	struct squeeze_ctx *c;
-	double pvalue, mean;
+	double pvalue, chi2, e;
+	unsigned int i;
 
 	TRAS_CHECK_FINAL(ctx);
 
@@ -172,7 +208,12 @@ squeeze_final(struct tras_ctx *ctx)
 	if (c->nint < c->K)
 		return (EALREADY);
 
-	pvalue = 0.0;
+	chi2 = 0.0;
+	for (i = 0; i < c->nfreq; i++) {
+		e = c->K * squeeze_probs[i];
+		chi2 += (c->freqt[i] - e) * (c->freqt[i] - e) / e;
+	}
+	pvalue = igamc((c->nfreq - 1) / 2.0, chi2 / 2.0);
 
 	/*
 	 * Determine and store results.
@@ -183,6 +224,7 @@ squeeze_final(struct tras_ctx *ctx)
 		ctx->result.status = TRAS_TEST_PASSED;
 
 	ctx->result.discard = c->nbits - c->nword * sizeof(uint32_t) * 8;
+	ctx->result.stats1 = chi2;
 	ctx->result.pvalue1 = pvalue;
 
 	tras_fini_context(ctx, 0);
@@ -42,7 +42,7 @@ struct squeeze_params {
 TRAS_DECLARE_ALGO(squeeze);
 
 #define	SQUEEZE_MIN_NUMBERS		100000
-#define	SQUEEZE_MAX_NUMBERS		100000
+#define	SQUEEZE_MAX_NUMBERS		(1U << 30)
 #define	SQUEEZE_CHI_SQUARE_SLOTS	43
 
 #define	SQUEEZE_MIN_NBITS		(32 * SQUEEZE_MIN_NUMBERS)
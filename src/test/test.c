@@ -47,51 +47,121 @@
 
 #include <sys/random.h>
 
+struct test_algo;
+
+typedef void (test_show_t)(const struct test_algo *, struct tras_ctx *, int);
+
 struct test_algo {
 	const char		*name;		/* algorithm name for user */
 	const struct tras_algo	*algo;		/* tras algorithm descriptor */
 	void			*params;	/* tras algorithm params */
 	unsigned int		blocksize;	/* block size for algorithm */
+	test_show_t		*show;		/* show results if not default */
+	unsigned int		flags;		/* TEST_F_* flags */
 };
 
+/*
+ * The results have no p-values for the second-level test.
+ */
+#define	TEST_F_NOPVALUE		0x0001
+
+/*
+ * The results have a second p-value, pvalue2.
+ */
+#define	TEST_F_PVALUE2		0x0002
+
+static test_show_t test_show_sweep;
+static test_show_t test_show_fips;
+static test_show_t test_show_ntmatch;
+
+static struct fips_report test_fips_report;
+static struct ntmatch_report test_ntmatch_report;
+
 struct frequency_params frequency_params = {
 	.alpha = 0.01,
 };
 
+struct frequency_params frequency_decide_params = {
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.01,
+};
+
 struct approxe_params approxe_params = {
 	.m = 3,
 	.alpha = 0.05,
 };
 
+struct approxe_params approxe_decide_params = {
+	.m = 3,
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.05,
+};
+
 struct runs_params runs_params = {
 	.alpha = 0.01,
 };
 
+struct runs_params runs_decide_params = {
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.01,
+};
+
 struct blkfreq_params blkfreq_params = {
 	.m = 64,
 	.alpha = 0.01,
 };
 
+struct blkfreq_params blkfreq_decide_params = {
+	.m = 64,
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.01,
+};
+
 struct sphere3d_params sphere3d_params = {
 	.K = SPHERE3D_MIN_TRIPLETS,
 	.alpha = 0.05,
 };
 
+struct sphere3d_params sphere3d_1m_params = {
+	.K = 1000000,
+	.alpha = 0.05,
+};
+
 struct mindist_params mindist_params = {
 	.K = MINDIST_MIN_POINTS,
 	.alpha = 0.05,
 };
 
+struct mindist_params mindist_1m_params = {
+	.K = 1000000,
+	.alpha = 0.05,
+};
+
 struct plot_params plot_params = {
 	.idist = PARKING_LOT_IDIST_COORD_MAX,
 	.alpha = 0.05,
 };
 
+struct plot_params plot_euclidean_params = {
+	.idist = PARKING_LOT_IDIST_EUCLIDEAN,
+	.alpha = 0.05,
+};
+
+struct plot_params plot_min_params = {
+	.idist = PARKING_LOT_IDIST_COORD_MIN,
+	.alpha = 0.05,
+};
+
 struct squeeze_params squeeze_params = {
 	.K = SQUEEZE_MIN_NUMBERS,
 	.alpha = 0.05,
 };
 
+struct squeeze_params squeeze_1m_params = {
+	.K = 1000000,
+	.alpha = 0.05,
+};
+
 struct oxso_params dna_params = {
 	.boff = 30,
 	.alpha = 0.01,
@@ -112,6 +182,31 @@ struct oxso_params oqso_params = {
 	.alpha = 0.01,
 };
 
+/*
+ * Results for each offset of all tests in the sweep mode.
+ */
+struct tras_sweep test_sweep;
+
+struct oxso_params dna_sweep_params = {
+	.alpha = 0.01,
+	.sweep = &test_sweep,
+};
+
+struct oxso_params opso_sweep_params = {
+	.alpha = 0.01,
+	.sweep = &test_sweep,
+};
+
+struct oxso_params otso_sweep_params = {
+	.alpha = 0.01,
+	.sweep = &test_sweep,
+};
+
+struct oxso_params oqso_sweep_params = {
+	.alpha = 0.01,
+	.sweep = &test_sweep,
+};
+
 struct bstream_params bstream_params = {
 	.alpha = 0.01,
 };
@@ -138,6 +233,12 @@ struct cusum_params cusum_params_bw = {
 	.alpha = 0.01,
 };
 
+struct cusum_params cusum_params_decide = {
+	.mode = CUSUM_MODE_FORWARD,
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.01,
+};
+
 struct excursion_params excursion_params = {
 	.alpha = 0.01,
 };
@@ -147,14 +248,23 @@ struct excursionv_params excursionv_params = {
 };
 
 struct bspace_params bspace_params = {
-	.b = 0,			/* for test purpose only */
+	.b = 0,			/* bits 1 to 24 from msb */
 	.m = 512,		/* 2 ^ 9 */
-	.q = 24,		/* 24 least significance bits */
+	.q = 24,		/* 24 bits per day */
 	.n = 16 * 1024 * 1024,	/* 2 ^ 24 */
-	.nk = 0,		/* ??? */
+	.nk = 500,		/* samples for chi-square */
 	.alpha = 0.01,		/* significance level */
 };
 
+struct bspace_params bspace_sweep_params = {
+	.m = 512,		/* 2 ^ 9 */
+	.q = 24,		/* 24 bits per day */
+	.n = 16 * 1024 * 1024,	/* 2 ^ 24 */
+	.nk = 500,		/* samples for chi-square */
+	.alpha = 0.01,		/* significance level */
+	.sweep = &test_sweep,	/* all 9 offsets of a day */
+};
+
 struct craps_params craps_params = {
 	.K = 200000,
 	.throws = 200000 * 100,
@@ -169,10 +279,90 @@ struct longruns_params longruns_params = {
 .version = 1,
 };
 
+struct longruns_params longruns_decide_params = {
+	.M = 128,
+	.N = 64,
+	.flags = TRAS_P_DECIDE,
+	.alpha = 0.01,
+.version = 1,
+};
+
 struct c1tsbits_params c1tsbits_params = {
+	.K = C1TSBITS_WORDS,
 	.alpha = 0.01,
 };
 
+struct c1tsbits_params c1tsbits_64m_params = {
+	.K = 64 * 1024 * 1024,
+	.alpha = 0.01,
+};
+
+struct c1tssbytes_params c1tssbytes_params = {
+	.b = 24,
+	.K = C1TSSBYTES_WORDS,
+	.alpha = 0.01,
+};
+
+struct c1tssbytes_params c1tssbytes_sweep_params = {
+	.K = C1TSSBYTES_WORDS,
+	.alpha = 0.01,
+	.sweep = &test_sweep,	/* all 25 offsets of a byte */
+};
+
+struct ntmatch_params ntmatch_params = {
+	.m = 9,
+	.M = 131072,
+	.N = 8,
+	.B = 0x001,
+	.alpha = 0.01,
+};
+
+struct ntmatch_params ntmatch_all_params = {
+	.m = 9,
+	.M = 131072,
+	.N = 8,
+	.all = 1,		/* all 148 aperiodic templates */
+	.report = &test_ntmatch_report,
+	.alpha = 0.01,
+};
+
+/* The template of nine ones */
+static const uint8_t otmatch_B[2] = { 0xff, 0x80 };
+
+struct otmatch_params otmatch_params = {
+	.m = 9,
+	.B = otmatch_B,
+	.K = 5,
+	.M = 1032,
+	.N = 968,
+	.alpha = 0.01,
+};
+
+struct operm5_params operm5_params = {
+	.K = OPERM5_WORDS,
+	.alpha = 0.01,
+};
+
+struct ovlpsum_params ovlpsum_params = {
+	.N = OVLPSUM_SAMPLES,
+	.alpha = 0.01,
+};
+
+struct ovlpsum_params ovlpsum_500k_params = {
+	.N = 500000,
+	.alpha = 0.01,
+};
+
+struct fips_params fips_140_1_params = {
+	.version = FIPS_140_1,
+	.report = &test_fips_report,
+};
+
+struct fips_params fips_140_2_params = {
+	.version = FIPS_140_2,
+	.report = &test_fips_report,
+};
+
 struct bmrank_params bmrank_pq31_params = {
 	.uniform = 1,
 	.m = 31,
@@ -228,25 +418,44 @@ struct brank68_params brank68_params = {
 
 static const struct test_algo algo_list[] = {
 	{ "frequency", &frequency_algo, &frequency_params, 0 },
+	{ "frequency-decide", &frequency_algo, &frequency_decide_params, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "sphere3d", &sphere3d_algo, &sphere3d_params, 0 },
+	{ "sphere3d-1m", &sphere3d_algo, &sphere3d_1m_params, 0 },
 	{ "approxe", &approxe_algo, &approxe_params },
+	{ "approxe-decide", &approxe_algo, &approxe_decide_params, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "blkfreq", &blkfreq_algo, &blkfreq_params },
+	{ "blkfreq-decide", &blkfreq_algo, &blkfreq_decide_params, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "bstream", &bstream_algo, &bstream_params },
-	{ "c1tssbytes", NULL, NULL },
+	{ "c1tssbytes", &c1tssbytes_algo, &c1tssbytes_params },
+	{ "c1tssbytes-sweep", &c1tssbytes_algo, &c1tssbytes_sweep_params, 0, test_show_sweep },
 	{ "cusum", &cusum_algo, &cusum_params_fw },
 	{ "cusumfw", &cusum_algo, &cusum_params_fw },
 	{ "cusumbw", &cusum_algo, &cusum_params_bw },
+	{ "cusum-decide", &cusum_algo, &cusum_params_decide, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "fourier", NULL, NULL },
 	{ "lcomplex", NULL, NULL},
 	{ "maurer", &maurer_algo, &maurer_params },
 	{ "coron", &coron_algo, &coron_params },
-	{ "ntmatch", NULL, NULL },
-	{ "otmatch", NULL, NULL },
+	{ "ntmatch", &ntmatch_algo, &ntmatch_params },
+	{ "ntmatch-all", &ntmatch_algo, &ntmatch_all_params, 0,
+	    test_show_ntmatch },
+	{ "otmatch", &otmatch_algo, &otmatch_params },
 	{ "plot", &plot_algo, &plot_params },
+	{ "plot-euclidean", &plot_algo, &plot_euclidean_params },
+	{ "plot-min", &plot_algo, &plot_min_params },
 	{ "runs", &runs_algo, &runs_params },
+	{ "runs-decide", &runs_algo, &runs_decide_params, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "longruns", &longruns_algo, &longruns_params },
+	{ "longruns-decide", &longruns_algo, &longruns_decide_params, 0, NULL,
+	    TEST_F_NOPVALUE },
 	{ "sphere3d", NULL, NULL },
 	{ "squeeze", &squeeze_algo, &squeeze_params },
+	{ "squeeze-1m", &squeeze_algo, &squeeze_1m_params },
 	{ "bkampmassey", NULL, NULL },
 
 	{ "bmrank-pq31", &bmrank_algo, &bmrank_pq31_params },
@@ -260,19 +469,30 @@ static const struct test_algo algo_list[] = {
 	{ "brank68", &brank68_algo, &brank68_params },
 
 	{ "bspace", &bspace_algo, &bspace_params },
+	{ "bspace-sweep", &bspace_algo, &bspace_sweep_params, 0, test_show_sweep },
 	{ "c1tsbits", &c1tsbits_algo, &c1tsbits_params, },
-	{ "craps", &craps_algo, &craps_params },
+	{ "c1tsbits-64m", &c1tsbits_algo, &c1tsbits_64m_params },
+	{ "craps", &craps_algo, &craps_params, 0, NULL, TEST_F_PVALUE2 },
 	{ "opso", &opso_algo, &opso_params },
 	{ "otso", &otso_algo, &otso_params },
 	{ "oqso", &oqso_algo, &oqso_params },
 	{ "dna", &dna_algo, &dna_params },
+	{ "opso-sweep", &opso_algo, &opso_sweep_params, 0, test_show_sweep },
+	{ "otso-sweep", &otso_algo, &otso_sweep_params, 0, test_show_sweep },
+	{ "oqso-sweep", &oqso_algo, &oqso_sweep_params, 0, test_show_sweep },
+	{ "dna-sweep", &dna_algo, &dna_sweep_params, 0, test_show_sweep },
 	{ "excursion", &excursion_algo, &excursion_params },
 	{ "excursionv", &excursionv_algo, &excursionv_params },
-	{ "kstest", NULL, NULL },
 	{ "mindist", &mindist_algo, &mindist_params },
-	{ "operm5", NULL, NULL },
+	{ "mindist-1m", &mindist_algo, &mindist_1m_params },
+	{ "operm5", &operm5_algo, &operm5_params, 0, NULL, TEST_F_PVALUE2 },
 	{ "oqso", NULL, NULL },
-	{ "ovlpsum", NULL, NULL }, 
+	{ "ovlpsum", &ovlpsum_algo, &ovlpsum_params },
+	{ "ovlpsum-500k", &ovlpsum_algo, &ovlpsum_500k_params },
+	{ "fips140-1", &fips_algo, &fips_140_1_params, 0, test_show_fips,
+	    TEST_F_NOPVALUE },
+	{ "fips140-2", &fips_algo, &fips_140_2_params, 0, test_show_fips,
+	    TEST_F_NOPVALUE },
 	{ "serial", NULL, NULL },
 	{ NULL, NULL, NULL },
 };
@@ -304,6 +524,23 @@ static unsigned int test_maxnbits = 0;
  */
 static const struct test_algo *test_desc = NULL;
 
+/*
+ * Number of sequences tested at a time with the batch method, 0 if none.
+ */
+static unsigned int test_batch = 0;
+
+/*
+ * The second-level test of the p-values of all sequences, kept for KS up
+ * to test_nagg of them. The second one takes pvalue2, if asked for.
+ */
+#define	TEST_AGG_ALPHA		0.01
+
+static unsigned int test_nagg = 0;
+static unsigned int test_nagg_ctx = 0;
+static struct tras_ctx test_agg_ctx[2];
+static struct kstest_report test_agg_report[2];
+static struct kstest_params test_agg_params[2];
+
 #define	min(a, b)	(((a) < (b)) ? (a) : (b))
 
 static void
@@ -315,6 +552,9 @@ test_usage(void)
 	printf("-h        : print usage of the application\n");
 	printf("-l        : print list of algorithms\n");
 	printf("-t        : run statistical test\n");
+	printf("-a n      : test pvalue1 of all sequences, n kept for KS\n");
+	printf("-A n      : as -a, and pvalue2 in the second test if any\n");
+	printf("-k n      : test n sequences at a time in a batch\n");
 }
 
 static int
@@ -451,6 +691,15 @@ test_stdin_read(void *data, size_t *size)
 	return (test_file_read(STDIN_FILENO, data, size));
 }
 
+static void
+test_show_one(const char *idstr, const struct tras_result *result)
+{
+
+	printf("%-28s: pvalue = %.*f%-8s stats1 = %.*f%-8s %s\n",
+	    idstr, 8, result->pvalue1, "\t", 8, result->stats1, "\t",
+	    (result->status == TRAS_TEST_PASSED) ? "success" : "failed");
+}
+
 static void
 test_show_result(const struct tras_algo *algo, struct tras_ctx *ctx, int id)
 {
@@ -458,11 +707,242 @@ test_show_result(const struct tras_algo *algo, struct tras_ctx *ctx, int id)
 
 	snprintf(idstr, sizeof(idstr), "%s test #%d", algo->name, id);
 
-	printf("%-28s: pvalue = %.*f%-8s stats1 = %.*f%-8s %s\n",
-	    idstr, 8, ctx->result.pvalue1, "\t", 8, ctx->result.stats1, "\t",
+	test_show_one(idstr, &ctx->result);
+}
+
+/*
+ * Show results for each offset of the test in the sweep mode.
+ */
+static void
+test_show_sweep(const struct test_algo *desc, struct tras_ctx *ctx, int id)
+{
+	char idstr[64];
+	unsigned int o;
+
+	for (o = 0; o < test_sweep.n; o++) {
+		snprintf(idstr, sizeof(idstr), "%s test #%d offset %u",
+		    desc->algo->name, id, o);
+		test_show_one(idstr, &test_sweep.result[o]);
+	}
+}
+
+/*
+ * Show the failures of the FIPS tests by test.
+ */
+static void
+test_show_fips(const struct test_algo *desc, struct tras_ctx *ctx, int id)
+{
+	const struct fips_report *r = &test_fips_report;
+
+	printf("%s test #%d: blocks %llu failed %llu (monobit %llu "
+	    "poker %llu runs %llu long run %llu) %s\n", desc->algo->name, id,
+	    (unsigned long long)r->nblks, (unsigned long long)r->nfail,
+	    (unsigned long long)r->fail[FIPS_MONOBIT],
+	    (unsigned long long)r->fail[FIPS_POKER],
+	    (unsigned long long)r->fail[FIPS_RUNS],
+	    (unsigned long long)r->fail[FIPS_LONGRUN],
 	    (ctx->result.status == TRAS_TEST_PASSED) ? "success" : "failed");
 }
 
+/*
+ * Show the number of failed templates and the proportion decision, the
+ * p-values are by template.
+ */
+static void
+test_show_ntmatch(const struct test_algo *desc, struct tras_ctx *ctx, int id)
+{
+
+	printf("%s test #%d: templates %u failed %u %s\n", desc->algo->name,
+	    id, test_ntmatch_report.n, (unsigned int)ctx->result.stats2,
+	    (ctx->result.status == TRAS_TEST_PASSED) ? "success" : "failed");
+}
+
+static int
+test_agg_init(void)
+{
+	unsigned int i;
+	int error;
+
+	for (i = 0; i < test_nagg_ctx; i++) {
+		test_agg_params[i].N = test_nagg;
+		test_agg_params[i].alpha1 = TEST_AGG_ALPHA;
+		test_agg_params[i].alpha = KSTEST_ALPHA;
+		test_agg_params[i].report = &test_agg_report[i];
+
+		tras_ctx_init(&test_agg_ctx[i]);
+		error = kstest_algo.init(&test_agg_ctx[i], &test_agg_params[i]);
+		if (error != 0) {
+			while (i-- > 0)
+				kstest_algo.free(&test_agg_ctx[i]);
+			return (error);
+		}
+	}
+	return (0);
+}
+
+/*
+ * Collect the p-values of n results.
+ */
+static int
+test_agg_result(const struct tras_result *r, unsigned int n)
+{
+	double pvalue;
+	unsigned int i, o;
+	int error;
+
+	for (o = 0; o < n; o++) {
+		for (i = 0; i < test_nagg_ctx; i++) {
+			pvalue = (i == 0) ? r[o].pvalue1 : r[o].pvalue2;
+			error = kstest_algo.update(&test_agg_ctx[i], &pvalue,
+			    8 * sizeof(pvalue));
+			if (error != 0) {
+				printf("test: invalid pvalue%u %f for "
+				    "the second-level test\n", i + 1, pvalue);
+				return (error);
+			}
+		}
+	}
+	return (0);
+}
+
+/*
+ * Collect the p-values of the sequence just tested, in the sweep mode
+ * each offset gives its own, with all templates of ntmatch each template.
+ */
+static int
+test_agg_update(struct tras_ctx *ctx)
+{
+
+	if (test_desc->show == test_show_sweep)
+		return (test_agg_result(test_sweep.result, test_sweep.n));
+	if (test_desc->show == test_show_ntmatch)
+		return (test_agg_result(test_ntmatch_report.result,
+		    test_ntmatch_report.n));
+
+	return (test_agg_result(&ctx->result, 1));
+}
+
+static void
+test_agg_show(void)
+{
+	const struct kstest_report *r;
+	struct tras_result res;
+	char idstr[64];
+	unsigned int i, b;
+	double p;
+	int error;
+
+	for (i = 0; i < test_nagg_ctx; i++) {
+		error = kstest_algo.final(&test_agg_ctx[i]);
+		if (error != 0) {
+			printf("test: failed to finalize the second-level "
+			    "test (%d)\n", error);
+			kstest_algo.free(&test_agg_ctx[i]);
+			continue;
+		}
+		r = &test_agg_report[i];
+
+		res = test_agg_ctx[i].result;
+		res.status = (res.pvalue1 >= KSTEST_ALPHA) ?
+		    TRAS_TEST_PASSED : TRAS_TEST_FAILED;
+		snprintf(idstr, sizeof(idstr), "pvalue%u uniformity", i + 1);
+		test_show_one(idstr, &res);
+
+		res.pvalue1 = res.pvalue2;
+		res.stats1 = res.stats2;
+		res.status = (res.pvalue1 >= KSTEST_ALPHA) ?
+		    TRAS_TEST_PASSED : TRAS_TEST_FAILED;
+		snprintf(idstr, sizeof(idstr), "pvalue%u KS", i + 1);
+		test_show_one(idstr, &res);
+
+		snprintf(idstr, sizeof(idstr), "pvalue%u proportion", i + 1);
+		p = (double)r->npass / r->n;
+		printf("%-28s: %u/%u = %.8f in [%.8f, %.8f]\t %s\n",
+		    idstr, r->npass, r->n, p, r->lo, r->hi,
+		    (p >= r->lo && p <= r->hi) ? "success" : "failed");
+
+		snprintf(idstr, sizeof(idstr), "pvalue%u bins", i + 1);
+		printf("%-28s:", idstr);
+		for (b = 0; b < KSTEST_BINS; b++)
+			printf(" %u", r->hist[b]);
+		printf("\n");
+
+		kstest_algo.free(&test_agg_ctx[i]);
+	}
+}
+
+/*
+ * Test test_batch sequences at a time, each one read whole from a byte
+ * boundary. A last partial sequence is not tested.
+ */
+static int
+test_cmd_batch(void)
+{
+	const struct tras_algo *algo;
+	struct tras_result *result;
+	size_t nread, stride;
+	unsigned int n, i, k;
+	int error, id;
+	char *data, idstr[64];
+
+	algo = test_desc->algo;
+	stride = TRAS_BATCH_STRIDE(test_maxnbits);
+
+	data = malloc(stride * test_batch);
+	result = malloc(test_batch * sizeof(struct tras_result));
+	if (data == NULL || result == NULL) {
+		free(data);
+		free(result);
+		return (ENOMEM);
+	}
+	error = test_agg_init();
+	if (error != 0) {
+		printf("test failed to init the second-level test\n");
+		free(data);
+		free(result);
+		return (error);
+	}
+	id = 0;
+
+	n = (test_total > 0) ? test_total : UINT_MAX;
+
+	while (n > 0) {
+		nread = min(stride * test_batch, n);
+		error = test_stdin_read(data, &nread);
+		if (error != 0 || nread < stride)
+			break;
+
+		k = nread / stride;
+		error = tras_do_batch(algo, test_desc->params, data,
+		    test_maxnbits, k, result);
+		if (error != 0) {
+			printf("test: failed to test a batch of %s (%d)\n",
+			    algo->name, error);
+			break;
+		}
+		for (i = 0; i < k; i++) {
+			snprintf(idstr, sizeof(idstr), "%s test #%d",
+			    algo->name, ++id);
+			test_show_one(idstr, &result[i]);
+		}
+		error = test_agg_result(result, k);
+		if (error != 0)
+			break;
+		n = n - nread;
+	}
+
+	if (test_nagg_ctx > 0 && id > 0)
+		test_agg_show();
+	else
+		for (n = 0; n < test_nagg_ctx; n++)
+			kstest_algo.free(&test_agg_ctx[n]);
+
+	free(data);
+	free(result);
+
+	return (error);
+}
+
 #define miss(c, cmax)   (((c) < (cmax)) ? (cmax) - (c) : 0)
 
 static int
@@ -483,6 +963,26 @@ test_cmd_test(void)
 		printf("number of bits to test not specified\n");
 		return (EINVAL);
 	}
+	if (test_nagg_ctx > 0 && (test_desc->flags & TEST_F_NOPVALUE)) {
+		printf("test: %s has no p-values for the second-level test\n",
+		    test_desc->name);
+		return (EINVAL);
+	}
+	if (test_nagg_ctx > 1 && !(test_desc->flags & TEST_F_PVALUE2)) {
+		printf("test: %s has no pvalue2 for the second-level test\n",
+		    test_desc->name);
+		return (EINVAL);
+	}
+	if (test_batch > 0 && test_desc->show != NULL) {
+		printf("test: no batch mode for %s, ignoring -k\n",
+		    test_desc->name);
+	} else if (test_batch > 0) {
+		if (test_desc->algo->batch == NULL)
+			printf("test: no batch method in %s, testing the "
+			    "sequences of a batch one by one\n",
+			    test_desc->algo->name);
+		return (test_cmd_batch());
+	}
 
 	tras_ctx_init(&ctx);
 
@@ -492,10 +992,18 @@ test_cmd_test(void)
 		printf("test failed to init %s algorithm\n", algo->name);
 		return (error);
 	}
+	error = test_agg_init();
+	if (error != 0) {
+		printf("test failed to init the second-level test\n");
+		algo->free(&ctx);
+		return (error);
+	}
 	size = test_desc->blocksize;
 	size = size ? size : 2048;
 	data = malloc(size);
 	if (data == NULL) {
+		for (n = 0; n < test_nagg_ctx; n++)
+			kstest_algo.free(&test_agg_ctx[n]);
 		algo->free(&ctx);
 		return (ENOMEM);
 	}
@@ -540,7 +1048,13 @@ test_cmd_test(void)
 				printf("failed to finalize the test (%d)\n", error);
 				break;
 			}
-			test_show_result(algo, &ctx, id + 1);
+			if (test_desc->show != NULL)
+				test_desc->show(test_desc, &ctx, id + 1);
+			else
+				test_show_result(algo, &ctx, id + 1);
+			error = test_agg_update(&ctx);
+			if (error != 0)
+				break;
 			ntest = 0;
 			id++;
 		}
@@ -548,6 +1062,12 @@ test_cmd_test(void)
 		nread = 0;
 	}
 
+	if (test_nagg_ctx > 0 && id > 0)
+		test_agg_show();
+	else
+		for (n = 0; n < test_nagg_ctx; n++)
+			kstest_algo.free(&test_agg_ctx[n]);
+
 	algo->free(&ctx);
 	free(data);
 
@@ -569,7 +1089,7 @@ test_select_test(const char *name)
 	return ((test_desc == NULL) ? EINVAL : 0);
 }
 
-#define	TEST_OPTSTR	"hlt:s:S:"
+#define	TEST_OPTSTR	"hlt:s:S:a:A:k:"
 
 int main(int argc, char *argv[])
 {
@@ -591,6 +1111,22 @@ int main(int argc, char *argv[])
 				return (EINVAL);
 			}
 			break;
+		case 'a':
+		case 'A':
+			error = test_getuint(optarg, &test_nagg);
+			if (error != 0 || test_nagg == 0) {
+				printf("test: invalid number of p-values\n");
+				return (EINVAL);
+			}
+			test_nagg_ctx = (c == 'A') ? 2 : 1;
+			break;
+		case 'k':
+			error = test_getuint(optarg, &test_batch);
+			if (error != 0 || test_batch == 0) {
+				printf("test: invalid number of sequences\n");
+				return (EINVAL);
+			}
+			break;
 		case 'S':
 			error = test_getuint(optarg, &test_total);
 			if (error != 0) {
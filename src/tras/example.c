@@ -50,6 +50,7 @@ int main(void)
 		((char *)data)[i] = (char)(i & 0xff);
 
 	/* Initialize test context */
+	tras_ctx_init(&ctx);
 	error = tras_test_init(&ctx, &frequency_algo, NULL);
 	if (error != 0) {
 		free(data);
@@ -44,9 +44,94 @@ tras_ctx_init(struct tras_ctx *ctx)
 
 	ctx->state = TRAS_STATE_NONE;
 	ctx->context = NULL;
+	ctx->size = 0;
+	ctx->pool = NULL;
 	ctx->algo = NULL;
 }
 
+/*
+ * Take the context memory from the pool, it must be set before the init.
+ */
+void
+tras_ctx_set_pool(struct tras_ctx *ctx, struct tras_pool *pool)
+{
+
+	ctx->pool = pool;
+}
+
+void
+tras_pool_init(struct tras_pool *pool)
+{
+
+	memset(pool, 0, sizeof(*pool));
+}
+
+/*
+ * Free the blocks of the pool, the contexts using it must be freed first.
+ */
+void
+tras_pool_destroy(struct tras_pool *pool)
+{
+	unsigned int i;
+
+	for (i = 0; i < TRAS_POOL_SLOTS; i++) {
+		free(pool->block[i]);
+		pool->block[i] = NULL;
+		pool->size[i] = 0;
+	}
+}
+
+static void *
+tras_pool_get(struct tras_pool *pool, size_t size)
+{
+	void *c;
+	unsigned int i;
+
+	if (pool != NULL) {
+		for (i = 0; i < TRAS_POOL_SLOTS; i++) {
+			if (pool->block[i] != NULL && pool->size[i] == size) {
+				c = pool->block[i];
+				pool->block[i] = NULL;
+				return (c);
+			}
+		}
+	}
+	return (malloc(size));
+}
+
+/*
+ * Put the block back to the pool, free it if the pool is full.
+ */
+static void
+tras_pool_put(struct tras_pool *pool, void *c, size_t size)
+{
+	unsigned int i;
+
+	if (pool != NULL) {
+		for (i = 0; i < TRAS_POOL_SLOTS; i++) {
+			if (pool->block[i] == NULL) {
+				pool->block[i] = c;
+				pool->size[i] = size;
+				return;
+			}
+		}
+	}
+	free(c);
+}
+
+/*
+ * Release the context memory, only if owned by the context.
+ */
+static void
+tras_release_context(struct tras_ctx *ctx)
+{
+
+	if (ctx->context != NULL && ctx->size > 0)
+		tras_pool_put(ctx->pool, ctx->context, ctx->size);
+	ctx->context = NULL;
+	ctx->size = 0;
+}
+
 void
 tras_ctx_free(struct tras_ctx *ctx)
 {
@@ -63,10 +148,11 @@ tras_test_init(struct tras_ctx *ctx, const struct tras_algo *algo, size_t size)
 	if (ctx->state > TRAS_STATE_NONE)
 		return (EBUSY);
 
-	ctx->context = malloc(size);
+	ctx->context = tras_pool_get(ctx->pool, size);
 	if (ctx->context == NULL)
 		return (ENOMEM);
 
+	ctx->size = size;
 	ctx->algo = algo;
 	ctx->state = TRAS_STATE_INIT;
 
@@ -121,6 +207,48 @@ tras_do_test(struct tras_ctx *ctx, void *data, unsigned int nbits)
 	return (0);
 }
 
+/*
+ * Test k sequences with the batch method of the algorithm, or one by one
+ * with a single context if it has none.
+ */
+int
+tras_do_batch(const struct tras_algo *algo, void *params, const void *data,
+    unsigned int nbits, unsigned int k, struct tras_result *result)
+{
+	struct tras_ctx ctx;
+	const uint8_t *p;
+	unsigned int i;
+	int error;
+
+	if (algo == NULL || data == NULL || result == NULL)
+		return (EINVAL);
+	if (algo->batch != NULL)
+		return (algo->batch(params, data, nbits, k, result));
+	if (tras_verify_algo(algo) != 0)
+		return (ENOSYS);
+
+	p = (const uint8_t *)data;
+	tras_ctx_init(&ctx);
+	error = algo->init(&ctx, params);
+	for (i = 0; i < k && error == 0; i++) {
+		if (i > 0 && algo->restart != NULL)
+			error = algo->restart(&ctx, params);
+		else if (i > 0)
+			error = tras_do_restart(&ctx, params);
+		if (error == 0)
+			error = algo->update(&ctx, (void *)(p + i *
+			    TRAS_BATCH_STRIDE(nbits)), nbits);
+		if (error == 0)
+			error = algo->final(&ctx);
+		if (error == 0)
+			result[i] = ctx.result;
+	}
+	if (ctx.state != TRAS_STATE_NONE)
+		tras_do_free(&ctx);
+
+	return (error);
+}
+
 int
 tras_test_final(struct tras_ctx *ctx)
 {
@@ -169,15 +297,26 @@ tras_test_free(struct tras_ctx *ctx)
 	return (0);
 }
 
+/*
+ * Restart the test in place. The context memory is kept for the init, it
+ * takes it back if of the same size, then the restart costs a memset.
+ */
 int
 tras_do_restart(struct tras_ctx *ctx, void *params)
 {
 	int error;
 
-	error = tras_do_free(ctx);
+	if (ctx == NULL)
+		return (EINVAL);
+	if (ctx->state < TRAS_STATE_INIT)
+		return (ENXIO);
+
+	ctx->state = TRAS_STATE_NONE;
+	error = ctx->algo->init(ctx, params);
 	if (error != 0)
-		return (error);
-	return (ctx->algo->init(ctx, params));
+		tras_release_context(ctx);
+
+	return (error);
 }
 
 int
@@ -188,10 +327,7 @@ tras_do_free(struct tras_ctx *ctx)
 		return (EINVAL);
 	if (ctx->state < TRAS_STATE_INIT)
 		return (ENXIO);
-	if (ctx->context != NULL) {
-		free(ctx->context);
-		ctx->context = NULL;
-	}
+	tras_release_context(ctx);
 	ctx->state = TRAS_STATE_NONE;
 
 	return (0);
@@ -206,32 +342,38 @@ tras_init_context(struct tras_ctx *ctx, const struct tras_algo *algo,
 	if (ctx == NULL || algo == NULL)
 		return (EINVAL);
 
-	if (size > 0) {
-		c = malloc(size);
-		if (c == NULL)
-			return (ENOMEM);
-		if (flags & TRAS_F_ZERO)
-			memset(c, 0, size);
+	/* The memory kept by the context since the last test first */
+	if (size > 0 && ctx->context != NULL && ctx->size == size) {
+		c = ctx->context;
+	} else {
+		tras_release_context(ctx);
+		if (size > 0) {
+			c = tras_pool_get(ctx->pool, size);
+			if (c == NULL)
+				return (ENOMEM);
+		}
 	}
+	if (c != NULL && (flags & TRAS_F_ZERO))
+		memset(c, 0, size);
 
 	memset(&ctx->result, 0, sizeof(ctx->result));
 
 	ctx->context = c;
+	ctx->size = size;
 	ctx->algo = algo;
 	ctx->state = TRAS_STATE_INIT;
 
 	return (0);
 }
 
+/*
+ * The context memory is kept after the final for a restart, it is released
+ * by the free method.
+ */
 void
 tras_fini_context(struct tras_ctx *ctx, int flags)
 {
 
-	if (ctx != NULL) {
-		if (ctx->context != NULL) {
-			free(ctx->context);
-			ctx->context = NULL;
-		}
+	if (ctx != NULL)
 		ctx->state = TRAS_STATE_FINAL;
-	}
 }
@@ -57,5 +57,24 @@ bitcount_32(uint32_t x)
 	return (x);
 }
 
+/*
+ * With the popcnt instruction enabled, e.g. by -mpopcnt or -march=native,
+ * the compiler builtin takes one instruction.
+ */
+static inline uint64_t
+bitcount_64(uint64_t x)
+{
+#if defined(__GNUC__) && defined(__POPCNT__)
+	return (__builtin_popcountll(x));
+#else
+
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+
+	return ((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
 #endif
 
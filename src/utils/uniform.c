@@ -0,0 +1,81 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Conversion of random words to uniformly distributed floating point
+ * numbers in [0, 1).
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <endian.h>
+
+#include <uniform.h>
+
+void
+uniform_be32_to_double(double *d, const void *data, unsigned int n,
+    double scale)
+{
+	const uint8_t *p = data;
+	uint32_t u;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		memcpy(&u, p + sizeof(u) * i, sizeof(u));
+		d[i] = uniform_u32_to_double(be32toh(u)) * scale;
+	}
+}
+
+void
+uniform_be64_to_double(double *d, const void *data, unsigned int n,
+    double scale)
+{
+	const uint8_t *p = data;
+	uint64_t u;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		memcpy(&u, p + sizeof(u) * i, sizeof(u));
+		d[i] = uniform_u64_to_double(be64toh(u)) * scale;
+	}
+}
+
+void
+uniform_be32_to_float(float *f, const void *data, unsigned int n,
+    float scale)
+{
+	const uint8_t *p = data;
+	uint32_t u;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		memcpy(&u, p + sizeof(u) * i, sizeof(u));
+		f[i] = uniform_u32_to_float(be32toh(u)) * scale;
+	}
+}
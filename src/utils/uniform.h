@@ -0,0 +1,92 @@
+/*-
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright (c) 2023 Marek Marcin Fijałkowski
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The names of the authors may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Conversion of random words to uniformly distributed floating point
+ * numbers in [0, 1).
+ */
+
+#ifndef __TRAS_UNIFORM_H__
+#define	__TRAS_UNIFORM_H__
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * A 32-bit word u is converted exactly to u * 2^-32 by filling the low
+ * 32 of the 52 mantissa bits of 1.0 and subtracting 1.0. There is no
+ * rounding and no integer to double conversion, so the batch loops are
+ * vectorized with plain integer and double operations.
+ */
+#define	UNIFORM_ONE_BITS	UINT64_C(0x3ff0000000000000)
+
+static inline double
+uniform_u32_to_double(uint32_t u)
+{
+	uint64_t b;
+	double d;
+
+	b = UNIFORM_ONE_BITS | ((uint64_t)u << 20);
+	memcpy(&d, &b, sizeof(d));
+
+	return (d - 1.0);
+}
+
+/*
+ * A 64-bit word gives 53 bits, (u >> 11) * 2^-53.
+ */
+static inline double
+uniform_u64_to_double(uint64_t u)
+{
+
+	return ((double)(int64_t)(u >> 11) * 0x1p-53);
+}
+
+/*
+ * A 32-bit word gives 24 bits for a float, (u >> 8) * 2^-24.
+ */
+static inline float
+uniform_u32_to_float(uint32_t u)
+{
+
+	return ((float)(int32_t)(u >> 8) * 0x1p-24f);
+}
+
+/*
+ * Convert n big endian words from data to numbers multiplied by scale,
+ * data need not be aligned.
+ */
+void uniform_be32_to_double(double *d, const void *data, unsigned int n,
+    double scale);
+void uniform_be64_to_double(double *d, const void *data, unsigned int n,
+    double scale);
+void uniform_be32_to_float(float *f, const void *data, unsigned int n,
+    float scale);
+
+#endif